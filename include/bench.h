@@ -0,0 +1,12 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include <Arduino.h>
+
+// Measures local encoder throughput (blocks/s and Mbit/s of information) for a
+// set of (K, N) shapes and reports one line per configuration. Shapes whose
+// tables do not fit in memory are reported as skipped. Ends with the speedup
+// of splitting whole messages across both cores (parallel_encode.h).
+void runEncoderBenchmark(Print &out);
+
+#endif
@@ -0,0 +1,45 @@
+#ifndef BLOCK_VERIFIER_H
+#define BLOCK_VERIFIER_H
+
+#include <stdint.h>
+
+// Checks received codeword blocks on the second core while the MCU exchange
+// continues on this one. The exchange pushes the number of every block that has
+// landed in encoded_buffer onto a single-producer single-consumer ring; the
+// verifier task pops them, runs the check callback and records a verdict per
+// block. Only the ring indices are shared, so neither side ever takes a lock.
+#define VERIFY_QUEUE_SIZE 64 // Power of two
+#define VERIFY_TASK_STACK 8192
+
+enum BlockVerdict : uint8_t
+{
+  BLOCK_UNCHECKED = 0,
+  BLOCK_VALID = 1,
+  BLOCK_FLIPPED = 2,    // Failed the check, repaired in place by bit flipping
+  BLOCK_REENCODED = 3,  // Failed the check or differed from the local encoding, replaced by it
+  BLOCK_CORRUPT = 4     // Failed the check and could not be repaired
+};
+
+// Runs on the verifier core. The block is complete and no longer written by
+// the exchange, so the callback may repair it in place.
+typedef BlockVerdict (*BlockCheck)(void *context, uint16_t block);
+
+// Starts the verifier task on the core that does not run loop(). Returns false
+// on single-core chips or if the task cannot be created.
+bool verifierBegin(BlockCheck check);
+bool verifierReady();
+
+// Starts a job: verdicts[0, blocks) are cleared and filled in as blocks are
+// checked, context is passed to the check callback
+void verifierStart(void *context, BlockVerdict *verdicts, uint16_t blocks);
+
+// Queues a block for checking; waits only while the ring is full
+void verifierPush(uint16_t block);
+
+// Waits until every queued block has been checked
+void verifierFinish();
+
+// Most blocks waiting at once since the verifier started
+uint16_t verifierMaxDepth();
+
+#endif
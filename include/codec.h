@@ -0,0 +1,25 @@
+#ifndef CODEC_H
+#define CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Number of characters base64Encode() produces for n input bytes (padded)
+#define BASE64_ENCODED_LENGTH(n) ((((n) + 2) / 3) * 4)
+
+// Returned by base64Decode() for malformed input or output that would not fit
+#define BASE64_INVALID ((size_t)-1)
+
+// CRC-32 (IEEE 802.3, as used by zlib). Pass 0 to start a new checksum and the
+// previous result to continue one across several buffers.
+uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t length);
+
+// Encodes length bytes as standard base64 with '=' padding. Returns the number
+// of characters written to dst; no terminating NUL is added.
+size_t base64Encode(const uint8_t *src, size_t length, char *dst);
+
+// Decodes padded base64 (no embedded whitespace) into at most capacity bytes.
+// Returns the number of bytes written, or BASE64_INVALID.
+size_t base64Decode(const char *src, size_t length, uint8_t *dst, size_t capacity);
+
+#endif
@@ -0,0 +1,50 @@
+#ifndef FRAME_H
+#define FRAME_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Binary frame shared by result output and the machine command protocol:
+//   FRAME_SYNC_0, FRAME_SYNC_1, type, length (big-endian uint16), payload,
+//   CRC-32 (big-endian) over type, length and payload
+#define FRAME_SYNC_0 0xA5
+#define FRAME_SYNC_1 0x5A
+#define FRAME_HEADER_LENGTH 5
+#define FRAME_CRC_LENGTH 4
+
+enum FrameEvent
+{
+  FRAME_NONE,         // Byte consumed, frame not complete yet
+  FRAME_READY,        // A complete frame with a valid CRC is in the parser
+  FRAME_ERROR_CRC,    // A complete frame arrived but its CRC did not match
+  FRAME_ERROR_LENGTH  // Declared length exceeds the payload buffer; frame skipped
+};
+
+// Incremental frame decoder; the payload buffer is supplied by the caller
+struct FrameParser
+{
+  uint8_t *payload;
+  uint16_t capacity;
+  uint8_t state;
+  uint8_t type;
+  uint16_t length;
+  uint16_t received;
+  uint32_t crc;
+  uint32_t expectedCrc;
+};
+
+void frameParserInit(FrameParser &parser, uint8_t *payload, uint16_t capacity);
+void frameParserReset(FrameParser &parser);
+
+// Feeds one byte. After FRAME_READY the type, length and payload fields hold the
+// frame until the next call.
+FrameEvent frameParserPush(FrameParser &parser, uint8_t byte);
+
+// Writes the five header bytes for a frame and returns the CRC-32 of the part of
+// the header that the frame CRC covers, for continuing over the payload.
+uint32_t frameWriteHeader(uint8_t *dst, uint8_t type, uint16_t length);
+
+// Writes the four CRC bytes that close a frame
+void frameWriteCrc(uint8_t *dst, uint32_t crc);
+
+#endif
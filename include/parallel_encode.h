@@ -0,0 +1,25 @@
+#ifndef PARALLEL_ENCODE_H
+#define PARALLEL_ENCODE_H
+
+#include "ldpc_encoder.h"
+
+// Local encoding split across both ESP32 cores. A worker task pinned to the
+// core that does not run loop() encodes the first part of the blocks while the
+// caller encodes the rest; each side writes only its own slice of the output,
+// so no locking is needed beyond the start and done signals.
+#define PARALLEL_MIN_BLOCKS 4 // Fewer blocks are encoded on the calling core, waking the worker costs more
+#define PARALLEL_TASK_STACK 8192
+
+// Starts the worker task. Returns false on single-core chips or if the task
+// cannot be created; parallelEncodeBlocks() then always runs on one core.
+bool parallelEncodeBegin();
+
+// Same result as ldpcEncodeBlocks(). `worker` is a second instance configured
+// for the same code (encoders keep per-instance scratch); without one, or for
+// fewer than PARALLEL_MIN_BLOCKS blocks, everything is encoded on the calling
+// core. The split falls on a multiple of batchLanes(). Returns the number of
+// cores used.
+uint8_t parallelEncodeBlocks(const LdpcEncoder &encoder, const LdpcEncoder *worker, const uint8_t *message,
+                             uint16_t messageBits, uint16_t blocks, uint8_t *out);
+
+#endif
@@ -0,0 +1,62 @@
+#ifndef PHASE_TIMING_H
+#define PHASE_TIMING_H
+
+#include <stdint.h>
+
+// Where the time of a job goes: each phase gets a histogram of durations in
+// microseconds (esp_timer_get_time()). Buckets are log-linear, eight per power
+// of two, so percentiles are good to 12.5% over the whole range in a fixed
+// PHASE_BUCKETS counters per phase. Only loop() records, so nothing is locked.
+#define PHASE_TIMING // Comment this line to compile the instrumentation out
+#define PHASE_SUB_BITS 3 // Linear buckets per power of two: 1 << PHASE_SUB_BITS
+#define PHASE_MAX_EXPONENT 27 // Durations from 2^27 us (134 s) up share the last bucket
+#define PHASE_BUCKETS ((PHASE_MAX_EXPONENT - PHASE_SUB_BITS + 1) << PHASE_SUB_BITS)
+
+enum Phase
+{
+  PHASE_TAG_WAIT,         // waitForTag()
+  PHASE_SEND_LENGTH,      // sendMessageLength()
+  PHASE_RECEIVE_PARAMS,   // receiveParameters()
+  PHASE_BLOCK_TX,         // First to last byte of a block sent to an MCU
+  PHASE_BLOCK_RX,         // Block sent in full until its codeword is in
+  PHASE_INPUT_CONVERSION, // Text/hex/base64/binary input to message bits
+  PHASE_PRINT,            // printBytes() / printResult()
+  PHASE_COUNT
+};
+
+struct PhaseSummary
+{
+  uint32_t count;
+  uint32_t p50; // Upper edge of the bucket holding the percentile
+  uint32_t p99;
+  uint32_t max; // Exact
+};
+
+const char *phaseName(Phase phase);
+void phaseSummary(Phase phase, PhaseSummary &summary);
+void phaseReset();
+
+#ifdef PHASE_TIMING
+uint32_t phaseNow();
+void phaseRecord(Phase phase, uint32_t micros);
+
+// Times the rest of the enclosing scope
+struct PhaseScope
+{
+  Phase phase;
+  uint32_t start;
+
+  explicit PhaseScope(Phase phase) : phase(phase), start(phaseNow()) {}
+  ~PhaseScope() { phaseRecord(phase, phaseNow() - start); }
+};
+
+#define PHASE_SCOPE(phase) PhaseScope phaseScope(phase)
+#define PHASE_STAMP(stamp) ((stamp) = phaseNow())
+#define PHASE_RECORD(phase, since) phaseRecord(phase, phaseNow() - (since))
+#else
+#define PHASE_SCOPE(phase)
+#define PHASE_STAMP(stamp) ((void)0)
+#define PHASE_RECORD(phase, since) ((void)0)
+#endif
+
+#endif
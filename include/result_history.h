@@ -0,0 +1,46 @@
+#ifndef RESULT_HISTORY_H
+#define RESULT_HISTORY_H
+
+#include <stdint.h>
+
+// Recent encoding results, so a host can fetch one by job ID after others have
+// run. Records sit in a fixed ring and their bytes (message, then codewords) in
+// one pooled arena that is filled like a ring as well: a new result goes after
+// the newest one, wrapping to the start when it does not fit at the end, and
+// the oldest results are evicted until it does. IDs are handed out in order,
+// so a lookup is an index into the ring.
+#define RESULT_HISTORY_SIZE 16
+#define RESULT_ARENA_BYTES 8192 // Room for the largest result at least
+
+struct ResultRecord
+{
+  uint16_t id;
+  uint8_t mode; // InputMode of the request
+  uint16_t K;
+  uint16_t N;
+  uint16_t messageBits;
+  uint16_t calculationBits;
+  uint16_t blocks;
+  uint16_t offset; // Of the message in the arena; the codewords follow it
+  uint16_t messageBytes;
+  uint16_t encodedBytes;
+};
+
+// Stores a result, evicting old ones as needed. Returns NULL if it could never
+// fit the arena.
+const ResultRecord *historyAdd(uint8_t mode, uint16_t K, uint16_t N, uint16_t messageBits, uint16_t calculationBits,
+                               const uint8_t *message, const uint8_t *encoded);
+
+// The result with this ID, or NULL once it has been evicted
+const ResultRecord *historyFind(uint16_t id);
+
+// Results from the newest (age 0) back; NULL past the oldest one kept
+const ResultRecord *historyAt(uint8_t age);
+
+uint8_t historyCount();
+uint32_t historyEvictions();
+
+const uint8_t *historyMessage(const ResultRecord &record);
+const uint8_t *historyEncoded(const ResultRecord &record);
+
+#endif
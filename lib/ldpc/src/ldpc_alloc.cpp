@@ -0,0 +1,28 @@
+#include "ldpc_alloc.h"
+
+#include <stdlib.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_heap_caps.h>
+#endif
+
+void *ldpcAllocTable(size_t bytes)
+{
+#ifdef ESP_PLATFORM
+  void *table = heap_caps_malloc(bytes, MALLOC_CAP_SPIRAM | MALLOC_CAP_32BIT);
+  if (table == NULL)
+    table = heap_caps_malloc(bytes, MALLOC_CAP_INTERNAL | MALLOC_CAP_32BIT);
+  return table;
+#else
+  return malloc(bytes);
+#endif
+}
+
+void ldpcFreeTable(void *table)
+{
+#ifdef ESP_PLATFORM
+  heap_caps_free(table);
+#else
+  free(table);
+#endif
+}
@@ -0,0 +1,12 @@
+#ifndef LDPC_ALLOC_H
+#define LDPC_ALLOC_H
+
+#include <stddef.h>
+
+// Allocation for large lookup tables. On the ESP32 PSRAM is preferred when
+// present, falling back to internal RAM; elsewhere this is plain malloc().
+// Returned memory is 4-byte aligned.
+void *ldpcAllocTable(size_t bytes);
+void ldpcFreeTable(void *table);
+
+#endif
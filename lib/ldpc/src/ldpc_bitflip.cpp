@@ -0,0 +1,259 @@
+#include "ldpc_bitflip.h"
+#include "ldpc_alloc.h"
+
+#include <string.h>
+
+#define BITFLIP_PLANES 6 // Counter bits; column degrees stay below 2^6
+
+static void setBits(uint32_t *stream, uint32_t from, uint32_t count)
+{
+  for (uint32_t i = from; i < from + count; i++)
+    stream[i >> 5] |= 0x80000000UL >> (i & 31);
+}
+
+static uint16_t popcountWords(const uint32_t *words, uint16_t count)
+{
+  uint16_t total = 0;
+  for (uint16_t w = 0; w < count; w++)
+    total += __builtin_popcount(words[w]);
+  return total;
+}
+
+QcBitFlipDecoder::QcBitFlipDecoder()
+    : cols(0), blockWords(0), flipScratch(0), syndrome(0), candidates(0), flippable(0), projected(0), planes(0)
+{
+}
+
+QcBitFlipDecoder::~QcBitFlipDecoder()
+{
+  release();
+}
+
+void QcBitFlipDecoder::release()
+{
+  if (flipScratch != NULL)
+    ldpcFreeTable(flipScratch);
+  flipScratch = NULL;
+  QcSyndromeChecker::release();
+}
+
+bool QcBitFlipDecoder::configure(const QcBaseGraph &graph, uint16_t z, uint16_t k, uint16_t n, uint8_t punctured)
+{
+  release();
+  if (!QcSyndromeChecker::configure(graph, z, k, n, punctured))
+    return false;
+
+  // Column view of the evaluated rows
+  cols = graph.cols;
+  uint16_t count = 0;
+  for (uint8_t c = 0; c < cols; c++)
+  {
+    columnStart[c] = count;
+    for (uint8_t r = 0; r < rows; r++)
+    {
+      for (uint16_t e = rowStart[r]; e < rowStart[r + 1]; e++)
+      {
+        if (entries[e].col == c)
+        {
+          columnEntries[count].row = r;
+          columnEntries[count].shift = entries[e].shift;
+          count++;
+        }
+      }
+    }
+  }
+  columnStart[cols] = count;
+
+  blockWords = LDPC_WORDS(Z) + 1;
+  size_t syndromeWords = LDPC_WORDS((uint32_t)rows * Z) + 1;
+  size_t fullWords = LDPC_WORDS(fullBits) + 1;
+  size_t words = syndromeWords + 2 * fullWords + (1 + BITFLIP_PLANES) * (size_t)blockWords;
+  flipScratch = (uint32_t *)ldpcAllocTable(words * sizeof(uint32_t));
+  if (flipScratch == NULL)
+  {
+    QcSyndromeChecker::release();
+    return false;
+  }
+  memset(flipScratch, 0, words * sizeof(uint32_t));
+
+  syndrome = flipScratch;
+  candidates = syndrome + syndromeWords;
+  flippable = candidates + fullWords;
+  projected = flippable + fullWords;
+  planes = projected + blockWords;
+
+  for (uint8_t c = 0; c < cols; c++)
+  {
+    if (columnStart[c] == columnStart[c + 1])
+      continue;
+    uint32_t start = (uint32_t)c * Z;
+    if (start >= K && start < parityOffset)
+      continue; // Whole column of filler
+    uint32_t end = (start < parityOffset && start + Z > K) ? K : start + Z; // Filler bits stay zero
+    setBits(flippable, start, end - start);
+  }
+  return true;
+}
+
+// Recomputes the syndrome words of every evaluated row; returns the number of failed checks
+uint32_t QcBitFlipDecoder::computeSyndrome() const
+{
+  uint32_t words = LDPC_WORDS((uint32_t)rows * Z);
+  memset(syndrome, 0, words * sizeof(uint32_t));
+
+  for (uint8_t r = 0; r < rows; r++)
+  {
+    for (uint16_t e = rowStart[r]; e < rowStart[r + 1]; e++)
+      ldpcRotateXor(syndrome, (uint32_t)r * Z, fullStream, (uint32_t)entries[e].col * Z, Z, entries[e].shift);
+  }
+  return popcountWords(syndrome, words);
+}
+
+// Failed-check indicator of a column entry, aligned to the column's bits:
+// bit j of column c sits in check (j - shift) mod Z of the entry's row
+void QcBitFlipDecoder::projectSyndrome(uint16_t entry, uint32_t *dst) const
+{
+  const ColumnEntry &column = columnEntries[entry];
+  memset(dst, 0, blockWords * sizeof(uint32_t));
+  ldpcRotateXor(dst, 0, syndrome, (uint32_t)column.row * Z, Z, (Z - column.shift) % Z);
+}
+
+// Flips the bits whose checks all fail, in the columns of the highest degree
+// that has any; returns the number of bits flipped
+uint16_t QcBitFlipDecoder::flipUnanimous() const
+{
+  uint16_t words = LDPC_WORDS(Z);
+  uint32_t *unanimous = planes;
+  uint8_t bestDegree = 0;
+
+  memset(candidates, 0, (LDPC_WORDS(fullBits) + 1) * sizeof(uint32_t));
+  for (uint8_t c = 0; c < cols; c++)
+  {
+    uint8_t degree = columnStart[c + 1] - columnStart[c];
+    if (degree == 0 || degree < bestDegree)
+      continue;
+
+    memset(unanimous, 0, blockWords * sizeof(uint32_t));
+    ldpcXorBits(unanimous, 0, flippable, (uint32_t)c * Z, Z);
+    for (uint16_t e = columnStart[c]; e < columnStart[c + 1]; e++)
+    {
+      projectSyndrome(e, projected);
+      for (uint16_t w = 0; w < words; w++)
+        unanimous[w] &= projected[w];
+    }
+
+    if (popcountWords(unanimous, words) == 0)
+      continue;
+    ldpcXorBits(candidates, (uint32_t)c * Z, unanimous, 0, Z);
+    bestDegree = degree;
+  }
+
+  uint16_t flipped = 0;
+  for (uint8_t c = 0; c < cols && bestDegree > 0; c++)
+  {
+    if (columnStart[c + 1] - columnStart[c] != bestDegree)
+      continue;
+    ldpcXorBits(fullStream, (uint32_t)c * Z, candidates, (uint32_t)c * Z, Z);
+
+    memset(unanimous, 0, blockWords * sizeof(uint32_t));
+    ldpcXorBits(unanimous, 0, candidates, (uint32_t)c * Z, Z);
+    flipped += popcountWords(unanimous, words);
+  }
+  return flipped;
+}
+
+// Gallager-B: flips every bit of degree >= 2 with a majority of failed checks
+uint16_t QcBitFlipDecoder::flipMajority() const
+{
+  uint16_t words = LDPC_WORDS(Z);
+  uint16_t flipped = 0;
+
+  for (uint8_t c = 0; c < cols; c++)
+  {
+    uint8_t degree = columnStart[c + 1] - columnStart[c];
+    if (degree < 2)
+      continue;
+
+    // Ripple-carry add each projected block into the bit-sliced counters
+    memset(planes, 0, BITFLIP_PLANES * blockWords * sizeof(uint32_t));
+    for (uint16_t e = columnStart[c]; e < columnStart[c + 1]; e++)
+    {
+      projectSyndrome(e, projected);
+      for (uint16_t w = 0; w < words; w++)
+      {
+        uint32_t carry = projected[w];
+        for (uint8_t p = 0; p < BITFLIP_PLANES && carry; p++)
+        {
+          uint32_t *plane = planes + p * blockWords;
+          uint32_t next = plane[w] & carry;
+          plane[w] ^= carry;
+          carry = next;
+        }
+      }
+    }
+
+    // count >= threshold, compared plane by plane from the top bit
+    uint8_t threshold = degree / 2 + 1;
+    memset(projected, 0, blockWords * sizeof(uint32_t));
+    ldpcXorBits(projected, 0, flippable, (uint32_t)c * Z, Z);
+    for (uint16_t w = 0; w < words; w++)
+    {
+      uint32_t greater = 0;
+      uint32_t equal = 0xFFFFFFFFUL;
+      for (int8_t p = BITFLIP_PLANES - 1; p >= 0; p--)
+      {
+        uint32_t plane = planes[p * blockWords + w];
+        if (threshold & (1 << p))
+        {
+          equal &= plane;
+        }
+        else
+        {
+          greater |= equal & plane;
+          equal &= ~plane;
+        }
+      }
+      projected[w] &= greater | equal;
+    }
+
+    ldpcXorBits(fullStream, (uint32_t)c * Z, projected, 0, Z);
+    flipped += popcountWords(projected, words);
+  }
+  return flipped;
+}
+
+bool QcBitFlipDecoder::repair(uint8_t *codeword, uint16_t &flippedBits, uint8_t maxIterations) const
+{
+  flippedBits = 0;
+  memset(scratch, 0, scratchWords * sizeof(uint32_t));
+  ldpcLoadStream(codeword, N, codewordStream);
+  ldpcXorBits(fullStream, infoOffset, codewordStream, 0, infoBits);
+  ldpcXorBits(fullStream, parityOffset, codewordStream, infoBits, N - infoBits);
+
+  uint32_t failed = computeSyndrome();
+  for (uint8_t round = 0; failed > 0 && round < maxIterations; round++)
+  {
+    uint16_t flipped = flipUnanimous();
+    if (flipped == 0)
+      flipped = flipMajority();
+    if (flipped == 0)
+      break;
+    failed = computeSyndrome();
+  }
+  if (failed > 0)
+    return false;
+
+  // Write back only the transmitted bits; count what changed
+  memset(codewordStream, 0, (LDPC_WORDS(N) + 1) * sizeof(uint32_t));
+  ldpcXorBits(codewordStream, 0, fullStream, infoOffset, infoBits);
+  ldpcXorBits(codewordStream, infoBits, fullStream, parityOffset, N - infoBits);
+  for (uint16_t i = 0; i < LDPC_BYTES(N); i++)
+  {
+    uint8_t repaired = (uint8_t)(codewordStream[i >> 2] >> (24 - 8 * (i & 3)));
+    if (N % 8 && i == LDPC_BYTES(N) - 1)
+      repaired = (repaired & (uint8_t)(0xFF << (8 - N % 8))) | (codeword[i] & (uint8_t)(0xFF >> (N % 8)));
+    flippedBits += __builtin_popcount(repaired ^ codeword[i]);
+    codeword[i] = repaired;
+  }
+  return true;
+}
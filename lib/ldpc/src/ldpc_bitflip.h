@@ -0,0 +1,62 @@
+#ifndef LDPC_BITFLIP_H
+#define LDPC_BITFLIP_H
+
+#include "ldpc_syndrome.h"
+
+#define LDPC_BITFLIP_ITERATIONS 8 // Default flip rounds before giving up
+
+// Hard-decision bit-flipping repair on packed codewords, for the odd bit
+// error on a link. Each round recomputes the Z-bit syndrome words of every
+// evaluated base row and projects them back onto the columns with inverse
+// rotations:
+//
+//  - bits whose checks all fail are flipped, taking only the columns of the
+//    highest degree among them, so a lone error is fixed in one round without
+//    touching its degree-1 neighbours;
+//  - if no such bit exists, Gallager-B: bits with a majority of failed checks
+//    (bit-sliced counters over the projected words) are flipped.
+//
+// Rounds stop when the syndrome is zero (failed checks are counted with a
+// popcount of the syndrome words), when nothing qualifies for a flip or at
+// the round limit. Only transmitted bits that take part in evaluated checks
+// are ever flipped.
+class QcBitFlipDecoder : public QcSyndromeChecker
+{
+public:
+  QcBitFlipDecoder();
+  ~QcBitFlipDecoder();
+
+  bool configure(const QcBaseGraph &graph, uint16_t Z, uint16_t K, uint16_t N, uint8_t punctured = 0);
+  void release();
+
+  // Repairs the LDPC_BYTES(N) codeword bytes in place. Returns true if the
+  // result satisfies every evaluated check; the codeword is left untouched
+  // otherwise. flippedBits receives the number of bits changed.
+  bool repair(uint8_t *codeword, uint16_t &flippedBits, uint8_t maxIterations = LDPC_BITFLIP_ITERATIONS) const;
+
+private:
+  uint32_t computeSyndrome() const;
+  void projectSyndrome(uint16_t entry, uint32_t *dst) const;
+  uint16_t flipUnanimous() const;
+  uint16_t flipMajority() const;
+
+  struct ColumnEntry
+  {
+    uint8_t row;
+    uint16_t shift;
+  };
+
+  ColumnEntry columnEntries[LDPC_QC_MAX_ENTRIES];
+  uint16_t columnStart[LDPC_QC_MAX_COLS + 1];
+  uint8_t cols;
+  uint16_t blockWords;
+
+  uint32_t *flipScratch;
+  uint32_t *syndrome;   // Z bits per evaluated row, row-major bit stream
+  uint32_t *candidates; // Unanimous bits per column, full-codeword positions
+  uint32_t *flippable;  // Transmitted bits in evaluated checks
+  uint32_t *projected;  // One projected syndrome block
+  uint32_t *planes;     // Bit-sliced failed-check counters, one block per counter bit
+};
+
+#endif
@@ -0,0 +1,102 @@
+#ifndef LDPC_BITSLICE_H
+#define LDPC_BITSLICE_H
+
+#include "ldpc_xor_kernel.h"
+
+// Transposes a W x W bit matrix in place. Row r is a[r] with column 0 in the
+// most significant bit, so afterwards bit (W - 1 - r) of a[c] is the old bit
+// (W - 1 - c) of a[r]. Works for uint32_t (32 x 32) and uint64_t (64 x 64).
+template <typename W>
+void ldpcTransposeBits(W *a)
+{
+  const unsigned width = sizeof(W) * 8;
+  W mask = (W)(~(W)0) >> (width / 2);
+
+  for (unsigned j = width / 2; j != 0; j >>= 1, mask ^= (W)(mask << j))
+  {
+    for (unsigned k = 0; k < width; k = ((k | j) + 1) & ~j)
+    {
+      W t = (a[k] ^ (a[k | j] >> j)) & mask;
+      a[k] ^= t;
+      a[k | j] ^= (W)(t << j);
+    }
+  }
+}
+
+// Encodes up to sizeof(W) * 8 independent blocks per pass with a generated
+// XOR kernel. Each group of W information bits of every block is loaded as
+// one row of a W x W matrix and transposed, so slice i holds code bit i of all
+// blocks (block 0 in the most significant bit). The kernel then runs once for
+// the whole batch and the codeword slices are transposed back into each
+// block's slot. Scratch slices are owned by the encoder, so use one instance
+// per concurrent caller.
+template <uint16_t CodeK, uint16_t CodeN, typename W = uint32_t>
+class BitslicedEncoder : public LdpcEncoder
+{
+public:
+  static const uint8_t LANES = sizeof(W) * 8;
+
+  BitslicedEncoder()
+  {
+    K = CodeK;
+    N = CodeN;
+  }
+
+  uint8_t batchLanes() const { return LANES; }
+
+  void encodeBlock(const uint8_t *info, uint8_t *codeword) const
+  {
+    encodeBatch(&info, &codeword, 1);
+  }
+
+  void encodeBatch(const uint8_t *const *info, uint8_t *const *codeword, uint8_t count) const
+  {
+    W rows[LANES];
+
+    for (uint16_t bit = 0; bit < CodeK; bit += LANES)
+    {
+      for (uint8_t lane = 0; lane < LANES; lane++)
+        rows[lane] = lane < count ? loadWord(info[lane], bit, LDPC_BYTES(CodeK)) : 0;
+      ldpcTransposeBits(rows);
+      for (uint8_t i = 0; i < LANES; i++)
+        slices[bit + i] = rows[i];
+    }
+
+    // Slices K..N-1 may hold the tail of the last information group; the
+    // kernel assigns every parity slice before reading it
+    LdpcXorKernel<CodeK, CodeN>::encode(slices, slices + CodeK);
+    for (uint16_t i = CodeN; i < SLICES; i++)
+      slices[i] = 0;
+
+    for (uint16_t bit = 0; bit < CodeN; bit += LANES)
+    {
+      for (uint8_t i = 0; i < LANES; i++)
+        rows[i] = slices[bit + i];
+      ldpcTransposeBits(rows);
+      for (uint8_t lane = 0; lane < count; lane++)
+        storeWord(codeword[lane], bit, LDPC_BYTES(CodeN), rows[lane]);
+    }
+  }
+
+private:
+  static const uint16_t SLICES = (CodeN + LANES - 1) / LANES * LANES;
+
+  // MSB-first word of `src` starting at byte bit / 8, zero past `bytes`
+  static W loadWord(const uint8_t *src, uint16_t bit, uint16_t bytes)
+  {
+    W word = 0;
+    for (uint16_t i = bit / 8; i < bit / 8 + sizeof(W); i++)
+      word = (W)(word << 8) | (i < bytes ? src[i] : 0);
+    return word;
+  }
+
+  static void storeWord(uint8_t *dst, uint16_t bit, uint16_t bytes, W word)
+  {
+    for (uint16_t i = 0; i < sizeof(W) && bit / 8 + i < bytes; i++)
+      dst[bit / 8 + i] = (uint8_t)(word >> (8 * (sizeof(W) - 1 - i)));
+  }
+
+  mutable W slices[SLICES];
+};
+
+#endif
@@ -0,0 +1,196 @@
+#include "ldpc_code_store.h"
+#include "ldpc_table_encoder.h"
+
+#include <string.h>
+
+#ifdef ESP_PLATFORM
+#include <esp_partition.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static_assert(sizeof(LdpcStoreHeader) == 16, "store header layout");
+static_assert(sizeof(LdpcStoreEntry) == 32, "store index layout");
+
+LdpcCodeStore::LdpcCodeStore()
+    : base(0), header(0), entries(0), graphCount(0), mapping(0), mappedBytes(0)
+{
+}
+
+LdpcCodeStore::~LdpcCodeStore()
+{
+  unmap();
+}
+
+bool LdpcCodeStore::validate(size_t bytes) const
+{
+  const LdpcStoreHeader &h = *(const LdpcStoreHeader *)base;
+  if (bytes < sizeof(LdpcStoreHeader) || h.magic != LDPC_STORE_MAGIC || h.version != LDPC_STORE_VERSION ||
+      h.totalBytes > bytes)
+    return false;
+
+  size_t indexEnd = sizeof(LdpcStoreHeader) + (size_t)h.entryCount * sizeof(LdpcStoreEntry);
+  if (indexEnd > h.totalBytes)
+    return false;
+
+  const LdpcStoreEntry *index = (const LdpcStoreEntry *)(base + sizeof(LdpcStoreHeader));
+  for (uint16_t i = 0; i < h.entryCount; i++)
+  {
+    const LdpcStoreEntry &e = index[i];
+    if (e.offset % LDPC_STORE_ALIGN != 0 || e.offset < indexEnd || e.offset > h.totalBytes ||
+        e.bytes > h.totalBytes - e.offset)
+      return false;
+
+    size_t expected = e.bytes;
+    switch (e.kind)
+    {
+    case LDPC_STORE_QC_GRAPH:
+      if (e.rows > LDPC_QC_MAX_ROWS || e.cols > LDPC_QC_MAX_COLS || e.cols <= e.rows)
+        return false;
+      expected = (size_t)e.rows * e.cols * sizeof(int16_t);
+      break;
+    case LDPC_STORE_GENERATOR_TABLE:
+      if ((e.chunkBits != 4 && e.chunkBits != 8) || e.N <= e.K)
+        return false;
+      expected = TableEncoder::tableBytes(e.K, e.N, e.chunkBits);
+      break;
+    case LDPC_STORE_GENERATOR_ROWS:
+      if (e.N <= e.K)
+        return false;
+      expected = (size_t)e.K * LDPC_WORDS(e.N - e.K) * sizeof(uint32_t);
+      break;
+    default:
+      break; // Kinds from newer tools are skipped
+    }
+    if (e.bytes != expected)
+      return false;
+  }
+  return true;
+}
+
+bool LdpcCodeStore::open(const void *image, size_t bytes)
+{
+  unmap();
+  if (image == NULL)
+    return false;
+
+  base = (const uint8_t *)image;
+  if (!validate(bytes))
+  {
+    base = NULL;
+    return false;
+  }
+  header = (const LdpcStoreHeader *)base;
+  entries = (const LdpcStoreEntry *)(base + sizeof(LdpcStoreHeader));
+  return true;
+}
+
+bool LdpcCodeStore::map(const char *name)
+{
+  unmap();
+
+#ifdef ESP_PLATFORM
+  const esp_partition_t *partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, name);
+  if (partition == NULL)
+    return false;
+
+  const void *image;
+  spi_flash_mmap_handle_t handle;
+  if (esp_partition_mmap(partition, 0, partition->size, SPI_FLASH_MMAP_DATA, &image, &handle) != ESP_OK)
+    return false;
+  size_t bytes = partition->size;
+  if (!open(image, bytes))
+  {
+    spi_flash_munmap(handle);
+    return false;
+  }
+  mapping = (void *)(uintptr_t)handle;
+#else
+  int fd = ::open(name, O_RDONLY);
+  if (fd < 0)
+    return false;
+
+  struct stat info;
+  void *image = MAP_FAILED;
+  if (fstat(fd, &info) == 0 && info.st_size > 0)
+    image = mmap(NULL, info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  close(fd);
+  if (image == MAP_FAILED)
+    return false;
+  size_t bytes = info.st_size;
+  if (!open(image, bytes))
+  {
+    munmap(image, bytes);
+    return false;
+  }
+  mapping = image;
+#endif
+
+  mappedBytes = bytes;
+  return true;
+}
+
+void LdpcCodeStore::unmap()
+{
+  unregisterGraphs();
+  if (mappedBytes != 0)
+  {
+#ifdef ESP_PLATFORM
+    spi_flash_munmap((spi_flash_mmap_handle_t)(uintptr_t)mapping);
+#else
+    munmap(mapping, mappedBytes);
+#endif
+  }
+  mapping = NULL;
+  mappedBytes = 0;
+  base = NULL;
+  header = NULL;
+  entries = NULL;
+}
+
+const LdpcStoreEntry *LdpcCodeStore::findGenerator(uint16_t K, uint16_t N, uint8_t kind) const
+{
+  for (uint16_t i = 0; i < entryCount(); i++)
+  {
+    if (entries[i].kind == kind && entries[i].K == K && entries[i].N == N)
+      return &entries[i];
+  }
+  return NULL;
+}
+
+uint8_t LdpcCodeStore::registerNrGraphs()
+{
+  unregisterGraphs();
+
+  for (uint16_t i = 0; i < entryCount() && graphCount < LDPC_STORE_MAX_GRAPHS; i++)
+  {
+    const LdpcStoreEntry &e = entries[i];
+    if (e.kind != LDPC_STORE_QC_GRAPH || (e.family != QC_FAMILY_NR_BG1 && e.family != QC_FAMILY_NR_BG2))
+      continue;
+
+    char *name = graphNames[graphCount];
+    memcpy(name, e.name, sizeof(e.name));
+    name[sizeof(e.name)] = '\0';
+
+    QcBaseGraph &graph = graphs[graphCount];
+    graph.name = name;
+    graph.rows = e.rows;
+    graph.cols = e.cols;
+    graph.shifts = (const int16_t *)payload(e);
+    graph.lifting = e.lifting;
+    graph.baseZ = e.baseZ;
+    if (qcRegisterNrGraph(e.family, e.liftingSet, &graph))
+      graphEntries[graphCount++] = &e;
+  }
+  return graphCount;
+}
+
+void LdpcCodeStore::unregisterGraphs()
+{
+  for (uint8_t i = 0; i < graphCount; i++)
+    qcRegisterNrGraph(graphEntries[i]->family, graphEntries[i]->liftingSet, NULL);
+  graphCount = 0;
+}
@@ -0,0 +1,109 @@
+#ifndef LDPC_CODE_STORE_H
+#define LDPC_CODE_STORE_H
+
+#include "ldpc_qc_codes.h"
+
+// Code table store: a read-only image of code tables that encoders use in
+// place, straight from memory-mapped flash (the `ldpc_codes` data partition,
+// see partitions.csv) or a mapped file on the native build. Nothing is copied
+// or parsed: opening checks the fixed-size index against the image bounds and
+// each payload's expected size, nothing more. Payloads are 16-byte aligned so
+// uint32 tables and int16 shift arrays can be read directly.
+//
+// Layout (little-endian):
+//
+//   LdpcStoreHeader                       16 bytes
+//   LdpcStoreEntry[entryCount]            32 bytes each
+//   payloads                              each at a 16-byte aligned offset
+//
+// Images are written by `ldpc_host pack-store`.
+#define LDPC_STORE_MAGIC 0x5343444CUL // "LDCS"
+#define LDPC_STORE_VERSION 1
+#define LDPC_STORE_ALIGN 16
+#define LDPC_STORE_PARTITION "ldpc_codes"
+
+enum LdpcStoreKind
+{
+  LDPC_STORE_QC_GRAPH = 1,        // int16 base-graph shifts, rows * cols, -1 for zero blocks
+  LDPC_STORE_GENERATOR_TABLE = 2, // TableEncoder table (chunkBits 4 or 8)
+  LDPC_STORE_GENERATOR_ROWS = 3   // K parity rows of LDPC_WORDS(N - K) words (LdpcRowSource layout)
+};
+
+struct LdpcStoreHeader
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t entryCount;
+  uint32_t totalBytes; // Header, index and payloads
+  uint32_t reserved;
+};
+
+struct LdpcStoreEntry
+{
+  uint8_t kind;       // LdpcStoreKind
+  uint8_t family;     // QcFamily (QC graphs)
+  uint8_t liftingSet; // 5G NR iLS (QC graphs)
+  uint8_t chunkBits;  // Generator tables
+  uint16_t K;         // Generators
+  uint16_t N;
+  uint8_t rows;       // QC graphs
+  uint8_t cols;
+  uint8_t lifting;    // QcLifting
+  uint8_t reserved;
+  uint16_t baseZ;
+  uint16_t reserved2;
+  uint32_t offset;    // Payload, from the start of the image
+  uint32_t bytes;
+  char name[8];       // Short label, not NUL-terminated when 8 characters long
+};
+
+#define LDPC_STORE_MAX_GRAPHS (2 * NR_LIFTING_SETS)
+
+class LdpcCodeStore
+{
+public:
+  LdpcCodeStore();
+  ~LdpcCodeStore();
+
+  // Maps the named data partition (device) or file (native build) and
+  // validates the index. Returns false if it is missing or malformed.
+  bool map(const char *name);
+  void unmap();
+
+  // Uses an image already in memory; the store does not own it
+  bool open(const void *image, size_t bytes);
+
+  bool ready() const { return header != 0; }
+  uint16_t entryCount() const { return header ? header->entryCount : 0; }
+  const LdpcStoreEntry *entry(uint16_t index) const { return entries + index; }
+  const void *payload(const LdpcStoreEntry &entry) const { return base + entry.offset; }
+  size_t imageBytes() const { return header ? header->totalBytes : 0; }
+
+  // Generator table or rows for (K, N), or NULL
+  const LdpcStoreEntry *findGenerator(uint16_t K, uint16_t N, uint8_t kind) const;
+
+  // Registers every 5G NR base graph of the store with qcRegisterNrGraph(),
+  // in place of the built-in table for its lifting set; the shifts stay in the
+  // mapped image. Returns the number registered. unmap() restores the built-in
+  // tables.
+  uint8_t registerNrGraphs();
+
+private:
+  bool validate(size_t bytes) const;
+  void unregisterGraphs();
+
+  const uint8_t *base;
+  const LdpcStoreHeader *header;
+  const LdpcStoreEntry *entries;
+
+  // Descriptors of the registered graphs (the shifts live in the image)
+  QcBaseGraph graphs[LDPC_STORE_MAX_GRAPHS];
+  char graphNames[LDPC_STORE_MAX_GRAPHS][9];
+  const LdpcStoreEntry *graphEntries[LDPC_STORE_MAX_GRAPHS];
+  uint8_t graphCount;
+
+  void *mapping; // Platform handle of map()
+  size_t mappedBytes;
+};
+
+#endif
@@ -0,0 +1,242 @@
+#include "ldpc_decoder.h"
+#include "ldpc_alloc.h"
+
+#include <string.h>
+
+static inline int16_t saturatePosterior(int32_t value)
+{
+  if (value > LDPC_POSTERIOR_MAX)
+    return LDPC_POSTERIOR_MAX;
+  if (value < -LDPC_POSTERIOR_MAX)
+    return -LDPC_POSTERIOR_MAX;
+  return (int16_t)value;
+}
+
+QcLayeredDecoder::QcLayeredDecoder()
+    : K(0), N(0), graph(0), Z(0), infoBits(0), infoOffset(0), parityOffset(0), fullBits(0), usedRows(0),
+      iterations(LDPC_DECODER_ITERATIONS), minSum(LDPC_MINSUM_NORMALIZED), minSumParameter(12), scratch(0),
+      posterior(0), messages(0)
+{
+}
+
+QcLayeredDecoder::~QcLayeredDecoder()
+{
+  release();
+}
+
+void QcLayeredDecoder::release()
+{
+  if (scratch != NULL)
+    ldpcFreeTable(scratch);
+  scratch = NULL;
+  posterior = NULL;
+  messages = NULL;
+  graph = NULL;
+}
+
+size_t QcLayeredDecoder::memoryBytes() const
+{
+  if (!ready())
+    return 0;
+  return rowStart[usedRows] * (sizeof(QcEntry) + Z) + fullBits * sizeof(int16_t);
+}
+
+bool QcLayeredDecoder::configure(const QcBaseGraph &baseGraph, uint16_t z, uint16_t k, uint16_t n, uint8_t punctured)
+{
+  release();
+
+  if (baseGraph.rows > LDPC_QC_MAX_ROWS || baseGraph.cols > LDPC_QC_MAX_COLS || baseGraph.cols <= baseGraph.rows ||
+      z == 0)
+    return false;
+
+  uint8_t infoCols = baseGraph.cols - baseGraph.rows;
+  uint32_t puncturedBits = (uint32_t)punctured * z;
+  if (k <= puncturedBits || k > (uint32_t)infoCols * z || n <= k - puncturedBits || n > LDPC_MAX_N)
+    return false;
+
+  uint32_t parityBits = n - (k - puncturedBits);
+  uint8_t rows = (parityBits + z - 1) / z;
+  if (rows > baseGraph.rows)
+    return false;
+
+  // Rows past the transmitted parity only add checks on unknown bits
+  uint16_t count = 0;
+  for (uint8_t r = 0; r < rows; r++)
+  {
+    rowStart[r] = count;
+    for (uint8_t c = 0; c < infoCols + rows; c++)
+    {
+      int16_t s = baseGraph.shifts[r * baseGraph.cols + c];
+      if (s < 0)
+        continue;
+      if (count == LDPC_QC_MAX_ENTRIES)
+        return false;
+      entries[count].col = c;
+      entries[count].shift = qcLiftShift(baseGraph, s, z);
+      count++;
+    }
+  }
+  rowStart[rows] = count;
+
+  K = k;
+  N = n;
+  Z = z;
+  usedRows = rows;
+  infoBits = k - puncturedBits;
+  infoOffset = puncturedBits;
+  parityOffset = (uint32_t)infoCols * z;
+  fullBits = (uint32_t)(infoCols + rows) * z;
+
+  size_t posteriorBytes = (fullBits * sizeof(int16_t) + 3) & ~(size_t)3;
+  scratch = ldpcAllocTable(posteriorBytes + (size_t)count * z);
+  if (scratch == NULL)
+    return false;
+
+  graph = &baseGraph;
+  posterior = (int16_t *)scratch;
+  messages = (int8_t *)scratch + posteriorBytes;
+  return true;
+}
+
+void QcLayeredDecoder::updateLayer(uint8_t row) const
+{
+  uint16_t first = rowStart[row];
+  uint8_t degree = rowStart[row + 1] - first;
+  uint32_t position[LDPC_QC_MAX_COLS];
+  int16_t q[LDPC_QC_MAX_COLS];
+
+  for (uint16_t i = 0; i < Z; i++)
+  {
+    int16_t min1 = LDPC_LLR_MAX;
+    int16_t min2 = LDPC_LLR_MAX;
+    uint8_t minIndex = 0;
+    uint8_t negative = 0;
+
+    // Variable-to-check messages: posterior minus this check's old message
+    for (uint8_t d = 0; d < degree; d++)
+    {
+      const QcEntry &entry = entries[first + d];
+      uint16_t index = i + entry.shift;
+      if (index >= Z)
+        index -= Z;
+
+      position[d] = (uint32_t)entry.col * Z + index;
+      q[d] = posterior[position[d]] - messages[(size_t)(first + d) * Z + i];
+
+      int16_t magnitude = q[d] < 0 ? -q[d] : q[d];
+      if (magnitude < min1)
+      {
+        min2 = min1;
+        min1 = magnitude;
+        minIndex = d;
+      }
+      else if (magnitude < min2)
+      {
+        min2 = magnitude;
+      }
+      negative ^= (q[d] < 0);
+    }
+
+    if (minSum == LDPC_MINSUM_OFFSET)
+    {
+      min1 = min1 > minSumParameter ? min1 - minSumParameter : 0;
+      min2 = min2 > minSumParameter ? min2 - minSumParameter : 0;
+    }
+    else
+    {
+      min1 = (min1 * minSumParameter) / LDPC_MINSUM_NORMALIZE_ONE;
+      min2 = (min2 * minSumParameter) / LDPC_MINSUM_NORMALIZE_ONE;
+    }
+
+    // Check-to-variable messages and posterior update
+    for (uint8_t d = 0; d < degree; d++)
+    {
+      int16_t magnitude = (d == minIndex) ? min2 : min1;
+      int8_t message = (int8_t)((negative ^ (q[d] < 0)) ? -magnitude : magnitude);
+      messages[(size_t)(first + d) * Z + i] = message;
+      posterior[position[d]] = saturatePosterior((int32_t)q[d] + message);
+    }
+  }
+}
+
+// True if the hard decisions of the posterior satisfy every check and no bit
+// in a check is still undecided
+bool QcLayeredDecoder::satisfied() const
+{
+  for (uint8_t r = 0; r < usedRows; r++)
+  {
+    for (uint16_t i = 0; i < Z; i++)
+    {
+      uint8_t parity = 0;
+      for (uint16_t e = rowStart[r]; e < rowStart[r + 1]; e++)
+      {
+        uint16_t index = i + entries[e].shift;
+        if (index >= Z)
+          index -= Z;
+        int16_t value = posterior[(uint32_t)entries[e].col * Z + index];
+        if (value == 0)
+          return false; // Still an erasure (punctured or truncated bit not yet recovered)
+        parity ^= (value < 0);
+      }
+      if (parity)
+        return false;
+    }
+  }
+  return true;
+}
+
+// Clears the messages and places filler bits; transmitted bits are loaded by the caller
+void QcLayeredDecoder::reset() const
+{
+  memset(posterior, 0, fullBits * sizeof(int16_t));
+  memset(messages, 0, (size_t)rowStart[usedRows] * Z);
+  for (uint32_t i = K; i < parityOffset; i++)
+    posterior[i] = LDPC_POSTERIOR_MAX; // Filler bits are known zeros
+}
+
+// Transmitted bit t lives at this full-codeword position
+uint32_t QcLayeredDecoder::fullPosition(uint16_t t) const
+{
+  return t < infoBits ? infoOffset + t : parityOffset + (t - infoBits);
+}
+
+bool QcLayeredDecoder::decode(const int8_t *llr, uint8_t *info, uint8_t &iterationsUsed) const
+{
+  reset();
+  for (uint16_t t = 0; t < N; t++)
+    posterior[fullPosition(t)] = llr[t];
+  return run(info, iterationsUsed);
+}
+
+bool QcLayeredDecoder::decodeHard(const uint8_t *codeword, uint8_t magnitude, uint8_t *info,
+                                  uint8_t &iterationsUsed) const
+{
+  reset();
+  for (uint16_t t = 0; t < N; t++)
+  {
+    bool one = (codeword[t >> 3] >> (7 - (t & 7))) & 1;
+    posterior[fullPosition(t)] = one ? -(int16_t)magnitude : magnitude;
+  }
+  return run(info, iterationsUsed);
+}
+
+bool QcLayeredDecoder::run(uint8_t *info, uint8_t &iterationsUsed) const
+{
+  bool ok = satisfied();
+  iterationsUsed = 0;
+  while (!ok && iterationsUsed < iterations)
+  {
+    for (uint8_t r = 0; r < usedRows; r++)
+      updateLayer(r);
+    iterationsUsed++;
+    ok = satisfied();
+  }
+
+  memset(info, 0, LDPC_BYTES(K));
+  for (uint16_t i = 0; i < K; i++)
+  {
+    if (posterior[i] < 0)
+      info[i >> 3] |= (uint8_t)(0x80 >> (i & 7));
+  }
+  return ok;
+}
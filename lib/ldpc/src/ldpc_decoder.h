@@ -0,0 +1,85 @@
+#ifndef LDPC_DECODER_H
+#define LDPC_DECODER_H
+
+#include "ldpc_qc.h"
+
+#define LDPC_LLR_MAX 127             // Channel and check messages are int8 in [-127, 127]
+#define LDPC_POSTERIOR_MAX 2047      // Posterior LLR saturation; filler bits sit at this value
+#define LDPC_DECODER_ITERATIONS 20   // Default iteration cap
+#define LDPC_MINSUM_NORMALIZE_ONE 16 // Normalisation factors are in 1/16 units
+
+// Check node update of the min-sum decoder
+enum LdpcMinSum
+{
+  LDPC_MINSUM_NORMALIZED = 0, // |R| = min * factor / 16
+  LDPC_MINSUM_OFFSET = 1      // |R| = max(min - offset, 0)
+};
+
+// Layered min-sum decoder for the codes the QC encoder produces. Each base
+// row is one layer of Z independent checks; the int8 check-to-variable
+// messages of a layer are stored contiguously (entry by entry, Z each) so a
+// layer update walks memory linearly. Posterior LLRs are int16 over the full
+// lifted codeword: punctured and truncated bits start at 0, filler bits as
+// certain zeros. Decoding stops early as soon as the hard decisions satisfy
+// every check. Scratch memory is owned by the decoder, so use one instance
+// per concurrent caller.
+//
+// LLR convention: positive values favour 0.
+class QcLayeredDecoder
+{
+public:
+  QcLayeredDecoder();
+  ~QcLayeredDecoder();
+
+  bool configure(const QcBaseGraph &graph, uint16_t Z, uint16_t K, uint16_t N, uint8_t punctured = 0);
+  void release();
+
+  bool ready() const { return scratch != 0; }
+  const QcBaseGraph *baseGraph() const { return graph; }
+  size_t memoryBytes() const;
+
+  void setIterations(uint8_t maxIterations) { iterations = maxIterations ? maxIterations : 1; }
+  void setMinSum(LdpcMinSum kind, uint8_t parameter)
+  {
+    minSum = kind;
+    minSumParameter = parameter;
+  }
+
+  // Decodes N received LLRs (transmitted bit order) into the K information
+  // bits, packed MSB-first into LDPC_BYTES(K) bytes. Returns true if the
+  // result satisfies every check; iterationsUsed receives the iterations run.
+  bool decode(const int8_t *llr, uint8_t *info, uint8_t &iterationsUsed) const;
+
+  // Same for a hard-decision codeword in the ldpc_encoder.h layout, each bit
+  // entering as an LLR of +-magnitude
+  bool decodeHard(const uint8_t *codeword, uint8_t magnitude, uint8_t *info, uint8_t &iterationsUsed) const;
+
+  uint16_t K;
+  uint16_t N;
+
+private:
+  void reset() const;
+  uint32_t fullPosition(uint16_t t) const;
+  bool run(uint8_t *info, uint8_t &iterationsUsed) const;
+  void updateLayer(uint8_t row) const;
+  bool satisfied() const;
+
+  const QcBaseGraph *graph;
+  QcEntry entries[LDPC_QC_MAX_ENTRIES];
+  uint16_t rowStart[LDPC_QC_MAX_ROWS + 1];
+  uint16_t Z;
+  uint16_t infoBits;     // Transmitted information bits
+  uint32_t infoOffset;   // Full-codeword position of the first transmitted information bit
+  uint32_t parityOffset; // Full-codeword position of the first parity bit
+  uint32_t fullBits;     // Information and used parity columns
+  uint8_t usedRows;
+  uint8_t iterations;
+  uint8_t minSum;
+  uint8_t minSumParameter;
+
+  void *scratch;
+  int16_t *posterior; // fullBits
+  int8_t *messages;   // rowStart[usedRows] * Z, layer by layer
+};
+
+#endif
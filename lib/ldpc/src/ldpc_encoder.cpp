@@ -0,0 +1,85 @@
+#include "ldpc_encoder.h"
+
+#include <string.h>
+
+static const uint8_t zeroBlock[LDPC_BYTES(LDPC_MAX_K)] = {0};
+
+void ldpcEncodeBlocks(const LdpcEncoder &encoder, const uint8_t *message, uint16_t messageBits, uint16_t blocks, uint8_t *out)
+{
+  uint16_t kBytes = LDPC_BYTES(encoder.K);
+  uint16_t nBytes = LDPC_BYTES(encoder.N);
+  uint16_t messageBytes = LDPC_BYTES(messageBits);
+  uint8_t lanes = encoder.batchLanes();
+  uint8_t info[LDPC_BYTES(LDPC_MAX_K)];
+  const uint8_t *batchInfo[LDPC_MAX_LANES];
+  uint8_t *batchCodeword[LDPC_MAX_LANES];
+
+  for (uint16_t first = 0; first < blocks; first += lanes)
+  {
+    uint8_t count = (blocks - first < lanes) ? blocks - first : lanes;
+
+    for (uint8_t i = 0; i < count; i++)
+    {
+      uint32_t start = (uint32_t)(first + i) * kBytes;
+      batchInfo[i] = message + start;
+      batchCodeword[i] = out + (uint32_t)(first + i) * nBytes;
+
+      // Only the block straddling the end of the message needs a zero-padded
+      // copy; blocks entirely past it read as zero
+      if (start >= messageBytes)
+      {
+        batchInfo[i] = zeroBlock;
+      }
+      else if (start + kBytes > messageBytes)
+      {
+        memcpy(info, batchInfo[i], messageBytes - start);
+        memset(info + messageBytes - start, 0, kBytes - (messageBytes - start));
+        batchInfo[i] = info;
+      }
+    }
+
+    encoder.encodeBatch(batchInfo, batchCodeword, count);
+  }
+}
+
+void ldpcCopyBits(uint8_t *dst, uint32_t dstBit, const uint8_t *src, uint32_t nbits)
+{
+  uint8_t shift = dstBit & 7;
+  dst += dstBit >> 3;
+
+  if (shift == 0)
+  {
+    uint32_t whole = nbits >> 3;
+    memcpy(dst, src, whole);
+    uint8_t rest = nbits & 7;
+    if (rest)
+    {
+      uint8_t mask = (uint8_t)(0xFF << (8 - rest));
+      dst[whole] = (dst[whole] & ~mask) | (src[whole] & mask);
+    }
+    return;
+  }
+
+  // Unaligned: each source byte straddles two destination bytes
+  while (nbits > 0)
+  {
+    uint8_t take = (nbits < 8) ? (uint8_t)nbits : 8;
+    uint8_t value = *src++ & (uint8_t)(0xFF << (8 - take));
+    uint16_t mask = (uint16_t)((0xFF << (8 - take)) & 0xFF) << (8 - shift);
+    uint16_t bits = (uint16_t)value << (8 - shift);
+
+    dst[0] = (dst[0] & ~(uint8_t)(mask >> 8)) | (uint8_t)(bits >> 8);
+    if (shift + take > 8)
+      dst[1] = (dst[1] & ~(uint8_t)mask) | (uint8_t)bits;
+
+    dst++;
+    nbits -= take;
+  }
+}
+
+void ldpcPackCodeword(const uint8_t *info, uint16_t K, const uint8_t *parity, uint16_t N, uint8_t *codeword)
+{
+  memset(codeword, 0, LDPC_BYTES(N));
+  ldpcCopyBits(codeword, 0, info, K);
+  ldpcCopyBits(codeword, K, parity, N - K);
+}
@@ -0,0 +1,58 @@
+#ifndef LDPC_ENCODER_H
+#define LDPC_ENCODER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Codeword layout shared by every local encoder and by the MCU link: each block
+// occupies (N + 7) / 8 bytes of encoded_buffer and holds the K information bits
+// followed by the N - K parity bits, packed MSB-first, unused low bits of the
+// last byte zero. Block b of a message is taken from bytes b * (K + 7) / 8
+// onwards, zero-padded past the end of the message (same as sendMessageData()).
+
+#define LDPC_MAX_K 8448  // Largest information length a local encoder accepts (5G NR BG1, Z = 384)
+#define LDPC_MAX_N 16384 // Largest codeword, one full encoded_buffer
+
+#define LDPC_MAX_LANES 64 // Widest batch an encoder may take (64-bit bit-sliced words)
+
+#define LDPC_BYTES(bits) (((bits) + 7) / 8)
+#define LDPC_WORDS(bits) (((bits) + 31) / 32)
+
+// Supplies row `row` of the K x (N - K) parity part of a systematic generator,
+// packed MSB-first into LDPC_BYTES(N - K) bytes
+typedef void (*LdpcRowSource)(void *context, uint16_t row, uint8_t *rowBits);
+
+class LdpcEncoder
+{
+public:
+  LdpcEncoder() : K(0), N(0) {}
+  virtual ~LdpcEncoder() {}
+
+  // Encodes LDPC_BYTES(K) bytes of information into LDPC_BYTES(N) codeword bytes
+  virtual void encodeBlock(const uint8_t *info, uint8_t *codeword) const = 0;
+
+  // Independent blocks the encoder handles per pass; encodeBatch() accepts up
+  // to this many. The default encodes them one by one.
+  virtual uint8_t batchLanes() const { return 1; }
+  virtual void encodeBatch(const uint8_t *const *info, uint8_t *const *codeword, uint8_t count) const
+  {
+    for (uint8_t i = 0; i < count; i++)
+      encodeBlock(info[i], codeword[i]);
+  }
+
+  uint16_t K; // Information bits
+  uint16_t N; // Codeword bits
+};
+
+// Encodes `blocks` consecutive blocks of message into out using the layout
+// above, batchLanes() blocks per pass
+void ldpcEncodeBlocks(const LdpcEncoder &encoder, const uint8_t *message, uint16_t messageBits, uint16_t blocks, uint8_t *out);
+
+// Copies nbits bits from src (starting at its first bit) to dst at bit offset
+// dstBit, MSB-first. Bits of dst outside the destination range are preserved.
+void ldpcCopyBits(uint8_t *dst, uint32_t dstBit, const uint8_t *src, uint32_t nbits);
+
+// Assembles a systematic codeword from K information bits and N - K parity bits
+void ldpcPackCodeword(const uint8_t *info, uint16_t K, const uint8_t *parity, uint16_t N, uint8_t *codeword);
+
+#endif
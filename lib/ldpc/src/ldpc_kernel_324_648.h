@@ -0,0 +1,693 @@
+// Generated by `ldpc_host gen-kernel 80211n_648_r12.qc`; do not edit.
+// K = 324, N = 648, 323 peeled parity bits, 1 symbolic, ~1748 XORs to encode
+#ifndef LDPC_KERNEL_324_648_H
+#define LDPC_KERNEL_324_648_H
+
+#include "ldpc_xor_kernel.h"
+
+template <>
+struct LdpcXorKernel<324, 648>
+{
+  static const bool available = true;
+
+  template <typename W>
+  static void encode(const W *u, W *p)
+  {
+    p[297] = u[3] ^ u[124] ^ u[191] ^ u[241] ^ u[248];
+    p[270] = u[25] ^ u[62] ^ u[131] ^ u[153] ^ u[203] ^ u[225] ^ p[297];
+    p[243] = u[11] ^ u[127] ^ u[229] ^ u[273] ^ u[314] ^ p[270];
+    p[216] = u[7] ^ u[47] ^ u[97] ^ u[130] ^ u[145] ^ u[239] ^ p[243];
+    p[189] = u[13] ^ u[51] ^ u[108] ^ u[170] ^ u[222] ^ p[216];
+    p[27] = u[0] ^ u[108] ^ u[135] ^ u[216] ^ u[297];
+    p[54] = u[22] ^ u[27] ^ u[125] ^ u[162] ^ u[189] ^ u[228] ^ p[27];
+    p[81] = u[6] ^ u[54] ^ u[118] ^ u[240] ^ u[270] ^ p[54];
+    p[108] = u[2] ^ u[81] ^ u[128] ^ u[241] ^ u[243] ^ p[81];
+    p[135] = u[23] ^ u[111] ^ u[216] ^ u[279] ^ u[308] ^ p[108];
+    p[162] = u[24] ^ u[77] ^ u[82] ^ u[125] ^ u[165] ^ u[226] ^ p[135];
+    p[0] = u[25] ^ u[116] ^ u[223] ^ u[261] ^ p[162] ^ p[189];
+    p[323] = u[2] ^ u[123] ^ u[190] ^ u[240] ^ u[247] ^ p[0];
+    p[296] = u[24] ^ u[61] ^ u[130] ^ u[152] ^ u[202] ^ u[224] ^ p[323];
+    p[269] = u[10] ^ u[126] ^ u[228] ^ u[272] ^ u[313] ^ p[296];
+    p[242] = u[6] ^ u[46] ^ u[96] ^ u[129] ^ u[144] ^ u[238] ^ p[269];
+    p[215] = u[12] ^ u[50] ^ u[134] ^ u[169] ^ u[221] ^ p[242];
+    p[53] = u[26] ^ u[134] ^ u[161] ^ u[242] ^ u[323] ^ p[0];
+    p[80] = u[21] ^ u[53] ^ u[124] ^ u[188] ^ u[215] ^ u[227] ^ p[53];
+    p[107] = u[5] ^ u[80] ^ u[117] ^ u[239] ^ u[296] ^ p[80];
+    p[134] = u[1] ^ u[107] ^ u[127] ^ u[240] ^ u[269] ^ p[107];
+    p[161] = u[22] ^ u[110] ^ u[242] ^ u[278] ^ u[307] ^ p[134];
+    p[188] = u[23] ^ u[76] ^ u[81] ^ u[124] ^ u[164] ^ u[225] ^ p[161];
+    p[26] = u[24] ^ u[115] ^ u[222] ^ u[260] ^ p[188] ^ p[215];
+    p[322] = u[1] ^ u[122] ^ u[189] ^ u[239] ^ u[246] ^ p[26];
+    p[295] = u[23] ^ u[60] ^ u[129] ^ u[151] ^ u[201] ^ u[223] ^ p[322];
+    p[268] = u[9] ^ u[125] ^ u[227] ^ u[271] ^ u[312] ^ p[295];
+    p[241] = u[5] ^ u[45] ^ u[95] ^ u[128] ^ u[143] ^ u[237] ^ p[268];
+    p[214] = u[11] ^ u[49] ^ u[133] ^ u[168] ^ u[220] ^ p[241];
+    p[52] = u[25] ^ u[133] ^ u[160] ^ u[241] ^ u[322] ^ p[26];
+    p[79] = u[20] ^ u[52] ^ u[123] ^ u[187] ^ u[214] ^ u[226] ^ p[52];
+    p[106] = u[4] ^ u[79] ^ u[116] ^ u[238] ^ u[295] ^ p[79];
+    p[133] = u[0] ^ u[106] ^ u[126] ^ u[239] ^ u[268] ^ p[106];
+    p[160] = u[21] ^ u[109] ^ u[241] ^ u[277] ^ u[306] ^ p[133];
+    p[187] = u[22] ^ u[75] ^ u[107] ^ u[123] ^ u[163] ^ u[224] ^ p[160];
+    p[25] = u[23] ^ u[114] ^ u[221] ^ u[259] ^ p[187] ^ p[214];
+    p[321] = u[0] ^ u[121] ^ u[215] ^ u[238] ^ u[245] ^ p[25];
+    p[294] = u[22] ^ u[59] ^ u[128] ^ u[150] ^ u[200] ^ u[222] ^ p[321];
+    p[267] = u[8] ^ u[124] ^ u[226] ^ u[270] ^ u[311] ^ p[294];
+    p[240] = u[4] ^ u[44] ^ u[94] ^ u[127] ^ u[142] ^ u[236] ^ p[267];
+    p[213] = u[10] ^ u[48] ^ u[132] ^ u[167] ^ u[219] ^ p[240];
+    p[51] = u[24] ^ u[132] ^ u[159] ^ u[240] ^ u[321] ^ p[25];
+    p[78] = u[19] ^ u[51] ^ u[122] ^ u[186] ^ u[213] ^ u[225] ^ p[51];
+    p[105] = u[3] ^ u[78] ^ u[115] ^ u[237] ^ u[294] ^ p[78];
+    p[132] = u[26] ^ u[105] ^ u[125] ^ u[238] ^ u[267] ^ p[105];
+    p[159] = u[20] ^ u[108] ^ u[240] ^ u[276] ^ u[305] ^ p[132];
+    p[186] = u[21] ^ u[74] ^ u[106] ^ u[122] ^ u[162] ^ u[223] ^ p[159];
+    p[24] = u[22] ^ u[113] ^ u[220] ^ u[258] ^ p[186] ^ p[213];
+    p[320] = u[26] ^ u[120] ^ u[214] ^ u[237] ^ u[244] ^ p[24];
+    p[293] = u[21] ^ u[58] ^ u[127] ^ u[149] ^ u[199] ^ u[221] ^ p[320];
+    p[266] = u[7] ^ u[123] ^ u[225] ^ u[296] ^ u[310] ^ p[293];
+    p[239] = u[3] ^ u[43] ^ u[93] ^ u[126] ^ u[141] ^ u[235] ^ p[266];
+    p[212] = u[9] ^ u[47] ^ u[131] ^ u[166] ^ u[218] ^ p[239];
+    p[50] = u[23] ^ u[131] ^ u[158] ^ u[239] ^ u[320] ^ p[24];
+    p[77] = u[18] ^ u[50] ^ u[121] ^ u[185] ^ u[212] ^ u[224] ^ p[50];
+    p[104] = u[2] ^ u[77] ^ u[114] ^ u[236] ^ u[293] ^ p[77];
+    p[131] = u[25] ^ u[104] ^ u[124] ^ u[237] ^ u[266] ^ p[104];
+    p[158] = u[19] ^ u[134] ^ u[239] ^ u[275] ^ u[304] ^ p[131];
+    p[185] = u[20] ^ u[73] ^ u[105] ^ u[121] ^ u[188] ^ u[222] ^ p[158];
+    p[23] = u[21] ^ u[112] ^ u[219] ^ u[257] ^ p[185] ^ p[212];
+    p[319] = u[25] ^ u[119] ^ u[213] ^ u[236] ^ u[243] ^ p[23];
+    p[292] = u[20] ^ u[57] ^ u[126] ^ u[148] ^ u[198] ^ u[220] ^ p[319];
+    p[265] = u[6] ^ u[122] ^ u[224] ^ u[295] ^ u[309] ^ p[292];
+    p[238] = u[2] ^ u[42] ^ u[92] ^ u[125] ^ u[140] ^ u[234] ^ p[265];
+    p[211] = u[8] ^ u[46] ^ u[130] ^ u[165] ^ u[217] ^ p[238];
+    p[49] = u[22] ^ u[130] ^ u[157] ^ u[238] ^ u[319] ^ p[23];
+    p[76] = u[17] ^ u[49] ^ u[120] ^ u[184] ^ u[211] ^ u[223] ^ p[49];
+    p[103] = u[1] ^ u[76] ^ u[113] ^ u[235] ^ u[292] ^ p[76];
+    p[130] = u[24] ^ u[103] ^ u[123] ^ u[236] ^ u[265] ^ p[103];
+    p[157] = u[18] ^ u[133] ^ u[238] ^ u[274] ^ u[303] ^ p[130];
+    p[184] = u[19] ^ u[72] ^ u[104] ^ u[120] ^ u[187] ^ u[221] ^ p[157];
+    p[22] = u[20] ^ u[111] ^ u[218] ^ u[256] ^ p[184] ^ p[211];
+    p[318] = u[24] ^ u[118] ^ u[212] ^ u[235] ^ u[269] ^ p[22];
+    p[291] = u[19] ^ u[56] ^ u[125] ^ u[147] ^ u[197] ^ u[219] ^ p[318];
+    p[264] = u[5] ^ u[121] ^ u[223] ^ u[294] ^ u[308] ^ p[291];
+    p[237] = u[1] ^ u[41] ^ u[91] ^ u[124] ^ u[139] ^ u[233] ^ p[264];
+    p[210] = u[7] ^ u[45] ^ u[129] ^ u[164] ^ u[216] ^ p[237];
+    p[48] = u[21] ^ u[129] ^ u[156] ^ u[237] ^ u[318] ^ p[22];
+    p[75] = u[16] ^ u[48] ^ u[119] ^ u[183] ^ u[210] ^ u[222] ^ p[48];
+    p[102] = u[0] ^ u[75] ^ u[112] ^ u[234] ^ u[291] ^ p[75];
+    p[129] = u[23] ^ u[102] ^ u[122] ^ u[235] ^ u[264] ^ p[102];
+    p[156] = u[17] ^ u[132] ^ u[237] ^ u[273] ^ u[302] ^ p[129];
+    p[183] = u[18] ^ u[71] ^ u[103] ^ u[119] ^ u[186] ^ u[220] ^ p[156];
+    p[21] = u[19] ^ u[110] ^ u[217] ^ u[255] ^ p[183] ^ p[210];
+    p[317] = u[23] ^ u[117] ^ u[211] ^ u[234] ^ u[268] ^ p[21];
+    p[290] = u[18] ^ u[55] ^ u[124] ^ u[146] ^ u[196] ^ u[218] ^ p[317];
+    p[263] = u[4] ^ u[120] ^ u[222] ^ u[293] ^ u[307] ^ p[290];
+    p[236] = u[0] ^ u[40] ^ u[90] ^ u[123] ^ u[138] ^ u[232] ^ p[263];
+    p[209] = u[6] ^ u[44] ^ u[128] ^ u[163] ^ u[242] ^ p[236];
+    p[47] = u[20] ^ u[128] ^ u[155] ^ u[236] ^ u[317] ^ p[21];
+    p[74] = u[15] ^ u[47] ^ u[118] ^ u[182] ^ u[209] ^ u[221] ^ p[47];
+    p[101] = u[26] ^ u[74] ^ u[111] ^ u[233] ^ u[290] ^ p[74];
+    p[128] = u[22] ^ u[101] ^ u[121] ^ u[234] ^ u[263] ^ p[101];
+    p[155] = u[16] ^ u[131] ^ u[236] ^ u[272] ^ u[301] ^ p[128];
+    p[182] = u[17] ^ u[70] ^ u[102] ^ u[118] ^ u[185] ^ u[219] ^ p[155];
+    p[20] = u[18] ^ u[109] ^ u[216] ^ u[254] ^ p[182] ^ p[209];
+    p[316] = u[22] ^ u[116] ^ u[210] ^ u[233] ^ u[267] ^ p[20];
+    p[289] = u[17] ^ u[54] ^ u[123] ^ u[145] ^ u[195] ^ u[217] ^ p[316];
+    p[262] = u[3] ^ u[119] ^ u[221] ^ u[292] ^ u[306] ^ p[289];
+    p[235] = u[26] ^ u[39] ^ u[89] ^ u[122] ^ u[137] ^ u[231] ^ p[262];
+    p[208] = u[5] ^ u[43] ^ u[127] ^ u[162] ^ u[241] ^ p[235];
+    p[46] = u[19] ^ u[127] ^ u[154] ^ u[235] ^ u[316] ^ p[20];
+    p[73] = u[14] ^ u[46] ^ u[117] ^ u[181] ^ u[208] ^ u[220] ^ p[46];
+    p[100] = u[25] ^ u[73] ^ u[110] ^ u[232] ^ u[289] ^ p[73];
+    p[127] = u[21] ^ u[100] ^ u[120] ^ u[233] ^ u[262] ^ p[100];
+    p[154] = u[15] ^ u[130] ^ u[235] ^ u[271] ^ u[300] ^ p[127];
+    p[181] = u[16] ^ u[69] ^ u[101] ^ u[117] ^ u[184] ^ u[218] ^ p[154];
+    p[19] = u[17] ^ u[108] ^ u[242] ^ u[253] ^ p[181] ^ p[208];
+    p[315] = u[21] ^ u[115] ^ u[209] ^ u[232] ^ u[266] ^ p[19];
+    p[288] = u[16] ^ u[80] ^ u[122] ^ u[144] ^ u[194] ^ u[216] ^ p[315];
+    p[261] = u[2] ^ u[118] ^ u[220] ^ u[291] ^ u[305] ^ p[288];
+    p[234] = u[25] ^ u[38] ^ u[88] ^ u[121] ^ u[136] ^ u[230] ^ p[261];
+    p[207] = u[4] ^ u[42] ^ u[126] ^ u[188] ^ u[240] ^ p[234];
+    p[45] = u[18] ^ u[126] ^ u[153] ^ u[234] ^ u[315] ^ p[19];
+    p[72] = u[13] ^ u[45] ^ u[116] ^ u[180] ^ u[207] ^ u[219] ^ p[45];
+    p[99] = u[24] ^ u[72] ^ u[109] ^ u[231] ^ u[288] ^ p[72];
+    p[126] = u[20] ^ u[99] ^ u[119] ^ u[232] ^ u[261] ^ p[99];
+    p[153] = u[14] ^ u[129] ^ u[234] ^ u[270] ^ u[299] ^ p[126];
+    p[180] = u[15] ^ u[68] ^ u[100] ^ u[116] ^ u[183] ^ u[217] ^ p[153];
+    p[18] = u[16] ^ u[134] ^ u[241] ^ u[252] ^ p[180] ^ p[207];
+    p[314] = u[20] ^ u[114] ^ u[208] ^ u[231] ^ u[265] ^ p[18];
+    p[287] = u[15] ^ u[79] ^ u[121] ^ u[143] ^ u[193] ^ u[242] ^ p[314];
+    p[260] = u[1] ^ u[117] ^ u[219] ^ u[290] ^ u[304] ^ p[287];
+    p[233] = u[24] ^ u[37] ^ u[87] ^ u[120] ^ u[135] ^ u[229] ^ p[260];
+    p[206] = u[3] ^ u[41] ^ u[125] ^ u[187] ^ u[239] ^ p[233];
+    p[44] = u[17] ^ u[125] ^ u[152] ^ u[233] ^ u[314] ^ p[18];
+    p[71] = u[12] ^ u[44] ^ u[115] ^ u[179] ^ u[206] ^ u[218] ^ p[44];
+    p[98] = u[23] ^ u[71] ^ u[108] ^ u[230] ^ u[287] ^ p[71];
+    p[125] = u[19] ^ u[98] ^ u[118] ^ u[231] ^ u[260] ^ p[98];
+    p[152] = u[13] ^ u[128] ^ u[233] ^ u[296] ^ u[298] ^ p[125];
+    p[179] = u[14] ^ u[67] ^ u[99] ^ u[115] ^ u[182] ^ u[216] ^ p[152];
+    p[17] = u[15] ^ u[133] ^ u[240] ^ u[251] ^ p[179] ^ p[206];
+    p[313] = u[19] ^ u[113] ^ u[207] ^ u[230] ^ u[264] ^ p[17];
+    p[286] = u[14] ^ u[78] ^ u[120] ^ u[142] ^ u[192] ^ u[241] ^ p[313];
+    p[259] = u[0] ^ u[116] ^ u[218] ^ u[289] ^ u[303] ^ p[286];
+    p[232] = u[23] ^ u[36] ^ u[86] ^ u[119] ^ u[161] ^ u[228] ^ p[259];
+    p[205] = u[2] ^ u[40] ^ u[124] ^ u[186] ^ u[238] ^ p[232];
+    p[43] = u[16] ^ u[124] ^ u[151] ^ u[232] ^ u[313] ^ p[17];
+    p[70] = u[11] ^ u[43] ^ u[114] ^ u[178] ^ u[205] ^ u[217] ^ p[43];
+    p[97] = u[22] ^ u[70] ^ u[134] ^ u[229] ^ u[286] ^ p[70];
+    p[124] = u[18] ^ u[97] ^ u[117] ^ u[230] ^ u[259] ^ p[97];
+    p[151] = u[12] ^ u[127] ^ u[232] ^ u[295] ^ u[297] ^ p[124];
+    p[178] = u[13] ^ u[66] ^ u[98] ^ u[114] ^ u[181] ^ u[242] ^ p[151];
+    p[16] = u[14] ^ u[132] ^ u[239] ^ u[250] ^ p[178] ^ p[205];
+    p[312] = u[18] ^ u[112] ^ u[206] ^ u[229] ^ u[263] ^ p[16];
+    p[285] = u[13] ^ u[77] ^ u[119] ^ u[141] ^ u[191] ^ u[240] ^ p[312];
+    p[258] = u[26] ^ u[115] ^ u[217] ^ u[288] ^ u[302] ^ p[285];
+    p[231] = u[22] ^ u[35] ^ u[85] ^ u[118] ^ u[160] ^ u[227] ^ p[258];
+    p[204] = u[1] ^ u[39] ^ u[123] ^ u[185] ^ u[237] ^ p[231];
+    p[42] = u[15] ^ u[123] ^ u[150] ^ u[231] ^ u[312] ^ p[16];
+    p[69] = u[10] ^ u[42] ^ u[113] ^ u[177] ^ u[204] ^ u[216] ^ p[42];
+    p[96] = u[21] ^ u[69] ^ u[133] ^ u[228] ^ u[285] ^ p[69];
+    p[123] = u[17] ^ u[96] ^ u[116] ^ u[229] ^ u[258] ^ p[96];
+    p[150] = u[11] ^ u[126] ^ u[231] ^ u[294] ^ u[323] ^ p[123];
+    p[177] = u[12] ^ u[65] ^ u[97] ^ u[113] ^ u[180] ^ u[241] ^ p[150];
+    p[15] = u[13] ^ u[131] ^ u[238] ^ u[249] ^ p[177] ^ p[204];
+    p[311] = u[17] ^ u[111] ^ u[205] ^ u[228] ^ u[262] ^ p[15];
+    p[284] = u[12] ^ u[76] ^ u[118] ^ u[140] ^ u[190] ^ u[239] ^ p[311];
+    p[257] = u[25] ^ u[114] ^ u[216] ^ u[287] ^ u[301] ^ p[284];
+    p[230] = u[21] ^ u[34] ^ u[84] ^ u[117] ^ u[159] ^ u[226] ^ p[257];
+    p[203] = u[0] ^ u[38] ^ u[122] ^ u[184] ^ u[236] ^ p[230];
+    p[41] = u[14] ^ u[122] ^ u[149] ^ u[230] ^ u[311] ^ p[15];
+    p[68] = u[9] ^ u[41] ^ u[112] ^ u[176] ^ u[203] ^ u[242] ^ p[41];
+    p[95] = u[20] ^ u[68] ^ u[132] ^ u[227] ^ u[284] ^ p[68];
+    p[122] = u[16] ^ u[95] ^ u[115] ^ u[228] ^ u[257] ^ p[95];
+    p[149] = u[10] ^ u[125] ^ u[230] ^ u[293] ^ u[322] ^ p[122];
+    p[176] = u[11] ^ u[64] ^ u[96] ^ u[112] ^ u[179] ^ u[240] ^ p[149];
+    p[14] = u[12] ^ u[130] ^ u[237] ^ u[248] ^ p[176] ^ p[203];
+    p[310] = u[16] ^ u[110] ^ u[204] ^ u[227] ^ u[261] ^ p[14];
+    p[283] = u[11] ^ u[75] ^ u[117] ^ u[139] ^ u[189] ^ u[238] ^ p[310];
+    p[256] = u[24] ^ u[113] ^ u[242] ^ u[286] ^ u[300] ^ p[283];
+    p[229] = u[20] ^ u[33] ^ u[83] ^ u[116] ^ u[158] ^ u[225] ^ p[256];
+    p[202] = u[26] ^ u[37] ^ u[121] ^ u[183] ^ u[235] ^ p[229];
+    p[40] = u[13] ^ u[121] ^ u[148] ^ u[229] ^ u[310] ^ p[14];
+    p[67] = u[8] ^ u[40] ^ u[111] ^ u[175] ^ u[202] ^ u[241] ^ p[40];
+    p[94] = u[19] ^ u[67] ^ u[131] ^ u[226] ^ u[283] ^ p[67];
+    p[121] = u[15] ^ u[94] ^ u[114] ^ u[227] ^ u[256] ^ p[94];
+    p[148] = u[9] ^ u[124] ^ u[229] ^ u[292] ^ u[321] ^ p[121];
+    p[175] = u[10] ^ u[63] ^ u[95] ^ u[111] ^ u[178] ^ u[239] ^ p[148];
+    p[13] = u[11] ^ u[129] ^ u[236] ^ u[247] ^ p[175] ^ p[202];
+    p[309] = u[15] ^ u[109] ^ u[203] ^ u[226] ^ u[260] ^ p[13];
+    p[282] = u[10] ^ u[74] ^ u[116] ^ u[138] ^ u[215] ^ u[237] ^ p[309];
+    p[255] = u[23] ^ u[112] ^ u[241] ^ u[285] ^ u[299] ^ p[282];
+    p[228] = u[19] ^ u[32] ^ u[82] ^ u[115] ^ u[157] ^ u[224] ^ p[255];
+    p[201] = u[25] ^ u[36] ^ u[120] ^ u[182] ^ u[234] ^ p[228];
+    p[39] = u[12] ^ u[120] ^ u[147] ^ u[228] ^ u[309] ^ p[13];
+    p[66] = u[7] ^ u[39] ^ u[110] ^ u[174] ^ u[201] ^ u[240] ^ p[39];
+    p[93] = u[18] ^ u[66] ^ u[130] ^ u[225] ^ u[282] ^ p[66];
+    p[120] = u[14] ^ u[93] ^ u[113] ^ u[226] ^ u[255] ^ p[93];
+    p[147] = u[8] ^ u[123] ^ u[228] ^ u[291] ^ u[320] ^ p[120];
+    p[174] = u[9] ^ u[62] ^ u[94] ^ u[110] ^ u[177] ^ u[238] ^ p[147];
+    p[12] = u[10] ^ u[128] ^ u[235] ^ u[246] ^ p[174] ^ p[201];
+    p[308] = u[14] ^ u[108] ^ u[202] ^ u[225] ^ u[259] ^ p[12];
+    p[281] = u[9] ^ u[73] ^ u[115] ^ u[137] ^ u[214] ^ u[236] ^ p[308];
+    p[254] = u[22] ^ u[111] ^ u[240] ^ u[284] ^ u[298] ^ p[281];
+    p[227] = u[18] ^ u[31] ^ u[81] ^ u[114] ^ u[156] ^ u[223] ^ p[254];
+    p[200] = u[24] ^ u[35] ^ u[119] ^ u[181] ^ u[233] ^ p[227];
+    p[38] = u[11] ^ u[119] ^ u[146] ^ u[227] ^ u[308] ^ p[12];
+    p[65] = u[6] ^ u[38] ^ u[109] ^ u[173] ^ u[200] ^ u[239] ^ p[38];
+    p[92] = u[17] ^ u[65] ^ u[129] ^ u[224] ^ u[281] ^ p[65];
+    p[119] = u[13] ^ u[92] ^ u[112] ^ u[225] ^ u[254] ^ p[92];
+    p[146] = u[7] ^ u[122] ^ u[227] ^ u[290] ^ u[319] ^ p[119];
+    p[173] = u[8] ^ u[61] ^ u[93] ^ u[109] ^ u[176] ^ u[237] ^ p[146];
+    p[11] = u[9] ^ u[127] ^ u[234] ^ u[245] ^ p[173] ^ p[200];
+    p[307] = u[13] ^ u[134] ^ u[201] ^ u[224] ^ u[258] ^ p[11];
+    p[280] = u[8] ^ u[72] ^ u[114] ^ u[136] ^ u[213] ^ u[235] ^ p[307];
+    p[253] = u[21] ^ u[110] ^ u[239] ^ u[283] ^ u[297] ^ p[280];
+    p[226] = u[17] ^ u[30] ^ u[107] ^ u[113] ^ u[155] ^ u[222] ^ p[253];
+    p[199] = u[23] ^ u[34] ^ u[118] ^ u[180] ^ u[232] ^ p[226];
+    p[37] = u[10] ^ u[118] ^ u[145] ^ u[226] ^ u[307] ^ p[11];
+    p[64] = u[5] ^ u[37] ^ u[108] ^ u[172] ^ u[199] ^ u[238] ^ p[37];
+    p[91] = u[16] ^ u[64] ^ u[128] ^ u[223] ^ u[280] ^ p[64];
+    p[118] = u[12] ^ u[91] ^ u[111] ^ u[224] ^ u[253] ^ p[91];
+    p[145] = u[6] ^ u[121] ^ u[226] ^ u[289] ^ u[318] ^ p[118];
+    p[172] = u[7] ^ u[60] ^ u[92] ^ u[108] ^ u[175] ^ u[236] ^ p[145];
+    p[10] = u[8] ^ u[126] ^ u[233] ^ u[244] ^ p[172] ^ p[199];
+    p[306] = u[12] ^ u[133] ^ u[200] ^ u[223] ^ u[257] ^ p[10];
+    p[279] = u[7] ^ u[71] ^ u[113] ^ u[135] ^ u[212] ^ u[234] ^ p[306];
+    p[252] = u[20] ^ u[109] ^ u[238] ^ u[282] ^ u[323] ^ p[279];
+    p[225] = u[16] ^ u[29] ^ u[106] ^ u[112] ^ u[154] ^ u[221] ^ p[252];
+    p[198] = u[22] ^ u[33] ^ u[117] ^ u[179] ^ u[231] ^ p[225];
+    p[36] = u[9] ^ u[117] ^ u[144] ^ u[225] ^ u[306] ^ p[10];
+    p[63] = u[4] ^ u[36] ^ u[134] ^ u[171] ^ u[198] ^ u[237] ^ p[36];
+    p[90] = u[15] ^ u[63] ^ u[127] ^ u[222] ^ u[279] ^ p[63];
+    p[117] = u[11] ^ u[90] ^ u[110] ^ u[223] ^ u[252] ^ p[90];
+    p[144] = u[5] ^ u[120] ^ u[225] ^ u[288] ^ u[317] ^ p[117];
+    p[171] = u[6] ^ u[59] ^ u[91] ^ u[134] ^ u[174] ^ u[235] ^ p[144];
+    p[9] = u[7] ^ u[125] ^ u[232] ^ u[243] ^ p[171] ^ p[198];
+    p[305] = u[11] ^ u[132] ^ u[199] ^ u[222] ^ u[256] ^ p[9];
+    p[278] = u[6] ^ u[70] ^ u[112] ^ u[161] ^ u[211] ^ u[233] ^ p[305];
+    p[251] = u[19] ^ u[108] ^ u[237] ^ u[281] ^ u[322] ^ p[278];
+    p[224] = u[15] ^ u[28] ^ u[105] ^ u[111] ^ u[153] ^ u[220] ^ p[251];
+    p[197] = u[21] ^ u[32] ^ u[116] ^ u[178] ^ u[230] ^ p[224];
+    p[35] = u[8] ^ u[116] ^ u[143] ^ u[224] ^ u[305] ^ p[9];
+    p[62] = u[3] ^ u[35] ^ u[133] ^ u[170] ^ u[197] ^ u[236] ^ p[35];
+    p[89] = u[14] ^ u[62] ^ u[126] ^ u[221] ^ u[278] ^ p[62];
+    p[116] = u[10] ^ u[89] ^ u[109] ^ u[222] ^ u[251] ^ p[89];
+    p[143] = u[4] ^ u[119] ^ u[224] ^ u[287] ^ u[316] ^ p[116];
+    p[170] = u[5] ^ u[58] ^ u[90] ^ u[133] ^ u[173] ^ u[234] ^ p[143];
+    p[8] = u[6] ^ u[124] ^ u[231] ^ u[269] ^ p[170] ^ p[197];
+    p[304] = u[10] ^ u[131] ^ u[198] ^ u[221] ^ u[255] ^ p[8];
+    p[277] = u[5] ^ u[69] ^ u[111] ^ u[160] ^ u[210] ^ u[232] ^ p[304];
+    p[250] = u[18] ^ u[134] ^ u[236] ^ u[280] ^ u[321] ^ p[277];
+    p[223] = u[14] ^ u[27] ^ u[104] ^ u[110] ^ u[152] ^ u[219] ^ p[250];
+    p[196] = u[20] ^ u[31] ^ u[115] ^ u[177] ^ u[229] ^ p[223];
+    p[34] = u[7] ^ u[115] ^ u[142] ^ u[223] ^ u[304] ^ p[8];
+    p[61] = u[2] ^ u[34] ^ u[132] ^ u[169] ^ u[196] ^ u[235] ^ p[34];
+    p[88] = u[13] ^ u[61] ^ u[125] ^ u[220] ^ u[277] ^ p[61];
+    p[115] = u[9] ^ u[88] ^ u[108] ^ u[221] ^ u[250] ^ p[88];
+    p[142] = u[3] ^ u[118] ^ u[223] ^ u[286] ^ u[315] ^ p[115];
+    p[169] = u[4] ^ u[57] ^ u[89] ^ u[132] ^ u[172] ^ u[233] ^ p[142];
+    p[7] = u[5] ^ u[123] ^ u[230] ^ u[268] ^ p[169] ^ p[196];
+    p[303] = u[9] ^ u[130] ^ u[197] ^ u[220] ^ u[254] ^ p[7];
+    p[276] = u[4] ^ u[68] ^ u[110] ^ u[159] ^ u[209] ^ u[231] ^ p[303];
+    p[249] = u[17] ^ u[133] ^ u[235] ^ u[279] ^ u[320] ^ p[276];
+    p[222] = u[13] ^ u[53] ^ u[103] ^ u[109] ^ u[151] ^ u[218] ^ p[249];
+    p[195] = u[19] ^ u[30] ^ u[114] ^ u[176] ^ u[228] ^ p[222];
+    p[33] = u[6] ^ u[114] ^ u[141] ^ u[222] ^ u[303] ^ p[7];
+    p[60] = u[1] ^ u[33] ^ u[131] ^ u[168] ^ u[195] ^ u[234] ^ p[33];
+    p[87] = u[12] ^ u[60] ^ u[124] ^ u[219] ^ u[276] ^ p[60];
+    p[114] = u[8] ^ u[87] ^ u[134] ^ u[220] ^ u[249] ^ p[87];
+    p[141] = u[2] ^ u[117] ^ u[222] ^ u[285] ^ u[314] ^ p[114];
+    p[168] = u[3] ^ u[56] ^ u[88] ^ u[131] ^ u[171] ^ u[232] ^ p[141];
+    p[6] = u[4] ^ u[122] ^ u[229] ^ u[267] ^ p[168] ^ p[195];
+    p[302] = u[8] ^ u[129] ^ u[196] ^ u[219] ^ u[253] ^ p[6];
+    p[275] = u[3] ^ u[67] ^ u[109] ^ u[158] ^ u[208] ^ u[230] ^ p[302];
+    p[248] = u[16] ^ u[132] ^ u[234] ^ u[278] ^ u[319] ^ p[275];
+    p[221] = u[12] ^ u[52] ^ u[102] ^ u[108] ^ u[150] ^ u[217] ^ p[248];
+    p[194] = u[18] ^ u[29] ^ u[113] ^ u[175] ^ u[227] ^ p[221];
+    p[32] = u[5] ^ u[113] ^ u[140] ^ u[221] ^ u[302] ^ p[6];
+    p[59] = u[0] ^ u[32] ^ u[130] ^ u[167] ^ u[194] ^ u[233] ^ p[32];
+    p[86] = u[11] ^ u[59] ^ u[123] ^ u[218] ^ u[275] ^ p[59];
+    p[113] = u[7] ^ u[86] ^ u[133] ^ u[219] ^ u[248] ^ p[86];
+    p[140] = u[1] ^ u[116] ^ u[221] ^ u[284] ^ u[313] ^ p[113];
+    p[167] = u[2] ^ u[55] ^ u[87] ^ u[130] ^ u[170] ^ u[231] ^ p[140];
+    p[5] = u[3] ^ u[121] ^ u[228] ^ u[266] ^ p[167] ^ p[194];
+    p[301] = u[7] ^ u[128] ^ u[195] ^ u[218] ^ u[252] ^ p[5];
+    p[274] = u[2] ^ u[66] ^ u[108] ^ u[157] ^ u[207] ^ u[229] ^ p[301];
+    p[247] = u[15] ^ u[131] ^ u[233] ^ u[277] ^ u[318] ^ p[274];
+    p[220] = u[11] ^ u[51] ^ u[101] ^ u[134] ^ u[149] ^ u[216] ^ p[247];
+    p[193] = u[17] ^ u[28] ^ u[112] ^ u[174] ^ u[226] ^ p[220];
+    p[31] = u[4] ^ u[112] ^ u[139] ^ u[220] ^ u[301] ^ p[5];
+    p[58] = u[26] ^ u[31] ^ u[129] ^ u[166] ^ u[193] ^ u[232] ^ p[31];
+    p[85] = u[10] ^ u[58] ^ u[122] ^ u[217] ^ u[274] ^ p[58];
+    p[112] = u[6] ^ u[85] ^ u[132] ^ u[218] ^ u[247] ^ p[85];
+    p[139] = u[0] ^ u[115] ^ u[220] ^ u[283] ^ u[312] ^ p[112];
+    p[166] = u[1] ^ u[54] ^ u[86] ^ u[129] ^ u[169] ^ u[230] ^ p[139];
+    p[4] = u[2] ^ u[120] ^ u[227] ^ u[265] ^ p[166] ^ p[193];
+    p[300] = u[6] ^ u[127] ^ u[194] ^ u[217] ^ u[251] ^ p[4];
+    p[273] = u[1] ^ u[65] ^ u[134] ^ u[156] ^ u[206] ^ u[228] ^ p[300];
+    p[246] = u[14] ^ u[130] ^ u[232] ^ u[276] ^ u[317] ^ p[273];
+    p[219] = u[10] ^ u[50] ^ u[100] ^ u[133] ^ u[148] ^ u[242] ^ p[246];
+    p[192] = u[16] ^ u[27] ^ u[111] ^ u[173] ^ u[225] ^ p[219];
+    p[30] = u[3] ^ u[111] ^ u[138] ^ u[219] ^ u[300] ^ p[4];
+    p[57] = u[25] ^ u[30] ^ u[128] ^ u[165] ^ u[192] ^ u[231] ^ p[30];
+    p[84] = u[9] ^ u[57] ^ u[121] ^ u[216] ^ u[273] ^ p[57];
+    p[111] = u[5] ^ u[84] ^ u[131] ^ u[217] ^ u[246] ^ p[84];
+    p[138] = u[26] ^ u[114] ^ u[219] ^ u[282] ^ u[311] ^ p[111];
+    p[165] = u[0] ^ u[80] ^ u[85] ^ u[128] ^ u[168] ^ u[229] ^ p[138];
+    p[3] = u[1] ^ u[119] ^ u[226] ^ u[264] ^ p[165] ^ p[192];
+    p[299] = u[5] ^ u[126] ^ u[193] ^ u[216] ^ u[250] ^ p[3];
+    p[272] = u[0] ^ u[64] ^ u[133] ^ u[155] ^ u[205] ^ u[227] ^ p[299];
+    p[245] = u[13] ^ u[129] ^ u[231] ^ u[275] ^ u[316] ^ p[272];
+    p[218] = u[9] ^ u[49] ^ u[99] ^ u[132] ^ u[147] ^ u[241] ^ p[245];
+    p[191] = u[15] ^ u[53] ^ u[110] ^ u[172] ^ u[224] ^ p[218];
+    p[29] = u[2] ^ u[110] ^ u[137] ^ u[218] ^ u[299] ^ p[3];
+    p[56] = u[24] ^ u[29] ^ u[127] ^ u[164] ^ u[191] ^ u[230] ^ p[29];
+    p[83] = u[8] ^ u[56] ^ u[120] ^ u[242] ^ u[272] ^ p[56];
+    p[110] = u[4] ^ u[83] ^ u[130] ^ u[216] ^ u[245] ^ p[83];
+    p[137] = u[25] ^ u[113] ^ u[218] ^ u[281] ^ u[310] ^ p[110];
+    p[164] = u[26] ^ u[79] ^ u[84] ^ u[127] ^ u[167] ^ u[228] ^ p[137];
+    p[2] = u[0] ^ u[118] ^ u[225] ^ u[263] ^ p[164] ^ p[191];
+    p[298] = u[4] ^ u[125] ^ u[192] ^ u[242] ^ u[249] ^ p[2];
+    p[271] = u[26] ^ u[63] ^ u[132] ^ u[154] ^ u[204] ^ u[226] ^ p[298];
+    p[244] = u[12] ^ u[128] ^ u[230] ^ u[274] ^ u[315] ^ p[271];
+    p[217] = u[8] ^ u[48] ^ u[98] ^ u[131] ^ u[146] ^ u[240] ^ p[244];
+    p[190] = u[14] ^ u[52] ^ u[109] ^ u[171] ^ u[223] ^ p[217];
+    p[163] = u[26] ^ u[117] ^ u[224] ^ u[262] ^ p[190];
+    p[136] = u[25] ^ u[78] ^ u[83] ^ u[126] ^ u[166] ^ u[227] ^ p[163];
+    p[109] = u[24] ^ u[112] ^ u[217] ^ u[280] ^ u[309] ^ p[136];
+    p[82] = u[3] ^ u[82] ^ u[129] ^ u[242] ^ u[244] ^ p[109];
+    p[55] = u[7] ^ u[55] ^ u[119] ^ u[241] ^ u[271] ^ p[82];
+    p[28] = u[23] ^ u[28] ^ u[126] ^ u[163] ^ u[190] ^ u[229] ^ p[55];
+    const W r0 = u[1] ^ u[109] ^ u[136] ^ u[217] ^ u[298] ^ p[2] ^ p[28];
+    const W g0 = r0;
+    p[1] = g0;
+    p[27] ^= g0;
+    p[28] ^= g0;
+    p[54] ^= g0;
+    p[55] ^= g0;
+    p[81] ^= g0;
+    p[82] ^= g0;
+    p[108] ^= g0;
+    p[109] ^= g0;
+    p[135] ^= g0;
+    p[136] ^= g0;
+    p[162] ^= g0;
+    p[163] ^= g0;
+    p[189] ^= g0;
+    p[216] ^= g0;
+    p[243] ^= g0;
+    p[270] ^= g0;
+    p[297] ^= g0;
+  }
+
+  template <typename W>
+  static W syndrome(const W *c)
+  {
+    W s = 0;
+    s |= c[0] ^ c[108] ^ c[135] ^ c[216] ^ c[297] ^ c[325] ^ c[351];
+    s |= c[1] ^ c[109] ^ c[136] ^ c[217] ^ c[298] ^ c[326] ^ c[352];
+    s |= c[2] ^ c[110] ^ c[137] ^ c[218] ^ c[299] ^ c[327] ^ c[353];
+    s |= c[3] ^ c[111] ^ c[138] ^ c[219] ^ c[300] ^ c[328] ^ c[354];
+    s |= c[4] ^ c[112] ^ c[139] ^ c[220] ^ c[301] ^ c[329] ^ c[355];
+    s |= c[5] ^ c[113] ^ c[140] ^ c[221] ^ c[302] ^ c[330] ^ c[356];
+    s |= c[6] ^ c[114] ^ c[141] ^ c[222] ^ c[303] ^ c[331] ^ c[357];
+    s |= c[7] ^ c[115] ^ c[142] ^ c[223] ^ c[304] ^ c[332] ^ c[358];
+    s |= c[8] ^ c[116] ^ c[143] ^ c[224] ^ c[305] ^ c[333] ^ c[359];
+    s |= c[9] ^ c[117] ^ c[144] ^ c[225] ^ c[306] ^ c[334] ^ c[360];
+    s |= c[10] ^ c[118] ^ c[145] ^ c[226] ^ c[307] ^ c[335] ^ c[361];
+    s |= c[11] ^ c[119] ^ c[146] ^ c[227] ^ c[308] ^ c[336] ^ c[362];
+    s |= c[12] ^ c[120] ^ c[147] ^ c[228] ^ c[309] ^ c[337] ^ c[363];
+    s |= c[13] ^ c[121] ^ c[148] ^ c[229] ^ c[310] ^ c[338] ^ c[364];
+    s |= c[14] ^ c[122] ^ c[149] ^ c[230] ^ c[311] ^ c[339] ^ c[365];
+    s |= c[15] ^ c[123] ^ c[150] ^ c[231] ^ c[312] ^ c[340] ^ c[366];
+    s |= c[16] ^ c[124] ^ c[151] ^ c[232] ^ c[313] ^ c[341] ^ c[367];
+    s |= c[17] ^ c[125] ^ c[152] ^ c[233] ^ c[314] ^ c[342] ^ c[368];
+    s |= c[18] ^ c[126] ^ c[153] ^ c[234] ^ c[315] ^ c[343] ^ c[369];
+    s |= c[19] ^ c[127] ^ c[154] ^ c[235] ^ c[316] ^ c[344] ^ c[370];
+    s |= c[20] ^ c[128] ^ c[155] ^ c[236] ^ c[317] ^ c[345] ^ c[371];
+    s |= c[21] ^ c[129] ^ c[156] ^ c[237] ^ c[318] ^ c[346] ^ c[372];
+    s |= c[22] ^ c[130] ^ c[157] ^ c[238] ^ c[319] ^ c[347] ^ c[373];
+    s |= c[23] ^ c[131] ^ c[158] ^ c[239] ^ c[320] ^ c[348] ^ c[374];
+    s |= c[24] ^ c[132] ^ c[159] ^ c[240] ^ c[321] ^ c[349] ^ c[375];
+    s |= c[25] ^ c[133] ^ c[160] ^ c[241] ^ c[322] ^ c[350] ^ c[376];
+    s |= c[26] ^ c[134] ^ c[161] ^ c[242] ^ c[323] ^ c[324] ^ c[377];
+    s |= c[22] ^ c[27] ^ c[125] ^ c[162] ^ c[189] ^ c[228] ^ c[351] ^ c[378];
+    s |= c[23] ^ c[28] ^ c[126] ^ c[163] ^ c[190] ^ c[229] ^ c[352] ^ c[379];
+    s |= c[24] ^ c[29] ^ c[127] ^ c[164] ^ c[191] ^ c[230] ^ c[353] ^ c[380];
+    s |= c[25] ^ c[30] ^ c[128] ^ c[165] ^ c[192] ^ c[231] ^ c[354] ^ c[381];
+    s |= c[26] ^ c[31] ^ c[129] ^ c[166] ^ c[193] ^ c[232] ^ c[355] ^ c[382];
+    s |= c[0] ^ c[32] ^ c[130] ^ c[167] ^ c[194] ^ c[233] ^ c[356] ^ c[383];
+    s |= c[1] ^ c[33] ^ c[131] ^ c[168] ^ c[195] ^ c[234] ^ c[357] ^ c[384];
+    s |= c[2] ^ c[34] ^ c[132] ^ c[169] ^ c[196] ^ c[235] ^ c[358] ^ c[385];
+    s |= c[3] ^ c[35] ^ c[133] ^ c[170] ^ c[197] ^ c[236] ^ c[359] ^ c[386];
+    s |= c[4] ^ c[36] ^ c[134] ^ c[171] ^ c[198] ^ c[237] ^ c[360] ^ c[387];
+    s |= c[5] ^ c[37] ^ c[108] ^ c[172] ^ c[199] ^ c[238] ^ c[361] ^ c[388];
+    s |= c[6] ^ c[38] ^ c[109] ^ c[173] ^ c[200] ^ c[239] ^ c[362] ^ c[389];
+    s |= c[7] ^ c[39] ^ c[110] ^ c[174] ^ c[201] ^ c[240] ^ c[363] ^ c[390];
+    s |= c[8] ^ c[40] ^ c[111] ^ c[175] ^ c[202] ^ c[241] ^ c[364] ^ c[391];
+    s |= c[9] ^ c[41] ^ c[112] ^ c[176] ^ c[203] ^ c[242] ^ c[365] ^ c[392];
+    s |= c[10] ^ c[42] ^ c[113] ^ c[177] ^ c[204] ^ c[216] ^ c[366] ^ c[393];
+    s |= c[11] ^ c[43] ^ c[114] ^ c[178] ^ c[205] ^ c[217] ^ c[367] ^ c[394];
+    s |= c[12] ^ c[44] ^ c[115] ^ c[179] ^ c[206] ^ c[218] ^ c[368] ^ c[395];
+    s |= c[13] ^ c[45] ^ c[116] ^ c[180] ^ c[207] ^ c[219] ^ c[369] ^ c[396];
+    s |= c[14] ^ c[46] ^ c[117] ^ c[181] ^ c[208] ^ c[220] ^ c[370] ^ c[397];
+    s |= c[15] ^ c[47] ^ c[118] ^ c[182] ^ c[209] ^ c[221] ^ c[371] ^ c[398];
+    s |= c[16] ^ c[48] ^ c[119] ^ c[183] ^ c[210] ^ c[222] ^ c[372] ^ c[399];
+    s |= c[17] ^ c[49] ^ c[120] ^ c[184] ^ c[211] ^ c[223] ^ c[373] ^ c[400];
+    s |= c[18] ^ c[50] ^ c[121] ^ c[185] ^ c[212] ^ c[224] ^ c[374] ^ c[401];
+    s |= c[19] ^ c[51] ^ c[122] ^ c[186] ^ c[213] ^ c[225] ^ c[375] ^ c[402];
+    s |= c[20] ^ c[52] ^ c[123] ^ c[187] ^ c[214] ^ c[226] ^ c[376] ^ c[403];
+    s |= c[21] ^ c[53] ^ c[124] ^ c[188] ^ c[215] ^ c[227] ^ c[377] ^ c[404];
+    s |= c[6] ^ c[54] ^ c[118] ^ c[240] ^ c[270] ^ c[378] ^ c[405];
+    s |= c[7] ^ c[55] ^ c[119] ^ c[241] ^ c[271] ^ c[379] ^ c[406];
+    s |= c[8] ^ c[56] ^ c[120] ^ c[242] ^ c[272] ^ c[380] ^ c[407];
+    s |= c[9] ^ c[57] ^ c[121] ^ c[216] ^ c[273] ^ c[381] ^ c[408];
+    s |= c[10] ^ c[58] ^ c[122] ^ c[217] ^ c[274] ^ c[382] ^ c[409];
+    s |= c[11] ^ c[59] ^ c[123] ^ c[218] ^ c[275] ^ c[383] ^ c[410];
+    s |= c[12] ^ c[60] ^ c[124] ^ c[219] ^ c[276] ^ c[384] ^ c[411];
+    s |= c[13] ^ c[61] ^ c[125] ^ c[220] ^ c[277] ^ c[385] ^ c[412];
+    s |= c[14] ^ c[62] ^ c[126] ^ c[221] ^ c[278] ^ c[386] ^ c[413];
+    s |= c[15] ^ c[63] ^ c[127] ^ c[222] ^ c[279] ^ c[387] ^ c[414];
+    s |= c[16] ^ c[64] ^ c[128] ^ c[223] ^ c[280] ^ c[388] ^ c[415];
+    s |= c[17] ^ c[65] ^ c[129] ^ c[224] ^ c[281] ^ c[389] ^ c[416];
+    s |= c[18] ^ c[66] ^ c[130] ^ c[225] ^ c[282] ^ c[390] ^ c[417];
+    s |= c[19] ^ c[67] ^ c[131] ^ c[226] ^ c[283] ^ c[391] ^ c[418];
+    s |= c[20] ^ c[68] ^ c[132] ^ c[227] ^ c[284] ^ c[392] ^ c[419];
+    s |= c[21] ^ c[69] ^ c[133] ^ c[228] ^ c[285] ^ c[393] ^ c[420];
+    s |= c[22] ^ c[70] ^ c[134] ^ c[229] ^ c[286] ^ c[394] ^ c[421];
+    s |= c[23] ^ c[71] ^ c[108] ^ c[230] ^ c[287] ^ c[395] ^ c[422];
+    s |= c[24] ^ c[72] ^ c[109] ^ c[231] ^ c[288] ^ c[396] ^ c[423];
+    s |= c[25] ^ c[73] ^ c[110] ^ c[232] ^ c[289] ^ c[397] ^ c[424];
+    s |= c[26] ^ c[74] ^ c[111] ^ c[233] ^ c[290] ^ c[398] ^ c[425];
+    s |= c[0] ^ c[75] ^ c[112] ^ c[234] ^ c[291] ^ c[399] ^ c[426];
+    s |= c[1] ^ c[76] ^ c[113] ^ c[235] ^ c[292] ^ c[400] ^ c[427];
+    s |= c[2] ^ c[77] ^ c[114] ^ c[236] ^ c[293] ^ c[401] ^ c[428];
+    s |= c[3] ^ c[78] ^ c[115] ^ c[237] ^ c[294] ^ c[402] ^ c[429];
+    s |= c[4] ^ c[79] ^ c[116] ^ c[238] ^ c[295] ^ c[403] ^ c[430];
+    s |= c[5] ^ c[80] ^ c[117] ^ c[239] ^ c[296] ^ c[404] ^ c[431];
+    s |= c[2] ^ c[81] ^ c[128] ^ c[241] ^ c[243] ^ c[405] ^ c[432];
+    s |= c[3] ^ c[82] ^ c[129] ^ c[242] ^ c[244] ^ c[406] ^ c[433];
+    s |= c[4] ^ c[83] ^ c[130] ^ c[216] ^ c[245] ^ c[407] ^ c[434];
+    s |= c[5] ^ c[84] ^ c[131] ^ c[217] ^ c[246] ^ c[408] ^ c[435];
+    s |= c[6] ^ c[85] ^ c[132] ^ c[218] ^ c[247] ^ c[409] ^ c[436];
+    s |= c[7] ^ c[86] ^ c[133] ^ c[219] ^ c[248] ^ c[410] ^ c[437];
+    s |= c[8] ^ c[87] ^ c[134] ^ c[220] ^ c[249] ^ c[411] ^ c[438];
+    s |= c[9] ^ c[88] ^ c[108] ^ c[221] ^ c[250] ^ c[412] ^ c[439];
+    s |= c[10] ^ c[89] ^ c[109] ^ c[222] ^ c[251] ^ c[413] ^ c[440];
+    s |= c[11] ^ c[90] ^ c[110] ^ c[223] ^ c[252] ^ c[414] ^ c[441];
+    s |= c[12] ^ c[91] ^ c[111] ^ c[224] ^ c[253] ^ c[415] ^ c[442];
+    s |= c[13] ^ c[92] ^ c[112] ^ c[225] ^ c[254] ^ c[416] ^ c[443];
+    s |= c[14] ^ c[93] ^ c[113] ^ c[226] ^ c[255] ^ c[417] ^ c[444];
+    s |= c[15] ^ c[94] ^ c[114] ^ c[227] ^ c[256] ^ c[418] ^ c[445];
+    s |= c[16] ^ c[95] ^ c[115] ^ c[228] ^ c[257] ^ c[419] ^ c[446];
+    s |= c[17] ^ c[96] ^ c[116] ^ c[229] ^ c[258] ^ c[420] ^ c[447];
+    s |= c[18] ^ c[97] ^ c[117] ^ c[230] ^ c[259] ^ c[421] ^ c[448];
+    s |= c[19] ^ c[98] ^ c[118] ^ c[231] ^ c[260] ^ c[422] ^ c[449];
+    s |= c[20] ^ c[99] ^ c[119] ^ c[232] ^ c[261] ^ c[423] ^ c[450];
+    s |= c[21] ^ c[100] ^ c[120] ^ c[233] ^ c[262] ^ c[424] ^ c[451];
+    s |= c[22] ^ c[101] ^ c[121] ^ c[234] ^ c[263] ^ c[425] ^ c[452];
+    s |= c[23] ^ c[102] ^ c[122] ^ c[235] ^ c[264] ^ c[426] ^ c[453];
+    s |= c[24] ^ c[103] ^ c[123] ^ c[236] ^ c[265] ^ c[427] ^ c[454];
+    s |= c[25] ^ c[104] ^ c[124] ^ c[237] ^ c[266] ^ c[428] ^ c[455];
+    s |= c[26] ^ c[105] ^ c[125] ^ c[238] ^ c[267] ^ c[429] ^ c[456];
+    s |= c[0] ^ c[106] ^ c[126] ^ c[239] ^ c[268] ^ c[430] ^ c[457];
+    s |= c[1] ^ c[107] ^ c[127] ^ c[240] ^ c[269] ^ c[431] ^ c[458];
+    s |= c[23] ^ c[111] ^ c[216] ^ c[279] ^ c[308] ^ c[432] ^ c[459];
+    s |= c[24] ^ c[112] ^ c[217] ^ c[280] ^ c[309] ^ c[433] ^ c[460];
+    s |= c[25] ^ c[113] ^ c[218] ^ c[281] ^ c[310] ^ c[434] ^ c[461];
+    s |= c[26] ^ c[114] ^ c[219] ^ c[282] ^ c[311] ^ c[435] ^ c[462];
+    s |= c[0] ^ c[115] ^ c[220] ^ c[283] ^ c[312] ^ c[436] ^ c[463];
+    s |= c[1] ^ c[116] ^ c[221] ^ c[284] ^ c[313] ^ c[437] ^ c[464];
+    s |= c[2] ^ c[117] ^ c[222] ^ c[285] ^ c[314] ^ c[438] ^ c[465];
+    s |= c[3] ^ c[118] ^ c[223] ^ c[286] ^ c[315] ^ c[439] ^ c[466];
+    s |= c[4] ^ c[119] ^ c[224] ^ c[287] ^ c[316] ^ c[440] ^ c[467];
+    s |= c[5] ^ c[120] ^ c[225] ^ c[288] ^ c[317] ^ c[441] ^ c[468];
+    s |= c[6] ^ c[121] ^ c[226] ^ c[289] ^ c[318] ^ c[442] ^ c[469];
+    s |= c[7] ^ c[122] ^ c[227] ^ c[290] ^ c[319] ^ c[443] ^ c[470];
+    s |= c[8] ^ c[123] ^ c[228] ^ c[291] ^ c[320] ^ c[444] ^ c[471];
+    s |= c[9] ^ c[124] ^ c[229] ^ c[292] ^ c[321] ^ c[445] ^ c[472];
+    s |= c[10] ^ c[125] ^ c[230] ^ c[293] ^ c[322] ^ c[446] ^ c[473];
+    s |= c[11] ^ c[126] ^ c[231] ^ c[294] ^ c[323] ^ c[447] ^ c[474];
+    s |= c[12] ^ c[127] ^ c[232] ^ c[295] ^ c[297] ^ c[448] ^ c[475];
+    s |= c[13] ^ c[128] ^ c[233] ^ c[296] ^ c[298] ^ c[449] ^ c[476];
+    s |= c[14] ^ c[129] ^ c[234] ^ c[270] ^ c[299] ^ c[450] ^ c[477];
+    s |= c[15] ^ c[130] ^ c[235] ^ c[271] ^ c[300] ^ c[451] ^ c[478];
+    s |= c[16] ^ c[131] ^ c[236] ^ c[272] ^ c[301] ^ c[452] ^ c[479];
+    s |= c[17] ^ c[132] ^ c[237] ^ c[273] ^ c[302] ^ c[453] ^ c[480];
+    s |= c[18] ^ c[133] ^ c[238] ^ c[274] ^ c[303] ^ c[454] ^ c[481];
+    s |= c[19] ^ c[134] ^ c[239] ^ c[275] ^ c[304] ^ c[455] ^ c[482];
+    s |= c[20] ^ c[108] ^ c[240] ^ c[276] ^ c[305] ^ c[456] ^ c[483];
+    s |= c[21] ^ c[109] ^ c[241] ^ c[277] ^ c[306] ^ c[457] ^ c[484];
+    s |= c[22] ^ c[110] ^ c[242] ^ c[278] ^ c[307] ^ c[458] ^ c[485];
+    s |= c[24] ^ c[77] ^ c[82] ^ c[125] ^ c[165] ^ c[226] ^ c[459] ^ c[486];
+    s |= c[25] ^ c[78] ^ c[83] ^ c[126] ^ c[166] ^ c[227] ^ c[460] ^ c[487];
+    s |= c[26] ^ c[79] ^ c[84] ^ c[127] ^ c[167] ^ c[228] ^ c[461] ^ c[488];
+    s |= c[0] ^ c[80] ^ c[85] ^ c[128] ^ c[168] ^ c[229] ^ c[462] ^ c[489];
+    s |= c[1] ^ c[54] ^ c[86] ^ c[129] ^ c[169] ^ c[230] ^ c[463] ^ c[490];
+    s |= c[2] ^ c[55] ^ c[87] ^ c[130] ^ c[170] ^ c[231] ^ c[464] ^ c[491];
+    s |= c[3] ^ c[56] ^ c[88] ^ c[131] ^ c[171] ^ c[232] ^ c[465] ^ c[492];
+    s |= c[4] ^ c[57] ^ c[89] ^ c[132] ^ c[172] ^ c[233] ^ c[466] ^ c[493];
+    s |= c[5] ^ c[58] ^ c[90] ^ c[133] ^ c[173] ^ c[234] ^ c[467] ^ c[494];
+    s |= c[6] ^ c[59] ^ c[91] ^ c[134] ^ c[174] ^ c[235] ^ c[468] ^ c[495];
+    s |= c[7] ^ c[60] ^ c[92] ^ c[108] ^ c[175] ^ c[236] ^ c[469] ^ c[496];
+    s |= c[8] ^ c[61] ^ c[93] ^ c[109] ^ c[176] ^ c[237] ^ c[470] ^ c[497];
+    s |= c[9] ^ c[62] ^ c[94] ^ c[110] ^ c[177] ^ c[238] ^ c[471] ^ c[498];
+    s |= c[10] ^ c[63] ^ c[95] ^ c[111] ^ c[178] ^ c[239] ^ c[472] ^ c[499];
+    s |= c[11] ^ c[64] ^ c[96] ^ c[112] ^ c[179] ^ c[240] ^ c[473] ^ c[500];
+    s |= c[12] ^ c[65] ^ c[97] ^ c[113] ^ c[180] ^ c[241] ^ c[474] ^ c[501];
+    s |= c[13] ^ c[66] ^ c[98] ^ c[114] ^ c[181] ^ c[242] ^ c[475] ^ c[502];
+    s |= c[14] ^ c[67] ^ c[99] ^ c[115] ^ c[182] ^ c[216] ^ c[476] ^ c[503];
+    s |= c[15] ^ c[68] ^ c[100] ^ c[116] ^ c[183] ^ c[217] ^ c[477] ^ c[504];
+    s |= c[16] ^ c[69] ^ c[101] ^ c[117] ^ c[184] ^ c[218] ^ c[478] ^ c[505];
+    s |= c[17] ^ c[70] ^ c[102] ^ c[118] ^ c[185] ^ c[219] ^ c[479] ^ c[506];
+    s |= c[18] ^ c[71] ^ c[103] ^ c[119] ^ c[186] ^ c[220] ^ c[480] ^ c[507];
+    s |= c[19] ^ c[72] ^ c[104] ^ c[120] ^ c[187] ^ c[221] ^ c[481] ^ c[508];
+    s |= c[20] ^ c[73] ^ c[105] ^ c[121] ^ c[188] ^ c[222] ^ c[482] ^ c[509];
+    s |= c[21] ^ c[74] ^ c[106] ^ c[122] ^ c[162] ^ c[223] ^ c[483] ^ c[510];
+    s |= c[22] ^ c[75] ^ c[107] ^ c[123] ^ c[163] ^ c[224] ^ c[484] ^ c[511];
+    s |= c[23] ^ c[76] ^ c[81] ^ c[124] ^ c[164] ^ c[225] ^ c[485] ^ c[512];
+    s |= c[25] ^ c[116] ^ c[223] ^ c[261] ^ c[324] ^ c[486] ^ c[513];
+    s |= c[26] ^ c[117] ^ c[224] ^ c[262] ^ c[325] ^ c[487] ^ c[514];
+    s |= c[0] ^ c[118] ^ c[225] ^ c[263] ^ c[326] ^ c[488] ^ c[515];
+    s |= c[1] ^ c[119] ^ c[226] ^ c[264] ^ c[327] ^ c[489] ^ c[516];
+    s |= c[2] ^ c[120] ^ c[227] ^ c[265] ^ c[328] ^ c[490] ^ c[517];
+    s |= c[3] ^ c[121] ^ c[228] ^ c[266] ^ c[329] ^ c[491] ^ c[518];
+    s |= c[4] ^ c[122] ^ c[229] ^ c[267] ^ c[330] ^ c[492] ^ c[519];
+    s |= c[5] ^ c[123] ^ c[230] ^ c[268] ^ c[331] ^ c[493] ^ c[520];
+    s |= c[6] ^ c[124] ^ c[231] ^ c[269] ^ c[332] ^ c[494] ^ c[521];
+    s |= c[7] ^ c[125] ^ c[232] ^ c[243] ^ c[333] ^ c[495] ^ c[522];
+    s |= c[8] ^ c[126] ^ c[233] ^ c[244] ^ c[334] ^ c[496] ^ c[523];
+    s |= c[9] ^ c[127] ^ c[234] ^ c[245] ^ c[335] ^ c[497] ^ c[524];
+    s |= c[10] ^ c[128] ^ c[235] ^ c[246] ^ c[336] ^ c[498] ^ c[525];
+    s |= c[11] ^ c[129] ^ c[236] ^ c[247] ^ c[337] ^ c[499] ^ c[526];
+    s |= c[12] ^ c[130] ^ c[237] ^ c[248] ^ c[338] ^ c[500] ^ c[527];
+    s |= c[13] ^ c[131] ^ c[238] ^ c[249] ^ c[339] ^ c[501] ^ c[528];
+    s |= c[14] ^ c[132] ^ c[239] ^ c[250] ^ c[340] ^ c[502] ^ c[529];
+    s |= c[15] ^ c[133] ^ c[240] ^ c[251] ^ c[341] ^ c[503] ^ c[530];
+    s |= c[16] ^ c[134] ^ c[241] ^ c[252] ^ c[342] ^ c[504] ^ c[531];
+    s |= c[17] ^ c[108] ^ c[242] ^ c[253] ^ c[343] ^ c[505] ^ c[532];
+    s |= c[18] ^ c[109] ^ c[216] ^ c[254] ^ c[344] ^ c[506] ^ c[533];
+    s |= c[19] ^ c[110] ^ c[217] ^ c[255] ^ c[345] ^ c[507] ^ c[534];
+    s |= c[20] ^ c[111] ^ c[218] ^ c[256] ^ c[346] ^ c[508] ^ c[535];
+    s |= c[21] ^ c[112] ^ c[219] ^ c[257] ^ c[347] ^ c[509] ^ c[536];
+    s |= c[22] ^ c[113] ^ c[220] ^ c[258] ^ c[348] ^ c[510] ^ c[537];
+    s |= c[23] ^ c[114] ^ c[221] ^ c[259] ^ c[349] ^ c[511] ^ c[538];
+    s |= c[24] ^ c[115] ^ c[222] ^ c[260] ^ c[350] ^ c[512] ^ c[539];
+    s |= c[13] ^ c[51] ^ c[108] ^ c[170] ^ c[222] ^ c[513] ^ c[540];
+    s |= c[14] ^ c[52] ^ c[109] ^ c[171] ^ c[223] ^ c[514] ^ c[541];
+    s |= c[15] ^ c[53] ^ c[110] ^ c[172] ^ c[224] ^ c[515] ^ c[542];
+    s |= c[16] ^ c[27] ^ c[111] ^ c[173] ^ c[225] ^ c[516] ^ c[543];
+    s |= c[17] ^ c[28] ^ c[112] ^ c[174] ^ c[226] ^ c[517] ^ c[544];
+    s |= c[18] ^ c[29] ^ c[113] ^ c[175] ^ c[227] ^ c[518] ^ c[545];
+    s |= c[19] ^ c[30] ^ c[114] ^ c[176] ^ c[228] ^ c[519] ^ c[546];
+    s |= c[20] ^ c[31] ^ c[115] ^ c[177] ^ c[229] ^ c[520] ^ c[547];
+    s |= c[21] ^ c[32] ^ c[116] ^ c[178] ^ c[230] ^ c[521] ^ c[548];
+    s |= c[22] ^ c[33] ^ c[117] ^ c[179] ^ c[231] ^ c[522] ^ c[549];
+    s |= c[23] ^ c[34] ^ c[118] ^ c[180] ^ c[232] ^ c[523] ^ c[550];
+    s |= c[24] ^ c[35] ^ c[119] ^ c[181] ^ c[233] ^ c[524] ^ c[551];
+    s |= c[25] ^ c[36] ^ c[120] ^ c[182] ^ c[234] ^ c[525] ^ c[552];
+    s |= c[26] ^ c[37] ^ c[121] ^ c[183] ^ c[235] ^ c[526] ^ c[553];
+    s |= c[0] ^ c[38] ^ c[122] ^ c[184] ^ c[236] ^ c[527] ^ c[554];
+    s |= c[1] ^ c[39] ^ c[123] ^ c[185] ^ c[237] ^ c[528] ^ c[555];
+    s |= c[2] ^ c[40] ^ c[124] ^ c[186] ^ c[238] ^ c[529] ^ c[556];
+    s |= c[3] ^ c[41] ^ c[125] ^ c[187] ^ c[239] ^ c[530] ^ c[557];
+    s |= c[4] ^ c[42] ^ c[126] ^ c[188] ^ c[240] ^ c[531] ^ c[558];
+    s |= c[5] ^ c[43] ^ c[127] ^ c[162] ^ c[241] ^ c[532] ^ c[559];
+    s |= c[6] ^ c[44] ^ c[128] ^ c[163] ^ c[242] ^ c[533] ^ c[560];
+    s |= c[7] ^ c[45] ^ c[129] ^ c[164] ^ c[216] ^ c[534] ^ c[561];
+    s |= c[8] ^ c[46] ^ c[130] ^ c[165] ^ c[217] ^ c[535] ^ c[562];
+    s |= c[9] ^ c[47] ^ c[131] ^ c[166] ^ c[218] ^ c[536] ^ c[563];
+    s |= c[10] ^ c[48] ^ c[132] ^ c[167] ^ c[219] ^ c[537] ^ c[564];
+    s |= c[11] ^ c[49] ^ c[133] ^ c[168] ^ c[220] ^ c[538] ^ c[565];
+    s |= c[12] ^ c[50] ^ c[134] ^ c[169] ^ c[221] ^ c[539] ^ c[566];
+    s |= c[7] ^ c[47] ^ c[97] ^ c[130] ^ c[145] ^ c[239] ^ c[540] ^ c[567];
+    s |= c[8] ^ c[48] ^ c[98] ^ c[131] ^ c[146] ^ c[240] ^ c[541] ^ c[568];
+    s |= c[9] ^ c[49] ^ c[99] ^ c[132] ^ c[147] ^ c[241] ^ c[542] ^ c[569];
+    s |= c[10] ^ c[50] ^ c[100] ^ c[133] ^ c[148] ^ c[242] ^ c[543] ^ c[570];
+    s |= c[11] ^ c[51] ^ c[101] ^ c[134] ^ c[149] ^ c[216] ^ c[544] ^ c[571];
+    s |= c[12] ^ c[52] ^ c[102] ^ c[108] ^ c[150] ^ c[217] ^ c[545] ^ c[572];
+    s |= c[13] ^ c[53] ^ c[103] ^ c[109] ^ c[151] ^ c[218] ^ c[546] ^ c[573];
+    s |= c[14] ^ c[27] ^ c[104] ^ c[110] ^ c[152] ^ c[219] ^ c[547] ^ c[574];
+    s |= c[15] ^ c[28] ^ c[105] ^ c[111] ^ c[153] ^ c[220] ^ c[548] ^ c[575];
+    s |= c[16] ^ c[29] ^ c[106] ^ c[112] ^ c[154] ^ c[221] ^ c[549] ^ c[576];
+    s |= c[17] ^ c[30] ^ c[107] ^ c[113] ^ c[155] ^ c[222] ^ c[550] ^ c[577];
+    s |= c[18] ^ c[31] ^ c[81] ^ c[114] ^ c[156] ^ c[223] ^ c[551] ^ c[578];
+    s |= c[19] ^ c[32] ^ c[82] ^ c[115] ^ c[157] ^ c[224] ^ c[552] ^ c[579];
+    s |= c[20] ^ c[33] ^ c[83] ^ c[116] ^ c[158] ^ c[225] ^ c[553] ^ c[580];
+    s |= c[21] ^ c[34] ^ c[84] ^ c[117] ^ c[159] ^ c[226] ^ c[554] ^ c[581];
+    s |= c[22] ^ c[35] ^ c[85] ^ c[118] ^ c[160] ^ c[227] ^ c[555] ^ c[582];
+    s |= c[23] ^ c[36] ^ c[86] ^ c[119] ^ c[161] ^ c[228] ^ c[556] ^ c[583];
+    s |= c[24] ^ c[37] ^ c[87] ^ c[120] ^ c[135] ^ c[229] ^ c[557] ^ c[584];
+    s |= c[25] ^ c[38] ^ c[88] ^ c[121] ^ c[136] ^ c[230] ^ c[558] ^ c[585];
+    s |= c[26] ^ c[39] ^ c[89] ^ c[122] ^ c[137] ^ c[231] ^ c[559] ^ c[586];
+    s |= c[0] ^ c[40] ^ c[90] ^ c[123] ^ c[138] ^ c[232] ^ c[560] ^ c[587];
+    s |= c[1] ^ c[41] ^ c[91] ^ c[124] ^ c[139] ^ c[233] ^ c[561] ^ c[588];
+    s |= c[2] ^ c[42] ^ c[92] ^ c[125] ^ c[140] ^ c[234] ^ c[562] ^ c[589];
+    s |= c[3] ^ c[43] ^ c[93] ^ c[126] ^ c[141] ^ c[235] ^ c[563] ^ c[590];
+    s |= c[4] ^ c[44] ^ c[94] ^ c[127] ^ c[142] ^ c[236] ^ c[564] ^ c[591];
+    s |= c[5] ^ c[45] ^ c[95] ^ c[128] ^ c[143] ^ c[237] ^ c[565] ^ c[592];
+    s |= c[6] ^ c[46] ^ c[96] ^ c[129] ^ c[144] ^ c[238] ^ c[566] ^ c[593];
+    s |= c[11] ^ c[127] ^ c[229] ^ c[273] ^ c[314] ^ c[567] ^ c[594];
+    s |= c[12] ^ c[128] ^ c[230] ^ c[274] ^ c[315] ^ c[568] ^ c[595];
+    s |= c[13] ^ c[129] ^ c[231] ^ c[275] ^ c[316] ^ c[569] ^ c[596];
+    s |= c[14] ^ c[130] ^ c[232] ^ c[276] ^ c[317] ^ c[570] ^ c[597];
+    s |= c[15] ^ c[131] ^ c[233] ^ c[277] ^ c[318] ^ c[571] ^ c[598];
+    s |= c[16] ^ c[132] ^ c[234] ^ c[278] ^ c[319] ^ c[572] ^ c[599];
+    s |= c[17] ^ c[133] ^ c[235] ^ c[279] ^ c[320] ^ c[573] ^ c[600];
+    s |= c[18] ^ c[134] ^ c[236] ^ c[280] ^ c[321] ^ c[574] ^ c[601];
+    s |= c[19] ^ c[108] ^ c[237] ^ c[281] ^ c[322] ^ c[575] ^ c[602];
+    s |= c[20] ^ c[109] ^ c[238] ^ c[282] ^ c[323] ^ c[576] ^ c[603];
+    s |= c[21] ^ c[110] ^ c[239] ^ c[283] ^ c[297] ^ c[577] ^ c[604];
+    s |= c[22] ^ c[111] ^ c[240] ^ c[284] ^ c[298] ^ c[578] ^ c[605];
+    s |= c[23] ^ c[112] ^ c[241] ^ c[285] ^ c[299] ^ c[579] ^ c[606];
+    s |= c[24] ^ c[113] ^ c[242] ^ c[286] ^ c[300] ^ c[580] ^ c[607];
+    s |= c[25] ^ c[114] ^ c[216] ^ c[287] ^ c[301] ^ c[581] ^ c[608];
+    s |= c[26] ^ c[115] ^ c[217] ^ c[288] ^ c[302] ^ c[582] ^ c[609];
+    s |= c[0] ^ c[116] ^ c[218] ^ c[289] ^ c[303] ^ c[583] ^ c[610];
+    s |= c[1] ^ c[117] ^ c[219] ^ c[290] ^ c[304] ^ c[584] ^ c[611];
+    s |= c[2] ^ c[118] ^ c[220] ^ c[291] ^ c[305] ^ c[585] ^ c[612];
+    s |= c[3] ^ c[119] ^ c[221] ^ c[292] ^ c[306] ^ c[586] ^ c[613];
+    s |= c[4] ^ c[120] ^ c[222] ^ c[293] ^ c[307] ^ c[587] ^ c[614];
+    s |= c[5] ^ c[121] ^ c[223] ^ c[294] ^ c[308] ^ c[588] ^ c[615];
+    s |= c[6] ^ c[122] ^ c[224] ^ c[295] ^ c[309] ^ c[589] ^ c[616];
+    s |= c[7] ^ c[123] ^ c[225] ^ c[296] ^ c[310] ^ c[590] ^ c[617];
+    s |= c[8] ^ c[124] ^ c[226] ^ c[270] ^ c[311] ^ c[591] ^ c[618];
+    s |= c[9] ^ c[125] ^ c[227] ^ c[271] ^ c[312] ^ c[592] ^ c[619];
+    s |= c[10] ^ c[126] ^ c[228] ^ c[272] ^ c[313] ^ c[593] ^ c[620];
+    s |= c[25] ^ c[62] ^ c[131] ^ c[153] ^ c[203] ^ c[225] ^ c[594] ^ c[621];
+    s |= c[26] ^ c[63] ^ c[132] ^ c[154] ^ c[204] ^ c[226] ^ c[595] ^ c[622];
+    s |= c[0] ^ c[64] ^ c[133] ^ c[155] ^ c[205] ^ c[227] ^ c[596] ^ c[623];
+    s |= c[1] ^ c[65] ^ c[134] ^ c[156] ^ c[206] ^ c[228] ^ c[597] ^ c[624];
+    s |= c[2] ^ c[66] ^ c[108] ^ c[157] ^ c[207] ^ c[229] ^ c[598] ^ c[625];
+    s |= c[3] ^ c[67] ^ c[109] ^ c[158] ^ c[208] ^ c[230] ^ c[599] ^ c[626];
+    s |= c[4] ^ c[68] ^ c[110] ^ c[159] ^ c[209] ^ c[231] ^ c[600] ^ c[627];
+    s |= c[5] ^ c[69] ^ c[111] ^ c[160] ^ c[210] ^ c[232] ^ c[601] ^ c[628];
+    s |= c[6] ^ c[70] ^ c[112] ^ c[161] ^ c[211] ^ c[233] ^ c[602] ^ c[629];
+    s |= c[7] ^ c[71] ^ c[113] ^ c[135] ^ c[212] ^ c[234] ^ c[603] ^ c[630];
+    s |= c[8] ^ c[72] ^ c[114] ^ c[136] ^ c[213] ^ c[235] ^ c[604] ^ c[631];
+    s |= c[9] ^ c[73] ^ c[115] ^ c[137] ^ c[214] ^ c[236] ^ c[605] ^ c[632];
+    s |= c[10] ^ c[74] ^ c[116] ^ c[138] ^ c[215] ^ c[237] ^ c[606] ^ c[633];
+    s |= c[11] ^ c[75] ^ c[117] ^ c[139] ^ c[189] ^ c[238] ^ c[607] ^ c[634];
+    s |= c[12] ^ c[76] ^ c[118] ^ c[140] ^ c[190] ^ c[239] ^ c[608] ^ c[635];
+    s |= c[13] ^ c[77] ^ c[119] ^ c[141] ^ c[191] ^ c[240] ^ c[609] ^ c[636];
+    s |= c[14] ^ c[78] ^ c[120] ^ c[142] ^ c[192] ^ c[241] ^ c[610] ^ c[637];
+    s |= c[15] ^ c[79] ^ c[121] ^ c[143] ^ c[193] ^ c[242] ^ c[611] ^ c[638];
+    s |= c[16] ^ c[80] ^ c[122] ^ c[144] ^ c[194] ^ c[216] ^ c[612] ^ c[639];
+    s |= c[17] ^ c[54] ^ c[123] ^ c[145] ^ c[195] ^ c[217] ^ c[613] ^ c[640];
+    s |= c[18] ^ c[55] ^ c[124] ^ c[146] ^ c[196] ^ c[218] ^ c[614] ^ c[641];
+    s |= c[19] ^ c[56] ^ c[125] ^ c[147] ^ c[197] ^ c[219] ^ c[615] ^ c[642];
+    s |= c[20] ^ c[57] ^ c[126] ^ c[148] ^ c[198] ^ c[220] ^ c[616] ^ c[643];
+    s |= c[21] ^ c[58] ^ c[127] ^ c[149] ^ c[199] ^ c[221] ^ c[617] ^ c[644];
+    s |= c[22] ^ c[59] ^ c[128] ^ c[150] ^ c[200] ^ c[222] ^ c[618] ^ c[645];
+    s |= c[23] ^ c[60] ^ c[129] ^ c[151] ^ c[201] ^ c[223] ^ c[619] ^ c[646];
+    s |= c[24] ^ c[61] ^ c[130] ^ c[152] ^ c[202] ^ c[224] ^ c[620] ^ c[647];
+    s |= c[3] ^ c[124] ^ c[191] ^ c[241] ^ c[248] ^ c[325] ^ c[621];
+    s |= c[4] ^ c[125] ^ c[192] ^ c[242] ^ c[249] ^ c[326] ^ c[622];
+    s |= c[5] ^ c[126] ^ c[193] ^ c[216] ^ c[250] ^ c[327] ^ c[623];
+    s |= c[6] ^ c[127] ^ c[194] ^ c[217] ^ c[251] ^ c[328] ^ c[624];
+    s |= c[7] ^ c[128] ^ c[195] ^ c[218] ^ c[252] ^ c[329] ^ c[625];
+    s |= c[8] ^ c[129] ^ c[196] ^ c[219] ^ c[253] ^ c[330] ^ c[626];
+    s |= c[9] ^ c[130] ^ c[197] ^ c[220] ^ c[254] ^ c[331] ^ c[627];
+    s |= c[10] ^ c[131] ^ c[198] ^ c[221] ^ c[255] ^ c[332] ^ c[628];
+    s |= c[11] ^ c[132] ^ c[199] ^ c[222] ^ c[256] ^ c[333] ^ c[629];
+    s |= c[12] ^ c[133] ^ c[200] ^ c[223] ^ c[257] ^ c[334] ^ c[630];
+    s |= c[13] ^ c[134] ^ c[201] ^ c[224] ^ c[258] ^ c[335] ^ c[631];
+    s |= c[14] ^ c[108] ^ c[202] ^ c[225] ^ c[259] ^ c[336] ^ c[632];
+    s |= c[15] ^ c[109] ^ c[203] ^ c[226] ^ c[260] ^ c[337] ^ c[633];
+    s |= c[16] ^ c[110] ^ c[204] ^ c[227] ^ c[261] ^ c[338] ^ c[634];
+    s |= c[17] ^ c[111] ^ c[205] ^ c[228] ^ c[262] ^ c[339] ^ c[635];
+    s |= c[18] ^ c[112] ^ c[206] ^ c[229] ^ c[263] ^ c[340] ^ c[636];
+    s |= c[19] ^ c[113] ^ c[207] ^ c[230] ^ c[264] ^ c[341] ^ c[637];
+    s |= c[20] ^ c[114] ^ c[208] ^ c[231] ^ c[265] ^ c[342] ^ c[638];
+    s |= c[21] ^ c[115] ^ c[209] ^ c[232] ^ c[266] ^ c[343] ^ c[639];
+    s |= c[22] ^ c[116] ^ c[210] ^ c[233] ^ c[267] ^ c[344] ^ c[640];
+    s |= c[23] ^ c[117] ^ c[211] ^ c[234] ^ c[268] ^ c[345] ^ c[641];
+    s |= c[24] ^ c[118] ^ c[212] ^ c[235] ^ c[269] ^ c[346] ^ c[642];
+    s |= c[25] ^ c[119] ^ c[213] ^ c[236] ^ c[243] ^ c[347] ^ c[643];
+    s |= c[26] ^ c[120] ^ c[214] ^ c[237] ^ c[244] ^ c[348] ^ c[644];
+    s |= c[0] ^ c[121] ^ c[215] ^ c[238] ^ c[245] ^ c[349] ^ c[645];
+    s |= c[1] ^ c[122] ^ c[189] ^ c[239] ^ c[246] ^ c[350] ^ c[646];
+    s |= c[2] ^ c[123] ^ c[190] ^ c[240] ^ c[247] ^ c[324] ^ c[647];
+    return s;
+  }
+};
+
+#endif
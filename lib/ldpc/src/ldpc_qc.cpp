@@ -0,0 +1,326 @@
+#include "ldpc_qc.h"
+#include "ldpc_alloc.h"
+
+#include <string.h>
+
+static inline uint32_t loadBits(const uint32_t *src, uint32_t pos)
+{
+  uint32_t q = pos >> 5;
+  uint32_t r = pos & 31;
+  return r ? (src[q] << r) | (src[q + 1] >> (32 - r)) : src[q];
+}
+
+void ldpcXorBits(uint32_t *dst, uint32_t dstPos, const uint32_t *src, uint32_t srcPos, uint32_t length)
+{
+  while (length > 0)
+  {
+    uint32_t q = dstPos >> 5;
+    uint32_t r = dstPos & 31;
+    uint32_t take = 32 - r;
+    if (take > length)
+      take = length;
+
+    uint32_t bits = loadBits(src, srcPos);
+    if (take < 32)
+      bits &= ~(0xFFFFFFFFUL >> take);
+    dst[q] ^= bits >> r;
+
+    dstPos += take;
+    srcPos += take;
+    length -= take;
+  }
+}
+
+void ldpcRotateXor(uint32_t *dst, uint32_t dstPos, const uint32_t *src, uint32_t srcPos, uint16_t Z, uint16_t shift)
+{
+  ldpcXorBits(dst, dstPos, src, srcPos + shift, Z - shift);
+  if (shift > 0)
+    ldpcXorBits(dst, dstPos + Z - shift, src, srcPos, shift);
+}
+
+void ldpcLoadStream(const uint8_t *bytes, uint32_t bits, uint32_t *words)
+{
+  uint32_t fullBytes = bits / 8;
+  uint32_t w = 0;
+  uint32_t i = 0;
+
+  for (; i + 4 <= fullBytes; i += 4)
+  {
+    words[w++] = ((uint32_t)bytes[i] << 24) | ((uint32_t)bytes[i + 1] << 16) | ((uint32_t)bytes[i + 2] << 8) | bytes[i + 3];
+  }
+
+  uint32_t tail = 0;
+  uint8_t shift = 24;
+  for (; i < fullBytes; i++, shift -= 8)
+  {
+    tail |= (uint32_t)bytes[i] << shift;
+  }
+  if (bits % 8)
+  {
+    tail |= (uint32_t)(bytes[i] & (uint8_t)(0xFF << (8 - bits % 8))) << shift;
+  }
+  if (bits % 32)
+    words[w] = tail;
+}
+
+void ldpcStoreStream(const uint32_t *words, uint32_t bits, uint8_t *bytes)
+{
+  uint32_t byteCount = (bits + 7) / 8;
+  for (uint32_t i = 0; i < byteCount; i++)
+  {
+    bytes[i] = (uint8_t)(words[i >> 2] >> (24 - 8 * (i & 3)));
+  }
+  if (bits % 8)
+    bytes[byteCount - 1] &= (uint8_t)(0xFF << (8 - bits % 8));
+}
+
+QcEncoder::QcEncoder()
+    : graph(0), Z(0), blockWords(0), oddShift(0), parityBits(0), infoCols(0), coreRows(0), usedRows(0), punctured(0),
+      scratch(0), scratchWords(0), infoStream(0), parityStream(0), lambda(0), codewordStream(0)
+{
+}
+
+QcEncoder::~QcEncoder()
+{
+  release();
+}
+
+void QcEncoder::release()
+{
+  if (scratch != NULL)
+    ldpcFreeTable(scratch);
+  scratch = NULL;
+  scratchWords = 0;
+  graph = NULL;
+}
+
+size_t QcEncoder::memoryBytes() const
+{
+  return rowStart[usedRows] * sizeof(QcEntry) + scratchWords * sizeof(uint32_t);
+}
+
+uint16_t qcLiftShift(const QcBaseGraph &graph, int16_t shift, uint16_t Z)
+{
+  if (graph.lifting == QC_LIFT_SCALE && graph.baseZ > 0)
+    return (uint16_t)(((uint32_t)shift * Z / graph.baseZ) % Z);
+  return (uint16_t)(shift % Z);
+}
+
+static int16_t baseEntry(const QcBaseGraph &graph, uint8_t row, uint8_t col)
+{
+  return graph.shifts[row * graph.cols + col];
+}
+
+// Finds the dual-diagonal core and the extension rows below it
+bool QcEncoder::analyse()
+{
+  const QcBaseGraph &g = *graph;
+  infoCols = g.cols - g.rows;
+
+  // Extension rows: identity on their own parity column, nothing to the right,
+  // and that parity column unused by any earlier row
+  uint8_t core = g.rows;
+  while (core > 0)
+  {
+    uint8_t r = core - 1;
+    uint8_t own = infoCols + r;
+    bool extension = (baseEntry(g, r, own) == 0);
+
+    for (uint8_t c = own + 1; c < g.cols && extension; c++)
+      extension = (baseEntry(g, r, c) < 0);
+    for (uint8_t above = 0; above < r && extension; above++)
+      extension = (baseEntry(g, above, own) < 0);
+
+    if (!extension)
+      break;
+    core--;
+  }
+  if (core < 2)
+    return false;
+  coreRows = core;
+
+  // Core: column kb + t (t >= 1) holds identities on rows t - 1 and t only
+  for (uint8_t t = 1; t < coreRows; t++)
+  {
+    for (uint8_t r = 0; r < coreRows; r++)
+    {
+      int16_t expected = (r == t - 1 || r == t) ? 0 : -1;
+      if (baseEntry(g, r, infoCols + t) != expected)
+        return false;
+    }
+  }
+  for (uint8_t r = 0; r < coreRows; r++)
+  {
+    for (uint8_t c = infoCols + coreRows; c < g.cols; c++)
+    {
+      if (baseEntry(g, r, c) >= 0)
+        return false;
+    }
+  }
+
+  // The first parity column must sum to a single circulant: every shift but one
+  // appears an even number of times
+  uint8_t odd = 0;
+  for (uint8_t r = 0; r < coreRows; r++)
+  {
+    int16_t s = baseEntry(g, r, infoCols);
+    coreShift[r] = (s >= 0) ? (int16_t)qcLiftShift(g, s, Z) : -1;
+  }
+  for (uint8_t r = 0; r < coreRows; r++)
+  {
+    if (coreShift[r] < 0)
+      continue;
+
+    // Count each distinct shift once, at its first occurrence
+    uint8_t count = 0;
+    bool first = true;
+    for (uint8_t other = 0; other < coreRows; other++)
+    {
+      count += (coreShift[other] == coreShift[r]);
+      if (other < r && coreShift[other] == coreShift[r])
+        first = false;
+    }
+    if (first && count % 2)
+    {
+      odd++;
+      oddShift = coreShift[r];
+    }
+  }
+  return odd == 1;
+}
+
+bool QcEncoder::configure(const QcBaseGraph &baseGraph, uint16_t z, uint16_t k, uint16_t n, uint8_t puncturedCols)
+{
+  release();
+
+  if (baseGraph.rows > LDPC_QC_MAX_ROWS || baseGraph.cols > LDPC_QC_MAX_COLS || baseGraph.cols <= baseGraph.rows || z == 0)
+    return false;
+
+  graph = &baseGraph;
+  Z = z;
+  if (!analyse())
+  {
+    graph = NULL;
+    return false;
+  }
+
+  uint32_t transmittedInfo = (k > (uint32_t)puncturedCols * Z) ? k - (uint32_t)puncturedCols * Z : 0;
+  if (k > LDPC_MAX_K || k > (uint32_t)infoCols * Z || transmittedInfo == 0 || n <= transmittedInfo || n > LDPC_MAX_N)
+  {
+    graph = NULL;
+    return false;
+  }
+
+  K = k;
+  N = n;
+  punctured = puncturedCols;
+  parityBits = N - transmittedInfo;
+  usedRows = (parityBits + Z - 1) / Z;
+  if (usedRows < coreRows || usedRows > baseGraph.rows)
+  {
+    graph = NULL;
+    return false;
+  }
+
+  // Keep the non-zero entries of the rows that are needed
+  uint16_t count = 0;
+  for (uint8_t r = 0; r < usedRows; r++)
+  {
+    rowStart[r] = count;
+    for (uint8_t c = 0; c < baseGraph.cols; c++)
+    {
+      int16_t s = baseEntry(baseGraph, r, c);
+      if (s < 0)
+        continue;
+      if (count == LDPC_QC_MAX_ENTRIES)
+      {
+        graph = NULL;
+        return false;
+      }
+      entries[count].col = c;
+      entries[count].shift = qcLiftShift(baseGraph, s, Z);
+      count++;
+    }
+  }
+  rowStart[usedRows] = count;
+
+  blockWords = LDPC_WORDS(Z) + 1;
+  size_t infoWords = LDPC_WORDS((uint32_t)infoCols * Z) + 1;
+  size_t parityWords = LDPC_WORDS((uint32_t)usedRows * Z) + 1;
+  size_t codewordWords = LDPC_WORDS(N) + 1;
+  scratchWords = infoWords + parityWords + (size_t)coreRows * blockWords + codewordWords;
+
+  scratch = (uint32_t *)ldpcAllocTable(scratchWords * sizeof(uint32_t));
+  if (scratch == NULL)
+  {
+    scratchWords = 0;
+    graph = NULL;
+    return false;
+  }
+
+  infoStream = scratch;
+  parityStream = infoStream + infoWords;
+  lambda = parityStream + parityWords;
+  codewordStream = lambda + (size_t)coreRows * blockWords;
+  return true;
+}
+
+void QcEncoder::encodeBlock(const uint8_t *info, uint8_t *codeword) const
+{
+  memset(scratch, 0, scratchWords * sizeof(uint32_t));
+  ldpcLoadStream(info, K, infoStream);
+
+  // lambda_i for the core rows from the information columns
+  for (uint8_t r = 0; r < coreRows; r++)
+  {
+    uint32_t *l = lambda + (size_t)r * blockWords;
+    for (uint16_t e = rowStart[r]; e < rowStart[r + 1]; e++)
+    {
+      if (entries[e].col < infoCols)
+        ldpcRotateXor(l, 0, infoStream, (uint32_t)entries[e].col * Z, Z, entries[e].shift);
+    }
+  }
+
+  // p_0 = P^-odd * sum(lambda)
+  uint32_t *sum = codewordStream; // Borrowed until the codeword is assembled
+  for (uint8_t r = 0; r < coreRows; r++)
+  {
+    const uint32_t *l = lambda + (size_t)r * blockWords;
+    for (uint16_t w = 0; w < blockWords; w++)
+      sum[w] ^= l[w];
+  }
+  ldpcRotateXor(parityStream, 0, sum, 0, Z, (Z - oddShift) % Z);
+  memset(sum, 0, blockWords * sizeof(uint32_t));
+
+  // Back-substitution down the dual diagonal
+  for (uint8_t r = 0; r + 1 < coreRows; r++)
+  {
+    uint32_t next = (uint32_t)(r + 1) * Z;
+    ldpcXorBits(parityStream, next, lambda + (size_t)r * blockWords, 0, Z);
+    if (coreShift[r] >= 0)
+      ldpcRotateXor(parityStream, next, parityStream, 0, Z, coreShift[r]);
+    if (r > 0)
+      ldpcXorBits(parityStream, next, parityStream, (uint32_t)r * Z, Z);
+  }
+
+  // Extension rows each produce their own parity block
+  for (uint8_t r = coreRows; r < usedRows; r++)
+  {
+    uint32_t own = (uint32_t)r * Z;
+    for (uint16_t e = rowStart[r]; e < rowStart[r + 1]; e++)
+    {
+      uint8_t col = entries[e].col;
+      if (col < infoCols)
+        ldpcRotateXor(parityStream, own, infoStream, (uint32_t)col * Z, Z, entries[e].shift);
+      else if (col < infoCols + r)
+        ldpcRotateXor(parityStream, own, parityStream, (uint32_t)(col - infoCols) * Z, Z, entries[e].shift);
+    }
+  }
+
+  // Transmitted information bits, then as much parity as fits
+  uint32_t infoStart = (uint32_t)punctured * Z;
+  uint32_t infoBits = K - infoStart;
+  ldpcXorBits(codewordStream, 0, infoStream, infoStart, infoBits);
+  ldpcXorBits(codewordStream, infoBits, parityStream, 0, parityBits);
+  ldpcStoreStream(codewordStream, N, codeword);
+}
@@ -0,0 +1,108 @@
+#ifndef LDPC_QC_H
+#define LDPC_QC_H
+
+#include "ldpc_encoder.h"
+
+#define LDPC_QC_MAX_ROWS 46     // 5G NR BG1
+#define LDPC_QC_MAX_COLS 68     // 5G NR BG1
+#define LDPC_QC_MAX_ENTRIES 316 // Non-zero blocks of 5G NR BG1
+
+// How base-graph shifts are adapted to the lifting size Z
+enum QcLifting
+{
+  QC_LIFT_MODULO = 0, // s mod Z (802.11n tables are given at their own Z; 5G NR)
+  QC_LIFT_SCALE = 1   // floor(s * Z / baseZ) (802.16e)
+};
+
+// Base graph of a quasi-cyclic code. Each entry is -1 for an all-zero Z x Z
+// block, otherwise the shift s of the circulant P^s: the identity cyclically
+// shifted right by s columns, so (P^s x)[i] = x[(i + s) mod Z].
+struct QcBaseGraph
+{
+  const char *name;
+  uint8_t rows;
+  uint8_t cols;
+  const int16_t *shifts; // rows * cols, row-major
+  uint8_t lifting;       // QcLifting
+  uint16_t baseZ;        // Lifting size the shifts are defined for (QC_LIFT_SCALE)
+};
+
+// Shift of a non-negative base entry at lifting size Z
+uint16_t qcLiftShift(const QcBaseGraph &graph, int16_t shift, uint16_t Z);
+
+struct QcEntry
+{
+  uint8_t col;
+  uint16_t shift; // Already reduced for the lifting size
+};
+
+// Systematic encoder for QC-LDPC codes whose parity part is a dual-diagonal
+// core (802.11n, 802.16e, the 5G NR core rows) optionally followed by
+// extension rows that each add one new parity block (5G NR). Only the non-zero
+// base entries are stored; parity is computed with word-level rotate-and-XOR
+// of Z-bit sub-blocks:
+//
+//   lambda_i = sum_j P^h(i,j) s_j                 (core rows, information columns)
+//   p_0      = P^-h_odd sum_i lambda_i            (paired shifts of the weight-3 column cancel)
+//   p_i+1    = lambda_i + P^h(i,kb) p_0 + p_i     (back-substitution down the diagonal)
+//   p_r      = sum_c P^h(r,c) x_c                 (extension rows, c < kb + r)
+//
+// Codewords follow the ldpc_encoder.h layout with two generalisations: the
+// first `punctured` information blocks are not transmitted, and information
+// bits beyond K up to kb * Z are zero filler that is not transmitted either.
+// Parity is truncated to what fits in N. Scratch memory is owned by the
+// encoder, so use one instance per concurrent caller.
+class QcEncoder : public LdpcEncoder
+{
+public:
+  QcEncoder();
+  ~QcEncoder();
+
+  // Returns false if the graph does not have the supported structure or K/N do
+  // not fit the lifted code
+  bool configure(const QcBaseGraph &graph, uint16_t Z, uint16_t K, uint16_t N, uint8_t punctured = 0);
+  void release();
+
+  bool ready() const { return scratch != 0; }
+  const QcBaseGraph *baseGraph() const { return graph; }
+  uint16_t liftingSize() const { return Z; }
+
+  // Bytes of base-graph and scratch storage held by this instance
+  size_t memoryBytes() const;
+
+  void encodeBlock(const uint8_t *info, uint8_t *codeword) const;
+
+private:
+  bool analyse();
+
+  const QcBaseGraph *graph;
+  QcEntry entries[LDPC_QC_MAX_ENTRIES];
+  uint16_t rowStart[LDPC_QC_MAX_ROWS + 1];
+  int16_t coreShift[LDPC_QC_MAX_ROWS]; // Shift of the weight-3 column per core row, -1 if none
+  uint16_t Z;
+  uint16_t blockWords; // Words per Z-bit sub-block, plus one for unaligned reads
+  uint16_t oddShift;
+  uint16_t parityBits;
+  uint8_t infoCols;
+  uint8_t coreRows;
+  uint8_t usedRows;
+  uint8_t punctured;
+
+  uint32_t *scratch;
+  size_t scratchWords;
+  uint32_t *infoStream;
+  uint32_t *parityStream;
+  uint32_t *lambda;
+  uint32_t *codewordStream;
+};
+
+// Word-level bit-range helpers over MSB-first word streams (bit 0 is the MSB
+// of word 0). Sources must be readable one word past the last bit used.
+void ldpcLoadStream(const uint8_t *bytes, uint32_t bits, uint32_t *words);
+void ldpcStoreStream(const uint32_t *words, uint32_t bits, uint8_t *bytes);
+void ldpcXorBits(uint32_t *dst, uint32_t dstPos, const uint32_t *src, uint32_t srcPos, uint32_t length);
+
+// dst[dstPos..+Z) ^= P^shift applied to src[srcPos..+Z)
+void ldpcRotateXor(uint32_t *dst, uint32_t dstPos, const uint32_t *src, uint32_t srcPos, uint16_t Z, uint16_t shift);
+
+#endif
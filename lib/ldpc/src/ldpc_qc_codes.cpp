@@ -0,0 +1,1269 @@
+#include "ldpc_qc_codes.h"
+
+#define _ -1
+
+// IEEE 802.11n (Annex R), n = 648, rate 1/2, Z = 27
+static constexpr int16_t wifi648r12[12 * 24] = {
+    0, _, _, _, 0, 0, _, _, 0, _, _, 0, 1, 0, _, _, _, _, _, _, _, _, _, _,
+    22, 0, _, _, 17, _, 0, 0, 12, _, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _,
+    6, _, 0, _, 10, _, _, _, 24, _, 0, _, _, _, 0, 0, _, _, _, _, _, _, _, _,
+    2, _, _, 0, 20, _, _, _, 25, 0, _, _, _, _, _, 0, 0, _, _, _, _, _, _, _,
+    23, _, _, _, 3, _, _, _, 0, _, 9, 11, _, _, _, _, 0, 0, _, _, _, _, _, _,
+    24, _, 23, 1, 17, _, 3, _, 10, _, _, _, _, _, _, _, _, 0, 0, _, _, _, _, _,
+    25, _, _, _, 8, _, _, _, 7, 18, _, _, 0, _, _, _, _, _, 0, 0, _, _, _, _,
+    13, 24, _, _, 0, _, 8, _, 6, _, _, _, _, _, _, _, _, _, _, 0, 0, _, _, _,
+    7, 20, _, 16, 22, 10, _, _, 23, _, _, _, _, _, _, _, _, _, _, _, 0, 0, _, _,
+    11, _, _, _, 19, _, _, _, 13, _, 3, 17, _, _, _, _, _, _, _, _, _, 0, 0, _,
+    25, _, 8, _, 23, 18, _, 14, 9, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, 0,
+    3, _, _, _, 16, _, _, 2, 25, 5, _, _, 1, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 648, rate 2/3, Z = 27
+static constexpr int16_t wifi648r23[8 * 24] = {
+    25, 26, 14, _, 20, _, 2, _, 4, _, _, 8, _, 16, _, 18, 1, 0, _, _, _, _, _, _,
+    10, 9, 15, 11, _, 0, _, 1, _, _, 18, _, 8, _, 10, _, _, 0, 0, _, _, _, _, _,
+    16, 2, 20, 26, 21, _, 6, _, 1, 26, _, 7, _, _, _, _, _, _, 0, 0, _, _, _, _,
+    10, 13, 5, 0, _, 3, _, 7, _, _, 26, _, _, 13, _, 16, _, _, _, 0, 0, _, _, _,
+    23, 14, 24, _, 12, _, 19, _, 17, _, _, _, 20, _, 21, _, 0, _, _, _, 0, 0, _, _,
+    6, 22, 9, 20, _, 25, _, 17, _, 8, _, 14, _, 18, _, _, _, _, _, _, _, 0, 0, _,
+    14, 23, 21, 11, 20, _, 24, _, 18, _, 19, _, _, _, _, 22, _, _, _, _, _, _, 0, 0,
+    17, 11, 11, 20, _, 21, _, 26, _, 3, _, _, 18, _, 26, _, 1, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 648, rate 3/4, Z = 27
+static constexpr int16_t wifi648r34[6 * 24] = {
+    16, 17, 22, 24, 9, 3, 14, _, 4, 2, 7, _, 26, _, 2, _, 21, _, 1, 0, _, _, _, _,
+    25, 12, 12, 3, 3, 26, 6, 21, _, 15, 22, _, 15, _, 4, _, _, 16, _, 0, 0, _, _, _,
+    25, 18, 26, 16, 22, 23, 9, _, 0, _, 4, _, 4, _, 8, 23, 11, _, _, _, 0, 0, _, _,
+    9, 7, 0, 1, 17, _, _, 7, 3, _, 3, 23, _, 16, _, _, 21, _, 0, _, _, 0, 0, _,
+    24, 5, 26, 7, 1, _, _, 15, 24, 15, _, 8, _, 13, _, 13, _, 11, _, _, _, _, 0, 0,
+    2, 2, 19, 14, 24, 1, 15, 19, _, 21, _, 2, _, 24, _, 3, _, 2, 1, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 648, rate 5/6, Z = 27
+static constexpr int16_t wifi648r56[4 * 24] = {
+    17, 13, 8, 21, 9, 3, 18, 12, 10, 0, 4, 15, 19, 2, 5, 10, 26, 19, 13, 13, 1, 0, _, _,
+    3, 12, 11, 14, 11, 25, 5, 18, 0, 9, 2, 26, 26, 10, 24, 7, 14, 20, 4, 2, _, 0, 0, _,
+    22, 16, 4, 3, 10, 21, 12, 5, 21, 14, 19, 5, _, 8, 5, 18, 11, 5, 5, 15, 0, _, 0, 0,
+    7, 7, 14, 14, 4, 16, 16, 24, 24, 10, 1, 7, 15, 6, 10, 26, 8, 18, 21, 14, 1, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 1296, rate 1/2, Z = 54
+static constexpr int16_t wifi1296r12[12 * 24] = {
+    40, _, _, _, 22, _, 49, 23, 43, _, _, _, 1, 0, _, _, _, _, _, _, _, _, _, _,
+    50, 1, _, _, 48, 35, _, _, 13, _, 30, _, _, 0, 0, _, _, _, _, _, _, _, _, _,
+    39, 50, _, _, 4, _, 2, _, _, _, _, 49, _, _, 0, 0, _, _, _, _, _, _, _, _,
+    33, _, _, 38, 37, _, _, 4, 1, _, _, _, _, _, _, 0, 0, _, _, _, _, _, _, _,
+    45, _, _, _, 0, 22, _, _, 20, 42, _, _, _, _, _, _, 0, 0, _, _, _, _, _, _,
+    51, _, _, 48, 35, _, _, _, 44, _, 18, _, _, _, _, _, _, 0, 0, _, _, _, _, _,
+    47, 11, _, _, _, 17, _, _, 51, _, _, _, 0, _, _, _, _, _, 0, 0, _, _, _, _,
+    5, _, 25, _, 6, _, 45, _, 13, 40, _, _, _, _, _, _, _, _, _, 0, 0, _, _, _,
+    33, _, _, 34, 24, _, _, _, 23, _, _, 46, _, _, _, _, _, _, _, _, 0, 0, _, _,
+    1, _, 27, _, 1, _, _, _, 38, _, 44, _, _, _, _, _, _, _, _, _, _, 0, 0, _,
+    _, 18, _, _, 23, _, _, 8, 0, 35, _, _, _, _, _, _, _, _, _, _, _, _, 0, 0,
+    49, _, 17, _, 30, _, _, _, 34, _, _, 19, 1, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 1296, rate 2/3, Z = 54
+static constexpr int16_t wifi1296r23[8 * 24] = {
+    39, 31, 22, 43, _, 40, 4, _, 11, _, _, 50, _, _, _, 6, 1, 0, _, _, _, _, _, _,
+    25, 52, 41, 2, 6, _, 14, _, 34, _, _, _, 24, _, 37, _, _, 0, 0, _, _, _, _, _,
+    43, 31, 29, 0, 21, _, 28, _, _, 2, _, _, 7, _, 17, _, _, _, 0, 0, _, _, _, _,
+    20, 33, 48, _, 4, 13, _, 26, _, _, 22, _, _, 46, 42, _, _, _, _, 0, 0, _, _, _,
+    45, 7, 18, 51, 12, 25, _, _, _, 50, _, _, 5, _, _, _, 0, _, _, _, 0, 0, _, _,
+    35, 40, 32, 16, 5, _, _, 18, _, _, 43, 51, _, 32, _, _, _, _, _, _, _, 0, 0, _,
+    9, 24, 13, 22, 28, _, _, 37, _, _, 25, _, _, 52, _, 13, _, _, _, _, _, _, 0, 0,
+    32, 22, 4, 21, 16, _, _, _, 27, 28, _, 38, _, _, _, 8, 1, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 1296, rate 3/4, Z = 54
+static constexpr int16_t wifi1296r34[6 * 24] = {
+    39, 40, 51, 41, 3, 29, 8, 36, _, 14, _, 6, _, 33, _, 11, _, 4, 1, 0, _, _, _, _,
+    48, 21, 47, 9, 48, 35, 51, _, 38, _, 28, _, 34, _, 50, _, 50, _, _, 0, 0, _, _, _,
+    30, 39, 28, 42, 50, 39, 5, 17, _, 6, _, 18, _, 20, _, 15, _, 40, _, _, 0, 0, _, _,
+    29, 0, 1, 43, 36, 30, 47, _, 49, _, 47, _, 3, _, 35, _, 34, _, 0, _, _, 0, 0, _,
+    1, 32, 11, 23, 10, 44, 12, 7, _, 48, _, 4, _, 9, _, 17, _, 16, _, _, _, _, 0, 0,
+    13, 7, 15, 47, 23, 16, 47, _, 43, _, 29, _, 52, _, 2, _, 53, _, 1, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 1296, rate 5/6, Z = 54
+static constexpr int16_t wifi1296r56[4 * 24] = {
+    48, 29, 37, 52, 2, 16, 6, 14, 53, 31, 34, 5, 18, 42, 53, 31, 45, _, 46, 52, 1, 0, _, _,
+    17, 4, 30, 7, 43, 11, 24, 6, 14, 21, 6, 39, 17, 40, 47, 7, 15, 41, 19, _, _, 0, 0, _,
+    7, 2, 51, 31, 46, 23, 16, 11, 53, 40, 10, 7, 46, 53, 33, 35, _, 25, 35, 38, 0, _, 0, 0,
+    19, 48, 41, 1, 10, 7, 36, 47, 5, 29, 52, 52, 31, 10, 26, 6, 3, 2, _, 51, 1, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 1944, rate 1/2, Z = 81
+static constexpr int16_t wifi1944r12[12 * 24] = {
+    57, _, _, _, 50, _, 11, _, 50, _, 79, _, 1, 0, _, _, _, _, _, _, _, _, _, _,
+    3, _, 28, _, 0, _, _, _, 55, 7, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _,
+    30, _, _, _, 24, 37, _, _, 56, 14, _, _, _, _, 0, 0, _, _, _, _, _, _, _, _,
+    62, 53, _, _, 53, _, _, 3, 35, _, _, _, _, _, _, 0, 0, _, _, _, _, _, _, _,
+    40, _, _, 20, 66, _, _, 22, 28, _, _, _, _, _, _, _, 0, 0, _, _, _, _, _, _,
+    0, _, _, _, 8, _, 42, _, 50, _, _, 8, _, _, _, _, _, 0, 0, _, _, _, _, _,
+    69, 79, 79, _, _, _, 56, _, 52, _, _, _, 0, _, _, _, _, _, 0, 0, _, _, _, _,
+    65, _, _, _, 38, 57, _, _, 72, _, 27, _, _, _, _, _, _, _, _, 0, 0, _, _, _,
+    64, _, _, _, 14, 52, _, _, 30, _, _, 32, _, _, _, _, _, _, _, _, 0, 0, _, _,
+    _, 45, _, 70, 0, _, _, _, 77, 9, _, _, _, _, _, _, _, _, _, _, _, 0, 0, _,
+    2, 56, _, 57, 35, _, _, _, _, _, 12, _, _, _, _, _, _, _, _, _, _, _, 0, 0,
+    24, _, 61, _, 60, _, _, 27, 51, _, _, 16, 1, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 1944, rate 2/3, Z = 81
+static constexpr int16_t wifi1944r23[8 * 24] = {
+    61, 75, 4, 63, 56, _, _, _, _, _, _, 8, _, 2, 17, 25, 1, 0, _, _, _, _, _, _,
+    56, 74, 77, 20, _, _, _, 64, 24, 4, 67, _, 7, _, _, _, _, 0, 0, _, _, _, _, _,
+    28, 21, 68, 10, 7, 14, 65, _, _, _, 23, _, _, _, 75, _, _, _, 0, 0, _, _, _, _,
+    48, 38, 43, 78, 76, _, _, _, _, 5, 36, _, 15, 72, _, _, _, _, _, 0, 0, _, _, _,
+    40, 2, 53, 25, _, 52, 62, _, 20, _, _, 44, _, _, _, _, 0, _, _, _, 0, 0, _, _,
+    69, 23, 64, 10, 22, _, 21, _, _, _, _, _, 68, 23, 29, _, _, _, _, _, _, 0, 0, _,
+    12, 0, 68, 20, 55, 61, _, 40, _, _, _, 52, _, _, _, 44, _, _, _, _, _, _, 0, 0,
+    58, 8, 34, 64, 78, _, _, 11, 78, 24, _, _, _, _, _, 58, 1, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 1944, rate 3/4, Z = 81
+static constexpr int16_t wifi1944r34[6 * 24] = {
+    48, 29, 28, 39, 9, 61, _, _, _, 63, 45, 80, _, _, _, 37, 32, 22, 1, 0, _, _, _, _,
+    4, 49, 42, 48, 11, 30, _, _, _, 49, 17, 41, 37, 15, _, 54, _, _, _, 0, 0, _, _, _,
+    35, 76, 78, 51, 37, 35, 21, _, 17, 64, _, _, _, 59, 7, _, _, 32, _, _, 0, 0, _, _,
+    9, 65, 44, 9, 54, 56, 73, 34, 42, _, _, _, 35, _, _, _, 46, 39, 0, _, _, 0, 0, _,
+    3, 62, 7, 80, 68, 26, _, 80, 55, _, 36, _, 26, _, 9, _, 72, _, _, _, _, _, 0, 0,
+    26, 75, 33, 21, 69, 59, 3, 38, _, _, _, 35, _, 62, 36, 26, _, _, 1, _, _, _, _, 0,
+};
+
+// IEEE 802.11n (Annex R), n = 1944, rate 5/6, Z = 81
+static constexpr int16_t wifi1944r56[4 * 24] = {
+    13, 48, 80, 66, 4, 74, 7, 30, 76, 52, 37, 60, _, 49, 73, 31, 74, 73, 23, _, 1, 0, _, _,
+    69, 63, 74, 56, 64, 77, 57, 65, 6, 16, 51, _, 64, _, 68, 9, 48, 62, 54, 27, _, 0, 0, _,
+    51, 15, 0, 80, 24, 25, 42, 54, 44, 71, 71, 9, 67, 35, _, 58, _, 29, _, 53, 0, _, 0, 0,
+    16, 29, 36, 41, 44, 56, 59, 37, 50, 24, _, 65, 4, 65, 52, _, 4, _, 73, 52, 1, _, _, 0,
+};
+
+// IEEE 802.16e, rate 1/2, shifts defined for Z0 = 96 and scaled to Z
+static constexpr int16_t wimaxR12[12 * 24] = {
+    _, 94, 73, _, _, _, _, _, 55, 83, _, _, 7, 0, _, _, _, _, _, _, _, _, _, _,
+    _, 27, _, _, _, 22, 79, 9, _, _, _, 12, _, 0, 0, _, _, _, _, _, _, _, _, _,
+    _, _, _, 24, 22, 81, _, 33, _, _, _, 0, _, _, 0, 0, _, _, _, _, _, _, _, _,
+    61, _, 47, _, _, _, _, _, 65, 25, _, _, _, _, _, 0, 0, _, _, _, _, _, _, _,
+    _, _, 39, _, _, _, 84, _, _, 41, 72, _, _, _, _, _, 0, 0, _, _, _, _, _, _,
+    _, _, _, _, 46, 40, _, 82, _, _, _, 79, 0, _, _, _, _, 0, 0, _, _, _, _, _,
+    _, _, 95, 53, _, _, _, _, _, 14, 18, _, _, _, _, _, _, _, 0, 0, _, _, _, _,
+    _, 11, 73, _, _, _, 2, _, _, 47, _, _, _, _, _, _, _, _, _, 0, 0, _, _, _,
+    12, _, _, _, 83, 24, _, 43, _, _, _, 51, _, _, _, _, _, _, _, _, 0, 0, _, _,
+    _, _, _, _, _, 94, _, 59, _, _, 70, 72, _, _, _, _, _, _, _, _, _, 0, 0, _,
+    _, _, 7, 65, _, _, _, _, 39, 49, _, _, _, _, _, _, _, _, _, _, _, _, 0, 0,
+    43, _, _, _, _, 66, _, 41, _, _, _, 26, 7, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.16e, rate 2/3A, shifts defined for Z0 = 96 and reduced mod Z (the one rate not scaled)
+static constexpr int16_t wimaxR23A[8 * 24] = {
+    3, 0, _, _, 2, 0, _, 3, 7, _, 1, 1, _, _, _, _, 1, 0, _, _, _, _, _, _,
+    _, _, 1, _, 36, _, _, 34, 10, _, _, 18, 2, _, 3, 0, _, 0, 0, _, _, _, _, _,
+    _, _, 12, 2, _, 15, _, 40, _, 3, _, 15, _, 2, 13, _, _, _, 0, 0, _, _, _, _,
+    _, _, 19, 24, _, 3, 0, _, 6, _, 17, _, _, _, 8, 39, _, _, _, 0, 0, _, _, _,
+    20, _, 6, _, _, 10, 29, _, _, 28, _, 14, _, 38, _, _, 0, _, _, _, 0, 0, _, _,
+    _, _, 10, _, 28, 20, _, _, 8, _, 36, _, 9, _, 21, 45, _, _, _, _, _, 0, 0, _,
+    35, 25, _, 37, _, 21, _, _, 5, _, _, 0, _, 4, 20, _, _, _, _, _, _, _, 0, 0,
+    _, 6, 6, _, _, _, 4, _, 14, 30, _, 3, 36, _, 14, _, 1, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.16e, rate 2/3B, shifts defined for Z0 = 96 and scaled to Z
+static constexpr int16_t wimaxR23B[8 * 24] = {
+    2, _, 19, _, 47, _, 48, _, 36, _, 82, _, 47, _, 15, _, 95, 0, _, _, _, _, _, _,
+    _, 69, _, 88, _, 33, _, 3, _, 16, _, 37, _, 40, _, 48, _, 0, 0, _, _, _, _, _,
+    10, _, 86, _, 62, _, 28, _, 85, _, 16, _, 34, _, 73, _, _, _, 0, 0, _, _, _, _,
+    _, 28, _, 32, _, 81, _, 27, _, 88, _, 5, _, 56, _, 37, _, _, _, 0, 0, _, _, _,
+    23, _, 29, _, 15, _, 30, _, 66, _, 24, _, 50, _, 62, _, _, _, _, _, 0, 0, _, _,
+    _, 30, _, 65, _, 54, _, 14, _, 0, _, 30, _, 74, _, 0, _, _, _, _, _, 0, 0, _,
+    32, _, 0, _, 15, _, 56, _, 85, _, 5, _, 6, _, 52, _, 0, _, _, _, _, _, 0, 0,
+    _, 0, _, 47, _, 13, _, 61, _, 84, _, 55, _, 78, _, 41, 95, _, _, _, _, _, _, 0,
+};
+
+// IEEE 802.16e, rate 3/4A, shifts defined for Z0 = 96 and scaled to Z
+static constexpr int16_t wimaxR34A[6 * 24] = {
+    6, 38, 3, 93, _, _, _, 30, 70, _, 86, _, 37, 38, 4, 11, _, 46, 48, 0, _, _, _, _,
+    62, 94, 19, 84, _, 92, 78, _, 15, _, _, 92, _, 45, 24, 32, 30, _, _, 0, 0, _, _, _,
+    71, _, 55, _, 12, 66, 45, 79, _, 78, _, _, 10, _, 22, 55, 70, 82, _, _, 0, 0, _, _,
+    38, 61, _, 66, 9, 73, 47, 64, _, 39, 61, 43, _, _, _, _, 95, 32, 0, _, _, 0, 0, _,
+    _, _, _, _, 32, 52, 55, 80, 95, 22, 6, 51, 24, 90, 44, 20, _, _, _, _, _, _, 0, 0,
+    _, 63, 31, 88, 20, _, _, _, 6, 40, 56, 16, 71, 53, _, _, 27, 26, 48, _, _, _, _, 0,
+};
+
+// IEEE 802.16e, rate 3/4B, shifts defined for Z0 = 96 and scaled to Z
+static constexpr int16_t wimaxR34B[6 * 24] = {
+    _, 81, _, 28, _, _, 14, 25, 17, _, _, 85, 29, 52, 78, 95, 22, 92, 0, 0, _, _, _, _,
+    42, _, 14, 68, 32, _, _, _, _, 70, 43, 11, 36, 40, 33, 57, 38, 24, _, 0, 0, _, _, _,
+    _, _, 20, _, _, 63, 39, _, 70, 67, _, 38, 4, 72, 47, 29, 60, 5, 80, _, 0, 0, _, _,
+    64, 2, _, _, 63, _, _, 3, 51, _, 81, 15, 94, 9, 85, 36, 14, 19, _, _, _, 0, 0, _,
+    _, 53, 60, 80, _, 26, 75, _, _, _, _, 86, 77, 1, 3, 72, 60, 25, _, _, _, _, 0, 0,
+    77, _, _, _, 15, 28, _, 35, _, 72, 30, 68, 85, 84, 26, 64, 11, 89, 0, _, _, _, _, 0,
+};
+
+// IEEE 802.16e, rate 5/6, shifts defined for Z0 = 96 and scaled to Z
+static constexpr int16_t wimaxR56[4 * 24] = {
+    1, 25, 55, _, 47, 4, _, 91, 84, 8, 86, 52, 82, 33, 5, 0, 36, 20, 4, 77, 80, 0, _, _,
+    _, 6, _, 36, 40, 47, 12, 79, 47, _, 41, 21, 12, 71, 14, 72, 0, 44, 49, 0, 0, 0, 0, _,
+    51, 81, 83, 4, 67, _, 21, _, 31, 24, 91, 61, 81, 9, 86, 78, 60, 88, 67, 15, _, _, 0, 0,
+    68, _, 50, 15, _, 36, 13, 10, 11, 20, 53, 90, 29, 92, 57, 30, 84, 92, 11, 66, 80, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-2, base graph 1, iLS 0: Z = 2, 4, ..., 256
+static constexpr int16_t nrBg1Ils0[46 * 68] = {
+    250, 69, 226, 159, _, 100, 10, _, _, 59, 229, 110, 191, 9, _, 195, 23, _, 190, 35, 239, 31, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    2, _, 239, 117, 124, 71, _, 222, 104, 173, _, 220, 102, _, 109, 132, 142, 155, _, 255, _, 28, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    106, 111, 185, _, 63, 117, 93, 229, 177, 95, 39, _, _, 142, 225, 225, _, 245, 205, 251, 117, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    121, 89, _, 84, 20, _, 150, 131, 243, _, 136, 86, 246, 219, 211, _, 240, 76, 244, _, 144, 12, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    157, 102, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    205, 236, _, 194, _, _, _, _, _, _, _, _, 231, _, _, _, 28, _, _, _, _, 123, 115, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    183, _, _, _, _, _, 22, _, _, _, 28, 67, _, 244, _, _, _, 11, 157, _, 211, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    220, 44, _, _, 159, _, _, 31, 167, _, _, _, _, _, 104, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    112, 4, _, 7, _, _, _, _, _, _, _, _, 211, _, _, _, 102, _, _, 164, _, 109, 241, _, 90, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    103, 182, _, _, _, _, _, _, _, _, 109, 21, _, 142, _, _, _, 14, 61, _, 216, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 98, 149, _, 167, _, _, 160, 49, _, _, _, _, _, 58, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    77, 41, _, _, _, _, _, _, _, _, _, _, 83, _, _, _, 182, _, _, _, _, 78, 252, 22, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    160, 42, _, _, _, _, _, _, _, _, 21, 32, _, 234, _, _, _, _, 7, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    177, _, _, 248, _, _, _, 151, _, _, _, _, _, _, _, _, _, _, _, _, 185, _, _, 62, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    206, _, _, _, _, _, _, _, _, _, _, _, 55, _, _, 206, 127, 16, _, _, _, 229, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    40, 96, _, _, _, _, _, _, _, _, 65, _, _, 63, _, _, _, _, 75, _, _, _, _, _, _, 179, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 64, _, 49, _, _, _, _, _, _, _, 49, _, _, _, _, _, _, _, _, 51, _, 154, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    7, _, _, _, _, _, _, _, _, _, _, _, _, _, 164, _, 59, 1, _, _, _, 144, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 42, _, _, _, _, _, _, _, _, _, _, 233, 8, _, _, _, _, 155, 147, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    60, 73, _, _, _, _, _, 72, 127, _, 224, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    151, _, _, 186, _, _, _, _, _, 217, _, 47, _, _, _, _, _, _, _, _, _, _, 160, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 249, _, _, _, 121, _, _, _, _, _, _, _, _, _, _, 109, _, _, _, 131, 171, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    64, _, _, _, _, _, _, _, _, _, _, _, 142, 188, _, _, _, 158, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 156, 147, _, _, _, _, _, _, _, 170, _, _, _, _, _, _, _, 152, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    112, _, _, 86, 236, _, _, _, _, _, _, 116, _, _, _, _, _, _, _, _, _, _, 222, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 23, _, _, _, _, 136, 116, _, _, _, _, _, _, 182, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    195, _, 243, _, 215, _, _, _, _, _, _, _, _, _, _, 61, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 25, _, _, _, _, 104, _, 194, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    128, _, _, _, 165, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 181, _, 63, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 86, _, _, _, _, _, _, _, _, _, _, _, _, 236, _, _, _, 84, _, _, _, _, _, _, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    216, _, _, _, _, _, _, _, _, _, 73, _, _, 120, _, _, _, _, _, _, _, _, _, _, 9, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 95, _, _, _, _, _, 177, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 172, _, _, 61, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    221, _, _, _, _, _, _, _, _, _, _, _, 112, _, 199, _, _, _, _, _, _, _, _, _, 121, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 2, 187, _, _, _, _, _, _, _, _, 41, _, _, _, _, _, _, _, _, _, 211, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    127, _, _, _, _, _, _, 167, _, _, _, _, _, _, _, 164, _, 159, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 161, _, _, _, _, 197, _, _, _, _, _, 207, _, _, _, _, _, _, _, _, _, 103, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    37, _, _, _, _, _, _, _, _, _, _, _, _, _, 105, 51, _, _, 120, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, 198, _, _, _, _, _, _, _, _, _, _, _, 220, _, _, _, _, _, _, _, _, _, 122, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    167, _, _, _, _, _, _, _, _, 151, 157, _, 163, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 173, _, 139, _, _, _, 149, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    157, _, _, _, _, _, _, _, 137, _, _, _, _, _, _, _, _, 149, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, 167, _, 173, _, _, _, _, _, 139, _, _, _, _, _, _, _, _, 151, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    149, _, _, _, 157, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 137, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    _, 151, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 163, _, 173, _, _, _, _, _, _, 139, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    139, _, _, _, _, _, _, 157, _, 163, _, _, _, _, _, _, _, _, _, _, _, _, 173, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 149, _, _, _, _, 151, _, _, _, 167, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-2, base graph 1, iLS 1: Z = 3, 6, ..., 384
+static constexpr int16_t nrBg1Ils1[46 * 68] = {
+    307, 19, 50, 369, _, 181, 216, _, _, 317, 288, 109, 17, 357, _, 215, 106, _, 242, 180, 330, 346, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    76, _, 76, 73, 288, 144, _, 331, 331, 178, _, 295, 342, _, 217, 99, 354, 114, _, 331, _, 112, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    205, 250, 328, _, 332, 256, 161, 267, 160, 63, 129, _, _, 200, 88, 53, _, 131, 240, 205, 13, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    276, 87, _, 0, 275, _, 199, 153, 56, _, 132, 305, 231, 341, 212, _, 304, 300, 271, _, 39, 357, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    332, 181, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    195, 14, _, 115, _, _, _, _, _, _, _, _, 166, _, _, _, 241, _, _, _, _, 51, 157, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    278, _, _, _, _, _, 257, _, _, _, 1, 351, _, 92, _, _, _, 253, 18, _, 225, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    9, 62, _, _, 316, _, _, 333, 290, _, _, _, _, _, 114, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    307, 179, _, 165, _, _, _, _, _, _, _, _, 18, _, _, _, 39, _, _, 224, _, 368, 67, _, 170, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    366, 232, _, _, _, _, _, _, _, _, 321, 133, _, 57, _, _, _, 303, 63, _, 82, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 101, 339, _, 274, _, _, 111, 383, _, _, _, _, _, 354, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    48, 102, _, _, _, _, _, _, _, _, _, _, 8, _, _, _, 47, _, _, _, _, 188, 334, 115, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    77, 186, _, _, _, _, _, _, _, _, 174, 232, _, 50, _, _, _, _, 74, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    313, _, _, 177, _, _, _, 266, _, _, _, _, _, _, _, _, _, _, _, _, 115, _, _, 370, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    142, _, _, _, _, _, _, _, _, _, _, _, 248, _, _, 137, 89, 347, _, _, _, 12, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    241, 2, _, _, _, _, _, _, _, _, 210, _, _, 318, _, _, _, _, 55, _, _, _, _, _, _, 269, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 13, _, 338, _, _, _, _, _, _, _, 57, _, _, _, _, _, _, _, _, 289, _, 57, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    260, _, _, _, _, _, _, _, _, _, _, _, _, _, 303, _, 81, 358, _, _, _, 375, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 130, _, _, _, _, _, _, _, _, _, _, 163, 280, _, _, _, _, 132, 4, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    145, 213, _, _, _, _, _, 344, 242, _, 197, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    187, _, _, 206, _, _, _, _, _, 264, _, 341, _, _, _, _, _, _, _, _, _, _, 59, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 205, _, _, _, 102, _, _, _, _, _, _, _, _, _, _, 328, _, _, _, 213, 97, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    30, _, _, _, _, _, _, _, _, _, _, _, 11, 233, _, _, _, 22, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 24, 89, _, _, _, _, _, _, _, 61, _, _, _, _, _, _, _, 27, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    298, _, _, 158, 235, _, _, _, _, _, _, 339, _, _, _, _, _, _, _, _, _, _, 234, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 72, _, _, _, _, 17, 383, _, _, _, _, _, _, 312, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    71, _, 81, _, 76, _, _, _, _, _, _, _, _, _, _, 136, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 194, _, _, _, _, 194, _, 101, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    222, _, _, _, 19, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 244, _, 274, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 252, _, _, _, _, _, _, _, _, _, _, _, _, 5, _, _, _, 147, _, _, _, _, _, _, 78, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    159, _, _, _, _, _, _, _, _, _, 229, _, _, 260, _, _, _, _, _, _, _, _, _, _, 90, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 100, _, _, _, _, _, 215, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 258, _, _, 256, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    102, _, _, _, _, _, _, _, _, _, _, _, 201, _, 175, _, _, _, _, _, _, _, _, _, 287, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 323, 8, _, _, _, _, _, _, _, _, 361, _, _, _, _, _, _, _, _, _, 105, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    230, _, _, _, _, _, _, 148, _, _, _, _, _, _, _, 202, _, 312, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 320, _, _, _, _, 335, _, _, _, _, _, 2, _, _, _, _, _, _, _, _, _, 266, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    210, _, _, _, _, _, _, _, _, _, _, _, _, _, 313, 297, _, _, 21, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, 269, _, _, _, _, _, _, _, _, _, _, _, 82, _, _, _, _, _, _, _, _, _, 115, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    185, _, _, _, _, _, _, _, _, 177, 289, _, 214, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 258, _, 93, _, _, _, 346, _, _, _, _, _, _, _, _, _, _, _, 297, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    175, _, _, _, _, _, _, _, 37, _, _, _, _, _, _, _, _, 312, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, 52, _, 314, _, _, _, _, _, 139, _, _, _, _, _, _, _, _, 288, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    113, _, _, _, 14, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 218, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    _, 113, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 132, _, 114, _, _, _, _, _, _, 168, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    80, _, _, _, _, _, _, 78, _, 163, _, _, _, _, _, _, _, _, _, _, _, _, 274, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 135, _, _, _, _, 149, _, _, _, 15, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-2, base graph 1, iLS 2: Z = 5, 10, ..., 320
+static constexpr int16_t nrBg1Ils2[46 * 68] = {
+    73, 15, 103, 49, _, 240, 39, _, _, 15, 162, 215, 164, 133, _, 298, 110, _, 113, 16, 189, 32, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    303, _, 294, 27, 261, 161, _, 133, 4, 80, _, 129, 300, _, 76, 266, 72, 83, _, 260, _, 301, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    68, 7, 80, _, 280, 38, 227, 202, 200, 71, 106, _, _, 295, 283, 301, _, 184, 246, 230, 276, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    220, 208, _, 30, 197, _, 61, 175, 79, _, 281, 303, 253, 164, 53, _, 44, 28, 77, _, 319, 68, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    233, 205, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    83, 292, _, 50, _, _, _, _, _, _, _, _, 318, _, _, _, 201, _, _, _, _, 267, 279, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    289, _, _, _, _, _, 21, _, _, _, 293, 13, _, 232, _, _, _, 302, 138, _, 235, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    12, 88, _, _, 207, _, _, 50, 25, _, _, _, _, _, 76, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    295, 133, _, 130, _, _, _, _, _, _, _, _, 231, _, _, _, 296, _, _, 110, _, 269, 245, _, 154, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    189, 244, _, _, _, _, _, _, _, _, 36, 286, _, 151, _, _, _, 267, 135, _, 209, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 14, 80, _, 211, _, _, 75, 161, _, _, _, _, _, 311, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    16, 147, _, _, _, _, _, _, _, _, _, _, 290, _, _, _, 289, _, _, _, _, 177, 43, 280, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    229, 235, _, _, _, _, _, _, _, _, 169, 48, _, 105, _, _, _, _, 52, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    39, _, _, 302, _, _, _, 303, _, _, _, _, _, _, _, _, _, _, _, _, 160, _, _, 37, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    78, _, _, _, _, _, _, _, _, _, _, _, 299, _, _, 54, 61, 179, _, _, _, 258, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    229, 290, _, _, _, _, _, _, _, _, 60, _, _, 130, _, _, _, _, 184, _, _, _, _, _, _, 51, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 69, _, 140, _, _, _, _, _, _, _, 45, _, _, _, _, _, _, _, _, 115, _, 300, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    257, _, _, _, _, _, _, _, _, _, _, _, _, _, 147, _, 128, 51, _, _, _, 228, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 260, _, _, _, _, _, _, _, _, _, _, 294, 291, _, _, _, _, 141, 295, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    64, 181, _, _, _, _, _, 101, 270, _, 41, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    301, _, _, 162, _, _, _, _, _, 40, _, 130, _, _, _, _, _, _, _, _, _, _, 10, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 79, _, _, _, 175, _, _, _, _, _, _, _, _, _, _, 132, _, _, _, 283, 103, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    177, _, _, _, _, _, _, _, _, _, _, _, 20, 55, _, _, _, 316, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 249, 50, _, _, _, _, _, _, _, 133, _, _, _, _, _, _, _, 105, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    289, _, _, 280, 110, _, _, _, _, _, _, 187, _, _, _, _, _, _, _, _, _, _, 281, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 172, _, _, _, _, 295, 96, _, _, _, _, _, _, 46, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    270, _, 110, _, 318, _, _, _, _, _, _, _, _, _, _, 67, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 210, _, _, _, _, 29, _, 304, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    11, _, _, _, 293, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 50, _, 234, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 27, _, _, _, _, _, _, _, _, _, _, _, _, 308, _, _, _, 117, _, _, _, _, _, _, 29, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    91, _, _, _, _, _, _, _, _, _, 23, _, _, 105, _, _, _, _, _, _, _, _, _, _, 135, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 222, _, _, _, _, _, 308, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 66, _, _, 162, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    210, _, _, _, _, _, _, _, _, _, _, _, 22, _, 271, _, _, _, _, _, _, _, _, _, 217, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 170, 20, _, _, _, _, _, _, _, _, 140, _, _, _, _, _, _, _, _, _, 33, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    187, _, _, _, _, _, _, 296, _, _, _, _, _, _, _, 5, _, 44, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 207, _, _, _, _, 158, _, _, _, _, _, 55, _, _, _, _, _, _, _, _, _, 285, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    259, _, _, _, _, _, _, _, _, _, _, _, _, _, 179, 178, _, _, 160, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, 298, _, _, _, _, _, _, _, _, _, _, _, 15, _, _, _, _, _, _, _, _, _, 115, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    151, _, _, _, _, _, _, _, _, 179, 64, _, 181, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 102, _, 77, _, _, _, 192, _, _, _, _, _, _, _, _, _, _, _, 208, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    32, _, _, _, _, _, _, _, 80, _, _, _, _, _, _, _, _, 197, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, 154, _, 47, _, _, _, _, _, 124, _, _, _, _, _, _, _, _, 207, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    226, _, _, _, 65, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 126, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    _, 228, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 69, _, 176, _, _, _, _, _, _, 102, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    234, _, _, _, _, _, _, 227, _, 259, _, _, _, _, _, _, _, _, _, _, _, _, 260, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 101, _, _, _, _, 228, _, _, _, 126, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-2, base graph 1, iLS 3: Z = 7, 14, ..., 224
+static constexpr int16_t nrBg1Ils3[46 * 68] = {
+    223, 16, 94, 91, _, 74, 10, _, _, 0, 205, 216, 21, 215, _, 14, 70, _, 141, 198, 104, 81, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    141, _, 45, 151, 46, 119, _, 157, 133, 87, _, 206, 93, _, 79, 9, 118, 194, _, 31, _, 187, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    207, 203, 31, _, 176, 180, 186, 95, 153, 177, 70, _, _, 77, 214, 77, _, 198, 117, 223, 90, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    201, 18, _, 165, 5, _, 45, 142, 16, _, 34, 155, 213, 147, 69, _, 96, 74, 99, _, 30, 158, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    170, 10, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    164, 59, _, 86, _, _, _, _, _, _, _, _, 80, _, _, _, 182, _, _, _, _, 130, 153, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    158, _, _, _, _, _, 119, _, _, _, 113, 21, _, 63, _, _, _, 51, 136, _, 116, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    17, 76, _, _, 104, _, _, 100, 150, _, _, _, _, _, 158, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    33, 95, _, 4, _, _, _, _, _, _, _, _, 217, _, _, _, 204, _, _, 39, _, 58, 44, _, 201, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    9, 37, _, _, _, _, _, _, _, _, 213, 105, _, 89, _, _, _, 185, 109, _, 218, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 82, 165, _, 174, _, _, 19, 194, _, _, _, _, _, 103, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    52, 11, _, _, _, _, _, _, _, _, _, _, 2, _, _, _, 35, _, _, _, _, 32, 84, 201, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    142, 175, _, _, _, _, _, _, _, _, 136, 3, _, 28, _, _, _, _, 182, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    81, _, _, 56, _, _, _, 72, _, _, _, _, _, _, _, _, _, _, _, _, 217, _, _, 78, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    14, _, _, _, _, _, _, _, _, _, _, _, 175, _, _, 211, 191, 51, _, _, _, 43, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    90, 120, _, _, _, _, _, _, _, _, 131, _, _, 209, _, _, _, _, 209, _, _, _, _, _, _, 81, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 154, _, 164, _, _, _, _, _, _, _, 43, _, _, _, _, _, _, _, _, 189, _, 101, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    56, _, _, _, _, _, _, _, _, _, _, _, _, _, 110, _, 200, 63, _, _, _, 4, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 199, _, _, _, _, _, _, _, _, _, _, 110, 200, _, _, _, _, 143, 186, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    8, 6, _, _, _, _, _, 103, 198, _, 8, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    105, _, _, 210, _, _, _, _, _, 121, _, 214, _, _, _, _, _, _, _, _, _, _, 183, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 192, _, _, _, 131, _, _, _, _, _, _, _, _, _, _, 220, _, _, _, 50, 106, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    53, _, _, _, _, _, _, _, _, _, _, _, 0, 3, _, _, _, 148, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 88, 203, _, _, _, _, _, _, _, 168, _, _, _, _, _, _, _, 122, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    49, _, _, 157, 64, _, _, _, _, _, _, 193, _, _, _, _, _, _, _, _, _, _, 124, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 1, _, _, _, _, 166, 65, _, _, _, _, _, _, 81, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    107, _, 176, _, 212, _, _, _, _, _, _, _, _, _, _, 127, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 208, _, _, _, _, 141, _, 174, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    146, _, _, _, 153, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 217, _, 114, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 150, _, _, _, _, _, _, _, _, _, _, _, _, 11, _, _, _, 53, _, _, _, _, _, _, 68, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    34, _, _, _, _, _, _, _, _, _, 130, _, _, 210, _, _, _, _, _, _, _, _, _, _, 123, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 175, _, _, _, _, _, 49, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 177, _, _, 128, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    192, _, _, _, _, _, _, _, _, _, _, _, 209, _, 58, _, _, _, _, _, _, _, _, _, 30, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 114, 49, _, _, _, _, _, _, _, _, 161, _, _, _, _, _, _, _, _, _, 137, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    82, _, _, _, _, _, _, 186, _, _, _, _, _, _, _, 68, _, 150, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 192, _, _, _, _, 173, _, _, _, _, _, 26, _, _, _, _, _, _, _, _, _, 187, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    222, _, _, _, _, _, _, _, _, _, _, _, _, _, 157, 0, _, _, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, 81, _, _, _, _, _, _, _, _, _, _, _, 195, _, _, _, _, _, _, _, _, _, 138, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    123, _, _, _, _, _, _, _, _, 90, 73, _, 10, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 12, _, 77, _, _, _, 49, _, _, _, _, _, _, _, _, _, _, _, 114, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    67, _, _, _, _, _, _, _, 45, _, _, _, _, _, _, _, _, 96, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, 23, _, 215, _, _, _, _, _, 60, _, _, _, _, _, _, _, _, 167, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    114, _, _, _, 91, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 78, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    _, 206, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 22, _, 134, _, _, _, _, _, _, 161, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    84, _, _, _, _, _, _, 4, _, 9, _, _, _, _, _, _, _, _, _, _, _, _, 12, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 184, _, _, _, _, 121, _, _, _, 29, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-2, base graph 1, iLS 4: Z = 9, 18, ..., 288
+static constexpr int16_t nrBg1Ils4[46 * 68] = {
+    211, 198, 188, 186, _, 219, 4, _, _, 29, 144, 116, 216, 115, _, 233, 144, _, 95, 216, 73, 261, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    179, _, 162, 223, 256, 160, _, 76, 202, 117, _, 109, 15, _, 72, 152, 158, 147, _, 156, _, 119, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    258, 167, 220, _, 133, 243, 202, 218, 63, 0, 3, _, _, 74, 229, 0, _, 216, 269, 200, 234, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    187, 145, _, 166, 108, _, 82, 132, 197, _, 41, 162, 57, 36, 115, _, 242, 165, 0, _, 113, 108, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    246, 235, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    261, 181, _, 72, _, _, _, _, _, _, _, _, 283, _, _, _, 254, _, _, _, _, 79, 144, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    80, _, _, _, _, _, 144, _, _, _, 169, 90, _, 59, _, _, _, 177, 151, _, 108, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    169, 189, _, _, 154, _, _, 184, 104, _, _, _, _, _, 164, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    54, 0, _, 252, _, _, _, _, _, _, _, _, 41, _, _, _, 98, _, _, 46, _, 15, 230, _, 54, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    162, 159, _, _, _, _, _, _, _, _, 93, 134, _, 45, _, _, _, 132, 76, _, 209, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 178, 1, _, 28, _, _, 267, 234, _, _, _, _, _, 201, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    55, 23, _, _, _, _, _, _, _, _, _, _, 274, _, _, _, 181, _, _, _, _, 273, 39, 26, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    225, 162, _, _, _, _, _, _, _, _, 244, 151, _, 238, _, _, _, _, 243, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    231, _, _, 0, _, _, _, 216, _, _, _, _, _, _, _, _, _, _, _, _, 47, _, _, 36, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, _, _, _, _, _, _, 186, _, _, 253, 16, 0, _, _, _, 79, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    170, 0, _, _, _, _, _, _, _, _, 183, _, _, 108, _, _, _, _, 68, _, _, _, _, _, _, 64, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 270, _, 13, _, _, _, _, _, _, _, 99, _, _, _, _, _, _, _, _, 54, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    153, _, _, _, _, _, _, _, _, _, _, _, _, _, 137, _, 0, 0, _, _, _, 162, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 161, _, _, _, _, _, _, _, _, _, _, 151, 0, _, _, _, _, 241, 144, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, 0, _, _, _, _, _, 118, 144, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    265, _, _, 81, _, _, _, _, _, 90, _, 144, _, _, _, _, _, _, _, _, _, _, 228, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 64, _, _, _, 46, _, _, _, _, _, _, _, _, _, _, 266, _, _, _, 9, 18, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    72, _, _, _, _, _, _, _, _, _, _, _, 189, 72, _, _, _, 257, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 180, 0, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, 165, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    236, _, _, 199, 0, _, _, _, _, _, _, 266, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 205, _, _, _, _, 0, 0, _, _, _, _, _, _, 183, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, 0, _, 0, _, _, _, _, _, _, _, _, _, _, 277, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 45, _, _, _, _, 36, _, 72, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    275, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 155, _, 62, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, _, _, _, _, _, _, _, _, _, _, _, 180, _, _, _, 0, _, _, _, _, _, _, 42, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, _, _, _, _, 90, _, _, 252, _, _, _, _, _, _, _, _, _, _, 173, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 144, _, _, _, _, _, 144, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 166, _, _, 19, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, _, _, _, _, _, _, 211, _, 36, _, _, _, _, _, _, _, _, _, 162, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, 0, _, _, _, _, _, _, _, _, 76, _, _, _, _, _, _, _, _, _, 18, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    197, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, 108, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 199, _, _, _, _, 278, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, 205, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    216, _, _, _, _, _, _, _, _, _, _, _, _, _, 16, 0, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, 72, _, _, _, _, _, _, _, _, _, _, _, 144, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    190, _, _, _, _, _, _, _, _, 0, 0, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 153, _, 0, _, _, _, 165, _, _, _, _, _, _, _, _, _, _, _, 117, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    216, _, _, _, _, _, _, _, 144, _, _, _, _, _, _, _, _, 2, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, 0, _, 0, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, 183, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    27, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 35, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    _, 52, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 243, _, 0, _, _, _, _, _, _, 270, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    18, _, _, _, _, _, _, 0, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, 57, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 168, _, _, _, _, 0, _, _, _, 144, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-2, base graph 1, iLS 5: Z = 11, 22, ..., 352
+static constexpr int16_t nrBg1Ils5[46 * 68] = {
+    294, 118, 167, 330, _, 207, 165, _, _, 243, 250, 1, 339, 201, _, 53, 347, _, 304, 167, 47, 188, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    77, _, 225, 96, 338, 268, _, 112, 302, 50, _, 167, 253, _, 334, 242, 257, 133, _, 9, _, 302, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    226, 35, 213, _, 302, 111, 265, 128, 237, 294, 127, _, _, 110, 286, 125, _, 131, 163, 210, 7, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    97, 94, _, 49, 279, _, 139, 166, 91, _, 106, 246, 345, 269, 185, _, 249, 215, 143, _, 121, 121, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    42, 256, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    219, 130, _, 251, _, _, _, _, _, _, _, _, 322, _, _, _, 295, _, _, _, _, 258, 283, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    294, _, _, _, _, _, 73, _, _, _, 330, 99, _, 172, _, _, _, 150, 284, _, 305, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    3, 103, _, _, 224, _, _, 297, 215, _, _, _, _, _, 39, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    348, 75, _, 22, _, _, _, _, _, _, _, _, 312, _, _, _, 224, _, _, 17, _, 59, 314, _, 244, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    156, 88, _, _, _, _, _, _, _, _, 293, 111, _, 92, _, _, _, 152, 23, _, 337, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 175, 253, _, 27, _, _, 231, 49, _, _, _, _, _, 267, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    25, 322, _, _, _, _, _, _, _, _, _, _, 200, _, _, _, 351, _, _, _, _, 166, 338, 192, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    123, 217, _, _, _, _, _, _, _, _, 142, 110, _, 176, _, _, _, _, 76, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    311, _, _, 251, _, _, _, 265, _, _, _, _, _, _, _, _, _, _, _, _, 94, _, _, 81, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    22, _, _, _, _, _, _, _, _, _, _, _, 322, _, _, 277, 156, 66, _, _, _, 78, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    176, 348, _, _, _, _, _, _, _, _, 15, _, _, 81, _, _, _, _, 176, _, _, _, _, _, _, 113, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 190, _, 293, _, _, _, _, _, _, _, 332, _, _, _, _, _, _, _, _, 331, _, 114, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    110, _, _, _, _, _, _, _, _, _, _, _, _, _, 228, _, 247, 116, _, _, _, 190, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 47, _, _, _, _, _, _, _, _, _, _, 286, 246, _, _, _, _, 181, 73, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    87, 110, _, _, _, _, _, 147, 258, _, 204, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    89, _, _, 65, _, _, _, _, _, 155, _, 244, _, _, _, _, _, _, _, _, _, _, 30, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 162, _, _, _, 264, _, _, _, _, _, _, _, _, _, _, 346, _, _, _, 143, 109, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    280, _, _, _, _, _, _, _, _, _, _, _, 157, 236, _, _, _, 113, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 18, 6, _, _, _, _, _, _, _, 181, _, _, _, _, _, _, _, 304, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    38, _, _, 170, 249, _, _, _, _, _, _, 288, _, _, _, _, _, _, _, _, _, _, 194, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 279, _, _, _, _, 255, 111, _, _, _, _, _, _, 54, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    325, _, 326, _, 226, _, _, _, _, _, _, _, _, _, _, 99, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 91, _, _, _, _, 326, _, 268, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    102, _, _, _, 1, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 40, _, 167, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 273, _, _, _, _, _, _, _, _, _, _, _, _, 104, _, _, _, 243, _, _, _, _, _, _, 107, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    171, _, _, _, _, _, _, _, _, _, 16, _, _, 95, _, _, _, _, _, _, _, _, _, _, 212, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 101, _, _, _, _, _, 297, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 279, _, _, 222, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    351, _, _, _, _, _, _, _, _, _, _, _, 265, _, 338, _, _, _, _, _, _, _, _, _, 83, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 56, 304, _, _, _, _, _, _, _, _, 141, _, _, _, _, _, _, _, _, _, 101, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    60, _, _, _, _, _, _, 320, _, _, _, _, _, _, _, 112, _, 54, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 100, _, _, _, _, 210, _, _, _, _, _, 195, _, _, _, _, _, _, _, _, _, 268, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    135, _, _, _, _, _, _, _, _, _, _, _, _, _, 15, 35, _, _, 188, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, 319, _, _, _, _, _, _, _, _, _, _, _, 236, _, _, _, _, _, _, _, _, _, 85, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    164, _, _, _, _, _, _, _, _, 196, 209, _, 246, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 236, _, 264, _, _, _, 37, _, _, _, _, _, _, _, _, _, _, _, 272, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    304, _, _, _, _, _, _, _, 237, _, _, _, _, _, _, _, _, 135, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, 123, _, 77, _, _, _, _, _, 25, _, _, _, _, _, _, _, _, 272, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    288, _, _, _, 83, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 17, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    _, 210, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 3, _, 53, _, _, _, _, _, _, 167, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    79, _, _, _, _, _, _, 244, _, 293, _, _, _, _, _, _, _, _, _, _, _, _, 272, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 82, _, _, _, _, 67, _, _, _, 235, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-2, base graph 1, iLS 6: Z = 13, 26, ..., 208
+static constexpr int16_t nrBg1Ils6[46 * 68] = {
+    0, 0, 0, 0, _, 0, 0, _, _, 0, 0, 0, 0, 0, _, 0, 0, _, 0, 0, 0, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    22, _, 11, 124, 0, 10, _, 0, 0, 2, _, 16, 60, _, 0, 6, 30, 0, _, 168, _, 31, 105, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    132, 37, 21, _, 180, 4, 149, 48, 38, 122, 195, _, _, 155, 28, 85, _, 47, 179, 42, 66, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    4, 6, _, 33, 113, _, 49, 21, 6, _, 151, 83, 154, 87, 5, _, 92, 173, 120, _, 2, 142, 0, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    24, 204, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    185, 100, _, 24, _, _, _, _, _, _, _, _, 65, _, _, _, 207, _, _, _, _, 161, 72, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    6, _, _, _, _, _, 27, _, _, _, 163, 50, _, 48, _, _, _, 24, 38, _, 91, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    145, 88, _, _, 112, _, _, 153, 159, _, _, _, _, _, 76, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    172, 2, _, 131, _, _, _, _, _, _, _, _, 141, _, _, _, 96, _, _, 99, _, 101, 35, _, 116, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    6, 10, _, _, _, _, _, _, _, _, 145, 53, _, 201, _, _, _, 4, 164, _, 173, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 126, 77, _, 156, _, _, 16, 12, _, _, _, _, _, 70, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    184, 194, _, _, _, _, _, _, _, _, _, _, 123, _, _, _, 16, _, _, _, _, 104, 109, 124, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    6, 20, _, _, _, _, _, _, _, _, 203, 153, _, 104, _, _, _, _, 207, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    52, _, _, 147, _, _, _, 1, _, _, _, _, _, _, _, _, _, _, _, _, 16, _, _, 46, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    1, _, _, _, _, _, _, _, _, _, _, _, 202, _, _, 118, 130, 1, _, _, _, 2, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    173, 6, _, _, _, _, _, _, _, _, 81, _, _, 182, _, _, _, _, 53, _, _, _, _, _, _, 46, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 88, _, 198, _, _, _, _, _, _, _, 160, _, _, _, _, _, _, _, _, 122, _, 182, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    91, _, _, _, _, _, _, _, _, _, _, _, _, _, 184, _, 30, 3, _, _, _, 155, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 1, _, _, _, _, _, _, _, _, _, _, 41, 167, _, _, _, _, 68, 148, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    12, 6, _, _, _, _, _, 166, 184, _, 191, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    6, _, _, 12, _, _, _, _, _, 15, _, 5, _, _, _, _, _, _, _, _, _, _, 30, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 6, _, _, _, 86, _, _, _, _, _, _, _, _, _, _, 96, _, _, _, 42, 199, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    44, _, _, _, _, _, _, _, _, _, _, _, 58, 130, _, _, _, 131, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 45, 18, _, _, _, _, _, _, _, 132, _, _, _, _, _, _, _, 100, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    9, _, _, 125, 191, _, _, _, _, _, _, 28, _, _, _, _, _, _, _, _, _, _, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 4, _, _, _, _, 74, 16, _, _, _, _, _, _, 28, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    21, _, 142, _, 192, _, _, _, _, _, _, _, _, _, _, 197, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 98, _, _, _, _, 140, _, 22, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    4, _, _, _, 1, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 40, _, 93, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 92, _, _, _, _, _, _, _, _, _, _, _, _, 136, _, _, _, 106, _, _, _, _, _, _, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    2, _, _, _, _, _, _, _, _, _, 88, _, _, 112, _, _, _, _, _, _, _, _, _, _, 20, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 4, _, _, _, _, _, 49, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 125, _, _, 194, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    6, _, _, _, _, _, _, _, _, _, _, _, 126, _, 63, _, _, _, _, _, _, _, _, _, 20, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 10, 30, _, _, _, _, _, _, _, _, 6, _, _, _, _, _, _, _, _, _, 92, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    4, _, _, _, _, _, _, 153, _, _, _, _, _, _, _, 197, _, 155, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 4, _, _, _, _, 45, _, _, _, _, _, 168, _, _, _, _, _, _, _, _, _, 185, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    6, _, _, _, _, _, _, _, _, _, _, _, _, _, 200, 177, _, _, 43, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, 82, _, _, _, _, _, _, _, _, _, _, _, 2, _, _, _, _, _, _, _, _, _, 135, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    91, _, _, _, _, _, _, _, _, 64, 198, _, 100, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 4, _, 28, _, _, _, 109, _, _, _, _, _, _, _, _, _, _, _, 188, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    10, _, _, _, _, _, _, _, 84, _, _, _, _, _, _, _, _, 12, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, 2, _, 75, _, _, _, _, _, 142, _, _, _, _, _, _, _, _, 128, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    163, _, _, _, 10, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 162, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    _, 1, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 163, _, 99, _, _, _, _, _, _, 98, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    4, _, _, _, _, _, _, 6, _, 142, _, _, _, _, _, _, _, _, _, _, _, _, 3, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 181, _, _, _, _, 45, _, _, _, 153, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-2, base graph 1, iLS 7: Z = 15, 30, ..., 240
+static constexpr int16_t nrBg1Ils7[46 * 68] = {
+    135, 227, 126, 134, _, 84, 83, _, _, 53, 225, 205, 128, 75, _, 135, 217, _, 220, 90, 105, 137, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    96, _, 236, 136, 221, 128, _, 92, 172, 56, _, 11, 189, _, 95, 85, 153, 87, _, 163, _, 216, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    189, 4, 225, _, 151, 236, 117, 179, 92, 24, 68, _, _, 6, 101, 33, _, 96, 125, 67, 230, _, _, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    128, 23, _, 162, 220, _, 43, 186, 96, _, 1, 216, 22, 24, 167, _, 200, 32, 235, _, 172, 219, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    64, 211, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    2, 171, _, 47, _, _, _, _, _, _, _, _, 143, _, _, _, 210, _, _, _, _, 180, 180, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    199, _, _, _, _, _, 22, _, _, _, 23, 100, _, 92, _, _, _, 207, 52, _, 13, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    77, 146, _, _, 209, _, _, 32, 166, _, _, _, _, _, 18, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    181, 105, _, 141, _, _, _, _, _, _, _, _, 223, _, _, _, 177, _, _, 145, _, 199, 153, _, 38, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    169, 12, _, _, _, _, _, _, _, _, 206, 221, _, 17, _, _, _, 212, 92, _, 205, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 116, 151, _, 70, _, _, 230, 115, _, _, _, _, _, 84, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    45, 115, _, _, _, _, _, _, _, _, _, _, 134, _, _, _, 1, _, _, _, _, 152, 165, 107, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    186, 215, _, _, _, _, _, _, _, _, 124, 180, _, 98, _, _, _, _, 80, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    220, _, _, 185, _, _, _, 154, _, _, _, _, _, _, _, _, _, _, _, _, 178, _, _, 150, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    124, _, _, _, _, _, _, _, _, _, _, _, 144, _, _, 182, 95, 72, _, _, _, 76, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    39, 138, _, _, _, _, _, _, _, _, 220, _, _, 173, _, _, _, _, 142, _, _, _, _, _, _, 49, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 78, _, 152, _, _, _, _, _, _, _, 84, _, _, _, _, _, _, _, _, 5, _, 205, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    183, _, _, _, _, _, _, _, _, _, _, _, _, _, 112, _, 106, 219, _, _, _, 129, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 183, _, _, _, _, _, _, _, _, _, _, 215, 180, _, _, _, _, 143, 14, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    179, 108, _, _, _, _, _, 159, 138, _, 196, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    77, _, _, 187, _, _, _, _, _, 203, _, 167, _, _, _, _, _, _, _, _, _, _, 130, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 197, _, _, _, 122, _, _, _, _, _, _, _, _, _, _, 215, _, _, _, 65, 216, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    25, _, _, _, _, _, _, _, _, _, _, _, 47, 126, _, _, _, 178, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 185, 127, _, _, _, _, _, _, _, 117, _, _, _, _, _, _, _, 199, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    32, _, _, 178, 2, _, _, _, _, _, _, 156, _, _, _, _, _, _, _, _, _, _, 58, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 27, _, _, _, _, 141, 11, _, _, _, _, _, _, 181, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    163, _, 131, _, 169, _, _, _, _, _, _, _, _, _, _, 98, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 165, _, _, _, _, 232, _, 9, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    32, _, _, _, 43, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 200, _, 205, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 232, _, _, _, _, _, _, _, _, _, _, _, _, 32, _, _, _, 118, _, _, _, _, _, _, 103, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    170, _, _, _, _, _, _, _, _, _, 199, _, _, 26, _, _, _, _, _, _, _, _, _, _, 105, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 73, _, _, _, _, _, 149, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 175, _, _, 108, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    103, _, _, _, _, _, _, _, _, _, _, _, 110, _, 151, _, _, _, _, _, _, _, _, _, 211, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 199, 132, _, _, _, _, _, _, _, _, 172, _, _, _, _, _, _, _, _, _, 65, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    161, _, _, _, _, _, _, 237, _, _, _, _, _, _, _, 142, _, 180, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 231, _, _, _, _, 174, _, _, _, _, _, 145, _, _, _, _, _, _, _, _, _, 100, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    11, _, _, _, _, _, _, _, _, _, _, _, _, _, 207, 42, _, _, 100, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, 59, _, _, _, _, _, _, _, _, _, _, _, 204, _, _, _, _, _, _, _, _, _, 161, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    121, _, _, _, _, _, _, _, _, 90, 26, _, 140, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 115, _, 188, _, _, _, 168, _, _, _, _, _, _, _, _, _, _, _, 52, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    4, _, _, _, _, _, _, _, 103, _, _, _, _, _, _, _, _, 30, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, 53, _, 189, _, _, _, _, _, 215, _, _, _, _, _, _, _, _, 24, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    222, _, _, _, 170, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 71, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    _, 22, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 127, _, 49, _, _, _, _, _, _, 125, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    191, _, _, _, _, _, _, 211, _, 187, _, _, _, _, _, _, _, _, _, _, _, _, 148, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 177, _, _, _, _, 114, _, _, _, 93, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-3, base graph 2, iLS 0: Z = 2, 4, ..., 256
+static constexpr int16_t nrBg2Ils0[42 * 52] = {
+    9, 117, 204, 26, _, _, 189, _, _, 205, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    167, _, _, 166, 253, 125, 226, 156, 224, 252, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    81, 114, _, 44, 52, _, _, _, 240, _, 1, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 8, 58, _, 158, 104, 209, 54, 18, 128, 0, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    179, 214, _, _, _, _, _, _, _, _, _, 71, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    231, 41, _, _, _, 194, _, 159, _, _, _, 103, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    155, _, _, _, _, 228, _, 45, _, 28, _, 158, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 129, _, _, _, 147, _, 140, _, _, _, 3, _, 116, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    142, 94, _, _, _, _, _, _, _, _, _, _, 230, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 203, _, _, _, _, _, _, 205, _, 61, 247, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    11, 185, _, _, _, _, 0, 117, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    11, _, _, _, _, _, _, 236, _, 210, _, _, _, 56, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 63, _, 111, _, _, _, _, _, _, _, 14, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    83, 2, _, _, _, _, _, _, 38, _, _, _, _, 222, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 115, _, _, _, _, 145, _, _, _, _, 3, _, 232, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    51, _, _, _, _, _, _, _, _, _, 175, 213, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 203, _, _, _, _, _, _, _, 142, _, 8, 242, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 254, _, _, _, 124, _, _, _, _, _, 114, 64, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    220, _, _, _, _, _, 194, 50, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    87, 20, _, _, _, _, _, _, _, _, 185, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 26, _, _, 105, _, _, _, _, _, _, 29, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    76, _, _, _, _, _, _, _, 42, _, _, _, _, 210, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 222, 63, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    23, _, _, 235, _, 238, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 46, 139, _, _, _, _, _, _, 8, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    228, _, _, _, _, 156, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 29, _, _, _, _, 143, _, _, _, _, 160, 122, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    8, _, _, _, _, _, 151, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 98, 101, _, _, 135, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    18, _, _, _, 28, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 71, _, _, 240, _, 9, _, 84, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 106, _, _, _, _, _, _, _, _, _, _, _, 1, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    242, _, _, _, _, 44, _, _, _, _, _, _, 166, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, _, 132, _, _, _, _, 164, _, _, 235, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    147, _, _, _, _, _, _, _, _, _, _, _, 85, 36, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 57, _, _, _, 40, _, _, _, _, _, 63, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    140, _, 38, _, _, _, _, 154, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, _, _, _, _, _, _, _, _, _, 219, _, _, 151, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    _, 31, _, _, _, 66, _, _, _, _, _, 38, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    239, _, _, _, _, _, _, 172, _, _, _, _, 34, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    _, _, 0, _, _, _, _, _, _, _, 75, _, _, 120, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 129, _, _, _, 229, _, _, _, _, _, 118, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-3, base graph 2, iLS 1: Z = 3, 6, ..., 384
+static constexpr int16_t nrBg2Ils1[42 * 52] = {
+    174, 97, 166, 66, _, _, 71, _, _, 172, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    27, _, _, 36, 48, 92, 31, 187, 185, 3, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    25, 114, _, 117, 110, _, _, _, 114, _, 1, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 136, 175, _, 113, 72, 123, 118, 28, 186, 0, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    72, 74, _, _, _, _, _, _, _, _, _, 29, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    10, 44, _, _, _, 121, _, 80, _, _, _, 48, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    129, _, _, _, _, 92, _, 100, _, 49, _, 184, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 80, _, _, _, 186, _, 16, _, _, _, 102, _, 143, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    118, 70, _, _, _, _, _, _, _, _, _, _, 152, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 28, _, _, _, _, _, _, 132, _, 185, 178, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    59, 104, _, _, _, _, 22, 52, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    32, _, _, _, _, _, _, 92, _, 174, _, _, _, 154, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 39, _, 93, _, _, _, _, _, _, _, 11, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    49, 125, _, _, _, _, _, _, 35, _, _, _, _, 166, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 19, _, _, _, _, 118, _, _, _, _, 21, _, 163, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    68, _, _, _, _, _, _, _, _, _, 63, 81, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 87, _, _, _, _, _, _, _, 177, _, 135, 64, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 158, _, _, _, 23, _, _, _, _, _, 9, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    186, _, _, _, _, _, 6, 46, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    58, 42, _, _, _, _, _, _, _, _, 156, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 76, _, _, 61, _, _, _, _, _, _, 153, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    157, _, _, _, _, _, _, _, 175, _, _, _, _, 67, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 20, 52, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    106, _, _, 86, _, 95, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 182, 153, _, _, _, _, _, _, 64, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    45, _, _, _, _, 21, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 67, _, _, _, _, 137, _, _, _, _, 55, 85, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    103, _, _, _, _, _, 50, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 70, 111, _, _, 168, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    110, _, _, _, 17, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 120, _, _, 154, _, 52, _, 56, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 3, _, _, _, _, _, _, _, _, _, _, _, 170, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    84, _, _, _, _, 8, _, _, _, _, _, _, 17, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, _, 165, _, _, _, _, 179, _, _, 124, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    173, _, _, _, _, _, _, _, _, _, _, _, 177, 12, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 77, _, _, _, 184, _, _, _, _, _, 18, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    25, _, 151, _, _, _, _, 170, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, _, _, _, _, _, _, _, _, _, 37, _, _, 31, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    _, 84, _, _, _, 151, _, _, _, _, _, 190, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    93, _, _, _, _, _, _, 132, _, _, _, _, 57, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    _, _, 103, _, _, _, _, _, _, _, 107, _, _, 163, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 147, _, _, _, 7, _, _, _, _, _, 60, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-3, base graph 2, iLS 2: Z = 5, 10, ..., 320
+static constexpr int16_t nrBg2Ils2[42 * 52] = {
+    0, 0, 0, 0, _, _, 0, _, _, 0, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    137, _, _, 124, 0, 0, 88, 0, 0, 55, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    20, 94, _, 99, 9, _, _, _, 108, _, 1, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 38, 15, _, 102, 146, 12, 57, 53, 46, 0, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, 136, _, _, _, _, _, _, _, _, _, 157, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, 131, _, _, _, 142, _, 141, _, _, _, 64, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, 124, _, 99, _, 45, _, 148, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, _, _, 45, _, 148, _, _, _, 96, _, 78, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, 65, _, _, _, _, _, _, _, _, _, _, 87, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, _, _, _, _, _, 97, _, 51, 85, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, 17, _, _, _, _, 156, 20, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, _, 7, _, 4, _, _, _, 2, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, 113, _, _, _, _, _, _, _, 48, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, 112, _, _, _, _, _, _, 102, _, _, _, _, 26, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, _, _, _, 138, _, _, _, _, 57, _, 27, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, _, _, _, _, 73, 99, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, _, _, _, _, _, _, 79, _, 111, 143, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, _, _, 24, _, _, _, _, _, 109, 18, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, 18, 86, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, 158, _, _, _, _, _, _, _, _, 154, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, _, 148, _, _, _, _, _, _, 104, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, _, _, 17, _, _, _, _, 33, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, 4, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, 75, _, 158, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, 69, _, _, _, _, _, _, 87, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, 65, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 0, _, _, _, _, 100, _, _, _, _, 13, 7, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, 32, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, 126, _, _, 110, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, 154, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 0, _, _, 35, _, 51, _, 134, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 0, _, _, _, _, _, _, _, _, _, _, _, 20, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, 20, _, _, _, _, _, _, 122, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, _, 0, _, _, _, _, 88, _, _, 13, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    0, _, _, _, _, _, _, _, _, _, _, _, 19, 78, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 0, _, _, _, 157, _, _, _, _, _, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    0, _, 63, _, _, _, _, 82, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, _, _, _, _, _, _, _, _, _, 0, _, _, 144, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    _, 0, _, _, _, 93, _, _, _, _, _, 19, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    0, _, _, _, _, _, _, 24, _, _, _, _, 138, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    _, _, 0, _, _, _, _, _, _, _, 36, _, _, 143, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 0, _, _, _, 2, _, _, _, _, _, 55, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-3, base graph 2, iLS 3: Z = 7, 14, ..., 224
+static constexpr int16_t nrBg2Ils3[42 * 52] = {
+    72, 110, 23, 181, _, _, 95, _, _, 8, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    53, _, _, 156, 115, 156, 115, 200, 29, 31, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    152, 131, _, 46, 191, _, _, _, 91, _, 0, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 185, 6, _, 36, 124, 124, 110, 156, 133, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    200, 16, _, _, _, _, _, _, _, _, _, 101, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    185, 138, _, _, _, 170, _, 219, _, _, _, 193, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    123, _, _, _, _, 55, _, 31, _, 222, _, 209, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 103, _, _, _, 13, _, 105, _, _, _, 150, _, 181, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    147, 43, _, _, _, _, _, _, _, _, _, _, 152, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 2, _, _, _, _, _, _, 30, _, 184, 83, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    174, 150, _, _, _, _, 8, 56, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    99, _, _, _, _, _, _, 138, _, 110, _, _, _, 99, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 46, _, 217, _, _, _, _, _, _, _, 109, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    37, 113, _, _, _, _, _, _, 143, _, _, _, _, 140, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 36, _, _, _, _, 95, _, _, _, _, 40, _, 116, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    116, _, _, _, _, _, _, _, _, _, 200, 110, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 75, _, _, _, _, _, _, _, 158, _, 134, 97, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 48, _, _, _, 132, _, _, _, _, _, 206, 2, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    68, _, _, _, _, _, 16, 156, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    35, 138, _, _, _, _, _, _, _, _, 86, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 6, _, _, 20, _, _, _, _, _, _, 141, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    80, _, _, _, _, _, _, _, 43, _, _, _, _, 81, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 49, 1, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    156, _, _, 54, _, 134, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 153, 88, _, _, _, _, _, _, 63, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    211, _, _, _, _, 94, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 90, _, _, _, _, 6, _, _, _, _, 221, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    27, _, _, _, _, _, 118, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 216, 212, _, _, 193, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    108, _, _, _, 61, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 106, _, _, 44, _, 185, _, 176, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 147, _, _, _, _, _, _, _, _, _, _, _, 182, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    108, _, _, _, _, 21, _, _, _, _, _, _, 110, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, _, 71, _, _, _, _, 12, _, _, 109, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    29, _, _, _, _, _, _, _, _, _, _, _, 201, 69, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 91, _, _, _, 165, _, _, _, _, _, 55, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    1, _, 175, _, _, _, _, 83, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, _, _, _, _, _, _, _, _, _, 40, _, _, 12, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    _, 37, _, _, _, 97, _, _, _, _, _, 46, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    106, _, _, _, _, _, _, 181, _, _, _, _, 154, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    _, _, 98, _, _, _, _, _, _, _, 35, _, _, 36, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 120, _, _, _, 101, _, _, _, _, _, 81, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-3, base graph 2, iLS 4: Z = 9, 18, ..., 288
+static constexpr int16_t nrBg2Ils4[42 * 52] = {
+    3, 26, 53, 35, _, _, 115, _, _, 127, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    19, _, _, 94, 104, 66, 84, 98, 69, 50, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    95, 106, _, 92, 110, _, _, _, 111, _, 1, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 120, 121, _, 22, 4, 73, 49, 128, 79, 0, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    42, 24, _, _, _, _, _, _, _, _, _, 51, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    40, 140, _, _, _, 84, _, 137, _, _, _, 71, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    109, _, _, _, _, 87, _, 107, _, 133, _, 139, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 97, _, _, _, 135, _, 35, _, _, _, 108, _, 65, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    70, 69, _, _, _, _, _, _, _, _, _, _, 88, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 97, _, _, _, _, _, _, 40, _, 24, 49, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    46, 41, _, _, _, _, 101, 96, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    28, _, _, _, _, _, _, 30, _, 116, _, _, _, 64, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 33, _, 122, _, _, _, _, _, _, _, 131, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    76, 37, _, _, _, _, _, _, 62, _, _, _, _, 47, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 143, _, _, _, _, 51, _, _, _, _, 130, _, 97, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    139, _, _, _, _, _, _, _, _, _, 96, 128, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 48, _, _, _, _, _, _, _, 9, _, 28, 8, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 120, _, _, _, 43, _, _, _, _, _, 65, 42, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    17, _, _, _, _, _, 106, 142, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    79, 28, _, _, _, _, _, _, _, _, 41, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 2, _, _, 103, _, _, _, _, _, _, 78, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    91, _, _, _, _, _, _, _, 75, _, _, _, _, 81, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 54, 132, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    68, _, _, 115, _, 56, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 30, 42, _, _, _, _, _, _, 101, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    128, _, _, _, _, 63, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 142, _, _, _, _, 28, _, _, _, _, 100, 133, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    13, _, _, _, _, _, 10, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 106, 77, _, _, 43, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    133, _, _, _, 25, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 87, _, _, 56, _, 104, _, 70, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 80, _, _, _, _, _, _, _, _, _, _, _, 139, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    32, _, _, _, _, 89, _, _, _, _, _, _, 71, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, _, 106, _, _, _, _, 6, _, _, 2, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    37, _, _, _, _, _, _, _, _, _, _, _, 25, 114, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 60, _, _, _, 137, _, _, _, _, _, 93, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    121, _, 129, _, _, _, _, 26, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, _, _, _, _, _, _, _, _, _, 97, _, _, 56, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    _, 1, _, _, _, 70, _, _, _, _, _, 1, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    119, _, _, _, _, _, _, 32, _, _, _, _, 142, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    _, _, 6, _, _, _, _, _, _, _, 73, _, _, 102, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 48, _, _, _, 47, _, _, _, _, _, 19, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-3, base graph 2, iLS 5: Z = 11, 22, ..., 352
+static constexpr int16_t nrBg2Ils5[42 * 52] = {
+    156, 143, 14, 3, _, _, 40, _, _, 123, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    17, _, _, 65, 63, 1, 55, 37, 171, 133, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    98, 168, _, 107, 82, _, _, _, 142, _, 1, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 53, 174, _, 174, 127, 17, 89, 17, 105, 0, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    86, 67, _, _, _, _, _, _, _, _, _, 83, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    79, 84, _, _, _, 35, _, 103, _, _, _, 60, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    47, _, _, _, _, 154, _, 10, _, 155, _, 29, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 48, _, _, _, 125, _, 24, _, _, _, 47, _, 55, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    53, 31, _, _, _, _, _, _, _, _, _, _, 161, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 104, _, _, _, _, _, _, 142, _, 99, 64, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    111, 25, _, _, _, _, 174, 23, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    91, _, _, _, _, _, _, 175, _, 24, _, _, _, 141, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 122, _, 11, _, _, _, _, _, _, _, 4, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    29, 91, _, _, _, _, _, _, 27, _, _, _, _, 127, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 11, _, _, _, _, 145, _, _, _, _, 8, _, 166, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    137, _, _, _, _, _, _, _, _, _, 103, 40, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 78, _, _, _, _, _, _, _, 158, _, 17, 165, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 134, _, _, _, 23, _, _, _, _, _, 62, 163, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    173, _, _, _, _, _, 31, 22, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    13, 135, _, _, _, _, _, _, _, _, 145, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 128, _, _, 52, _, _, _, _, _, _, 173, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    156, _, _, _, _, _, _, _, 166, _, _, _, _, 40, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 18, 163, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    110, _, _, 132, _, 150, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 113, 108, _, _, _, _, _, _, 61, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    72, _, _, _, _, 136, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 36, _, _, _, _, 38, _, _, _, _, 53, 145, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    42, _, _, _, _, _, 104, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 64, 24, _, _, 149, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    139, _, _, _, 161, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 84, _, _, 173, _, 93, _, 29, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 117, _, _, _, _, _, _, _, _, _, _, _, 148, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    116, _, _, _, _, 73, _, _, _, _, _, _, 142, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, _, 29, _, _, _, _, 137, _, _, 29, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    11, _, _, _, _, _, _, _, _, _, _, _, 41, 162, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 126, _, _, _, 152, _, _, _, _, _, 172, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    73, _, 154, _, _, _, _, 129, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, _, _, _, _, _, _, _, _, _, 167, _, _, 38, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    _, 112, _, _, _, 7, _, _, _, _, _, 19, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    109, _, _, _, _, _, _, 6, _, _, _, _, 105, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    _, _, 160, _, _, _, _, _, _, _, 156, _, _, 82, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 132, _, _, _, 6, _, _, _, _, _, 8, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-3, base graph 2, iLS 6: Z = 13, 26, ..., 208
+static constexpr int16_t nrBg2Ils6[42 * 52] = {
+    143, 19, 176, 165, _, _, 196, _, _, 13, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    18, _, _, 27, 3, 102, 185, 17, 14, 180, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    126, 163, _, 47, 183, _, _, _, 132, _, 1, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 36, 48, _, 18, 111, 203, 3, 191, 160, 0, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    43, 27, _, _, _, _, _, _, _, _, _, 117, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    136, 49, _, _, _, 36, _, 132, _, _, _, 62, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    7, _, _, _, _, 34, _, 198, _, 168, _, 12, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 163, _, _, _, 78, _, 143, _, _, _, 107, _, 58, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    101, 177, _, _, _, _, _, _, _, _, _, _, 22, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 186, _, _, _, _, _, _, 27, _, 205, 81, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    125, 60, _, _, _, _, 177, 51, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    39, _, _, _, _, _, _, 29, _, 35, _, _, _, 8, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 18, _, 155, _, _, _, _, _, _, _, 49, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    32, 53, _, _, _, _, _, _, 95, _, _, _, _, 186, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 91, _, _, _, _, 20, _, _, _, _, 52, _, 109, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    174, _, _, _, _, _, _, _, _, _, 108, 102, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 125, _, _, _, _, _, _, _, 31, _, 54, 176, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 57, _, _, _, 201, _, _, _, _, _, 142, 35, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    129, _, _, _, _, _, 203, 140, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    110, 124, _, _, _, _, _, _, _, _, 52, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 196, _, _, 35, _, _, _, _, _, _, 114, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    10, _, _, _, _, _, _, _, 122, _, _, _, _, 23, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 202, 126, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    52, _, _, 170, _, 13, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 113, 161, _, _, _, _, _, _, 88, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    197, _, _, _, _, 194, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 164, _, _, _, _, 172, _, _, _, _, 49, 161, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    168, _, _, _, _, _, 193, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 14, 186, _, _, 46, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    50, _, _, _, 27, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 70, _, _, 17, _, 50, _, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 115, _, _, _, _, _, _, _, _, _, _, _, 189, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    110, _, _, _, _, 0, _, _, _, _, _, _, 163, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, _, 158, _, _, _, _, 173, _, _, 179, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    197, _, _, _, _, _, _, _, _, _, _, _, 191, 193, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 157, _, _, _, 167, _, _, _, _, _, 181, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    197, _, 167, _, _, _, _, 179, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, _, _, _, _, _, _, _, _, _, 181, _, _, 193, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    _, 157, _, _, _, 173, _, _, _, _, _, 191, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    181, _, _, _, _, _, _, 157, _, _, _, _, 173, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    _, _, 193, _, _, _, _, _, _, _, 163, _, _, 179, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 191, _, _, _, 197, _, _, _, _, _, 167, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+// 3GPP TS 38.212 Table 5.3.2-3, base graph 2, iLS 7: Z = 15, 30, ..., 240
+static constexpr int16_t nrBg2Ils7[42 * 52] = {
+    145, 131, 71, 21, _, _, 23, _, _, 112, 1, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    142, _, _, 174, 183, 27, 96, 23, 9, 167, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    74, 31, _, 3, 53, _, _, _, 155, _, 0, _, 0, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 239, 171, _, 95, 110, 159, 199, 43, 75, 1, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    29, 140, _, _, _, _, _, _, _, _, _, 180, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    121, 41, _, _, _, 169, _, 88, _, _, _, 207, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    137, _, _, _, _, 72, _, 172, _, 124, _, 56, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 86, _, _, _, 186, _, 87, _, _, _, 172, _, 154, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    176, 169, _, _, _, _, _, _, _, _, _, _, 225, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 167, _, _, _, _, _, _, 238, _, 48, 68, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    38, 217, _, _, _, _, 208, 232, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    178, _, _, _, _, _, _, 214, _, 168, _, _, _, 51, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 124, _, 122, _, _, _, _, _, _, _, 72, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    48, 57, _, _, _, _, _, _, 167, _, _, _, _, 219, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 82, _, _, _, _, 232, _, _, _, _, 204, _, 162, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    38, _, _, _, _, _, _, _, _, _, 217, 157, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 170, _, _, _, _, _, _, _, 23, _, 175, 202, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 196, _, _, _, 173, _, _, _, _, _, 195, 218, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    128, _, _, _, _, _, 211, 210, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    39, 84, _, _, _, _, _, _, _, _, 88, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 117, _, _, 227, _, _, _, _, _, _, 6, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    238, _, _, _, _, _, _, _, 13, _, _, _, _, 11, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 195, 44, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    5, _, _, 94, _, 111, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 81, 19, _, _, _, _, _, _, 130, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    66, _, _, _, _, 95, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 146, _, _, _, _, 66, _, _, _, _, 190, 86, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    64, _, _, _, _, _, 181, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, 7, 144, _, _, 16, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _, _,
+    25, _, _, _, 57, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _, _,
+    _, _, 37, _, _, 139, _, 221, _, 17, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _, _,
+    _, 201, _, _, _, _, _, _, _, _, _, _, _, 46, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _, _,
+    179, _, _, _, _, 14, _, _, _, _, _, _, 116, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _, _,
+    _, _, 143, _, _, _, _, 2, _, _, 106, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _, _,
+    184, _, _, _, _, _, _, _, _, _, _, _, 135, 141, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _, _,
+    _, 85, _, _, _, 225, _, _, _, _, _, 175, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _, _,
+    178, _, 112, _, _, _, _, 106, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _, _,
+    _, _, _, _, _, _, _, _, _, _, 154, _, _, 114, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _, _,
+    _, 42, _, _, _, 41, _, _, _, _, _, 105, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _, _,
+    167, _, _, _, _, _, _, 45, _, _, _, _, 189, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _, _,
+    _, _, 78, _, _, _, _, _, _, _, 67, _, _, 180, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0, _,
+    _, 53, _, _, _, 215, _, _, _, _, _, 230, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, _, 0,
+};
+
+#undef _
+
+static const QcBaseGraph wifi648r12Graph = {"802.11n 648 R1/2", 12, 24, wifi648r12, QC_LIFT_MODULO, 27};
+static const QcBaseGraph wifi648r23Graph = {"802.11n 648 R2/3", 8, 24, wifi648r23, QC_LIFT_MODULO, 27};
+static const QcBaseGraph wifi648r34Graph = {"802.11n 648 R3/4", 6, 24, wifi648r34, QC_LIFT_MODULO, 27};
+static const QcBaseGraph wifi648r56Graph = {"802.11n 648 R5/6", 4, 24, wifi648r56, QC_LIFT_MODULO, 27};
+static const QcBaseGraph wifi1296r12Graph = {"802.11n 1296 R1/2", 12, 24, wifi1296r12, QC_LIFT_MODULO, 54};
+static const QcBaseGraph wifi1296r23Graph = {"802.11n 1296 R2/3", 8, 24, wifi1296r23, QC_LIFT_MODULO, 54};
+static const QcBaseGraph wifi1296r34Graph = {"802.11n 1296 R3/4", 6, 24, wifi1296r34, QC_LIFT_MODULO, 54};
+static const QcBaseGraph wifi1296r56Graph = {"802.11n 1296 R5/6", 4, 24, wifi1296r56, QC_LIFT_MODULO, 54};
+static const QcBaseGraph wifi1944r12Graph = {"802.11n 1944 R1/2", 12, 24, wifi1944r12, QC_LIFT_MODULO, 81};
+static const QcBaseGraph wifi1944r23Graph = {"802.11n 1944 R2/3", 8, 24, wifi1944r23, QC_LIFT_MODULO, 81};
+static const QcBaseGraph wifi1944r34Graph = {"802.11n 1944 R3/4", 6, 24, wifi1944r34, QC_LIFT_MODULO, 81};
+static const QcBaseGraph wifi1944r56Graph = {"802.11n 1944 R5/6", 4, 24, wifi1944r56, QC_LIFT_MODULO, 81};
+static const QcBaseGraph wimaxR12Graph = {"802.16e R1/2", 12, 24, wimaxR12, QC_LIFT_SCALE, 96};
+static const QcBaseGraph wimaxR23AGraph = {"802.16e R2/3A", 8, 24, wimaxR23A, QC_LIFT_MODULO, 96};
+static const QcBaseGraph wimaxR23BGraph = {"802.16e R2/3B", 8, 24, wimaxR23B, QC_LIFT_SCALE, 96};
+static const QcBaseGraph wimaxR34AGraph = {"802.16e R3/4A", 6, 24, wimaxR34A, QC_LIFT_SCALE, 96};
+static const QcBaseGraph wimaxR34BGraph = {"802.16e R3/4B", 6, 24, wimaxR34B, QC_LIFT_SCALE, 96};
+static const QcBaseGraph wimaxR56Graph = {"802.16e R5/6", 4, 24, wimaxR56, QC_LIFT_SCALE, 96};
+
+// 5G NR graphs carry the largest lifting size of their set as baseZ
+static const QcBaseGraph nrBg1Graphs[NR_LIFTING_SETS] = {
+    {"5G NR BG1 iLS0", 46, 68, nrBg1Ils0, QC_LIFT_MODULO, 256},
+    {"5G NR BG1 iLS1", 46, 68, nrBg1Ils1, QC_LIFT_MODULO, 384},
+    {"5G NR BG1 iLS2", 46, 68, nrBg1Ils2, QC_LIFT_MODULO, 320},
+    {"5G NR BG1 iLS3", 46, 68, nrBg1Ils3, QC_LIFT_MODULO, 224},
+    {"5G NR BG1 iLS4", 46, 68, nrBg1Ils4, QC_LIFT_MODULO, 288},
+    {"5G NR BG1 iLS5", 46, 68, nrBg1Ils5, QC_LIFT_MODULO, 352},
+    {"5G NR BG1 iLS6", 46, 68, nrBg1Ils6, QC_LIFT_MODULO, 208},
+    {"5G NR BG1 iLS7", 46, 68, nrBg1Ils7, QC_LIFT_MODULO, 240},
+};
+static const QcBaseGraph nrBg2Graphs[NR_LIFTING_SETS] = {
+    {"5G NR BG2 iLS0", 42, 52, nrBg2Ils0, QC_LIFT_MODULO, 256},
+    {"5G NR BG2 iLS1", 42, 52, nrBg2Ils1, QC_LIFT_MODULO, 384},
+    {"5G NR BG2 iLS2", 42, 52, nrBg2Ils2, QC_LIFT_MODULO, 320},
+    {"5G NR BG2 iLS3", 42, 52, nrBg2Ils3, QC_LIFT_MODULO, 224},
+    {"5G NR BG2 iLS4", 42, 52, nrBg2Ils4, QC_LIFT_MODULO, 288},
+    {"5G NR BG2 iLS5", 42, 52, nrBg2Ils5, QC_LIFT_MODULO, 352},
+    {"5G NR BG2 iLS6", 42, 52, nrBg2Ils6, QC_LIFT_MODULO, 208},
+    {"5G NR BG2 iLS7", 42, 52, nrBg2Ils7, QC_LIFT_MODULO, 240},
+};
+
+// Graphs used at exactly one lifting size
+struct QcFixedCode
+{
+  const QcBaseGraph *graph;
+  uint16_t Z;
+};
+
+static const QcFixedCode wifiCodes[] = {
+    {&wifi648r12Graph, 27},
+    {&wifi648r23Graph, 27},
+    {&wifi648r34Graph, 27},
+    {&wifi648r56Graph, 27},
+    {&wifi1296r12Graph, 54},
+    {&wifi1296r23Graph, 54},
+    {&wifi1296r34Graph, 54},
+    {&wifi1296r56Graph, 54},
+    {&wifi1944r12Graph, 81},
+    {&wifi1944r23Graph, 81},
+    {&wifi1944r34Graph, 81},
+    {&wifi1944r56Graph, 81},
+};
+
+// Graphs lifted over a range of sizes
+struct QcLiftedCode
+{
+  const QcBaseGraph *graph;
+  uint16_t minZ;
+  uint16_t maxZ;
+  uint16_t stepZ;
+};
+
+// The B codes have the same K and N as the A codes of their rate, so
+// qcFindCode() returns the A code; they are still enumerated as built-ins
+static const QcLiftedCode wimaxCodes[] = {
+    {&wimaxR12Graph, 24, 96, 4},
+    {&wimaxR23AGraph, 24, 96, 4},
+    {&wimaxR23BGraph, 24, 96, 4},
+    {&wimaxR34AGraph, 24, 96, 4},
+    {&wimaxR34BGraph, 24, 96, 4},
+    {&wimaxR56Graph, 24, 96, 4},
+};
+
+#define WIFI_CODE_COUNT (sizeof(wifiCodes) / sizeof(wifiCodes[0]))
+#define WIMAX_CODE_COUNT (sizeof(wimaxCodes) / sizeof(wimaxCodes[0]))
+#define NR_CODE_COUNT (2 * NR_LIFTING_SETS)
+
+// 5G NR: rows x cols and information columns of the two base graphs
+#define NR_BG1_ROWS 46
+#define NR_BG1_COLS 68
+#define NR_BG2_ROWS 42
+#define NR_BG2_COLS 52
+#define NR_PUNCTURED 2
+
+static const uint8_t nrLiftingBase[NR_LIFTING_SETS] = {2, 3, 5, 7, 9, 11, 13, 15};
+
+// Graph in use per family and lifting set: the built-in table unless the code
+// table store registered another
+static const QcBaseGraph *nrGraphs[2][NR_LIFTING_SETS] = {
+    {&nrBg1Graphs[0], &nrBg1Graphs[1], &nrBg1Graphs[2], &nrBg1Graphs[3], &nrBg1Graphs[4], &nrBg1Graphs[5],
+     &nrBg1Graphs[6], &nrBg1Graphs[7]},
+    {&nrBg2Graphs[0], &nrBg2Graphs[1], &nrBg2Graphs[2], &nrBg2Graphs[3], &nrBg2Graphs[4], &nrBg2Graphs[5],
+     &nrBg2Graphs[6], &nrBg2Graphs[7]},
+};
+
+static uint8_t infoColumns(const QcBaseGraph &graph)
+{
+  return graph.cols - graph.rows;
+}
+
+static void setMatch(QcCodeMatch &match, const QcBaseGraph *graph, uint16_t Z, uint8_t punctured, uint8_t family)
+{
+  match.graph = graph;
+  match.Z = Z;
+  match.punctured = punctured;
+  match.family = family;
+}
+
+int8_t nrLiftingSet(uint16_t Z)
+{
+  if (Z < 2 || Z > NR_MAX_Z)
+    return -1;
+
+  while (Z % 2 == 0)
+    Z /= 2;
+  if (Z == 1)
+    return 0; // Powers of two belong to a = 2
+
+  for (uint8_t i = 1; i < NR_LIFTING_SETS; i++)
+  {
+    if (nrLiftingBase[i] == Z)
+      return i;
+  }
+  return -1;
+}
+
+uint8_t nrSizingColumns(uint8_t family, uint16_t K)
+{
+  if (family == QC_FAMILY_NR_BG1)
+    return NR_BG1_COLS - NR_BG1_ROWS;
+  if (K > 640)
+    return 10;
+  if (K > 560)
+    return 9;
+  return (K > 192) ? 8 : 6;
+}
+
+uint16_t nrLiftingSize(uint8_t kb, uint16_t K)
+{
+  uint16_t best = 0;
+
+  for (uint8_t i = 0; i < NR_LIFTING_SETS; i++)
+  {
+    for (uint16_t Z = nrLiftingBase[i]; Z <= NR_MAX_Z; Z *= 2)
+    {
+      if ((uint32_t)kb * Z >= K)
+      {
+        if (best == 0 || Z < best)
+          best = Z;
+        break;
+      }
+    }
+  }
+  return best;
+}
+
+bool qcRegisterNrGraph(uint8_t family, uint8_t liftingSet, const QcBaseGraph *graph)
+{
+  if ((family != QC_FAMILY_NR_BG1 && family != QC_FAMILY_NR_BG2) || liftingSet >= NR_LIFTING_SETS)
+    return false;
+
+  uint8_t rows = (family == QC_FAMILY_NR_BG1) ? NR_BG1_ROWS : NR_BG2_ROWS;
+  uint8_t cols = (family == QC_FAMILY_NR_BG1) ? NR_BG1_COLS : NR_BG2_COLS;
+  if (graph != NULL && (graph->rows != rows || graph->cols != cols))
+    return false;
+
+  if (graph == NULL)
+    graph = (family == QC_FAMILY_NR_BG1) ? &nrBg1Graphs[liftingSet] : &nrBg2Graphs[liftingSet];
+  nrGraphs[family - QC_FAMILY_NR_BG1][liftingSet] = graph;
+  return true;
+}
+
+// 5G NR: the lifting size TS 38.212 picks for K, and N within the
+// transmittable range. All information columns are kept; those beyond K hold
+// zero filler.
+static bool findNrCode(uint8_t family, uint16_t K, uint16_t N, QcCodeMatch &match)
+{
+  uint8_t rows = (family == QC_FAMILY_NR_BG1) ? NR_BG1_ROWS : NR_BG2_ROWS;
+
+  uint16_t Z = nrLiftingSize(nrSizingColumns(family, K), K);
+  if (Z == 0 || K <= NR_PUNCTURED * Z)
+    return false;
+
+  const QcBaseGraph *graph = nrGraphs[family - QC_FAMILY_NR_BG1][nrLiftingSet(Z)];
+  if (graph == NULL)
+    return false;
+
+  // At least the four core parity blocks, at most every row
+  uint32_t transmittedInfo = K - NR_PUNCTURED * Z;
+  if (N < transmittedInfo + 3 * (uint32_t)Z + 1 || N > transmittedInfo + (uint32_t)rows * Z)
+    return false;
+
+  setMatch(match, graph, Z, NR_PUNCTURED, family);
+  return true;
+}
+
+bool qcFindCode(uint16_t K, uint16_t N, QcCodeMatch &match)
+{
+  for (size_t i = 0; i < WIFI_CODE_COUNT; i++)
+  {
+    const QcFixedCode &code = wifiCodes[i];
+    if (K == infoColumns(*code.graph) * code.Z && N == code.graph->cols * code.Z)
+    {
+      setMatch(match, code.graph, code.Z, 0, QC_FAMILY_80211N);
+      return true;
+    }
+  }
+
+  for (size_t i = 0; i < WIMAX_CODE_COUNT; i++)
+  {
+    const QcLiftedCode &code = wimaxCodes[i];
+    if (N % code.graph->cols != 0)
+      continue;
+
+    uint16_t Z = N / code.graph->cols;
+    if (Z >= code.minZ && Z <= code.maxZ && (Z - code.minZ) % code.stepZ == 0 && K == infoColumns(*code.graph) * Z)
+    {
+      setMatch(match, code.graph, Z, 0, QC_FAMILY_80216E);
+      return true;
+    }
+  }
+
+  // 5G NR: prefer BG2 for short blocks and low rates, as TS 38.212 does
+  bool preferBg2 = (K <= 3824 && (uint32_t)K * 3 <= (uint32_t)N * 2) || (uint32_t)K * 4 <= N;
+  uint8_t first = preferBg2 ? QC_FAMILY_NR_BG2 : QC_FAMILY_NR_BG1;
+  uint8_t second = preferBg2 ? QC_FAMILY_NR_BG1 : QC_FAMILY_NR_BG2;
+  return findNrCode(first, K, N, match) || findNrCode(second, K, N, match);
+}
+
+size_t qcBuiltinCount()
+{
+  return WIFI_CODE_COUNT + WIMAX_CODE_COUNT + NR_CODE_COUNT;
+}
+
+// Largest 5G NR lifting size of a set
+static uint16_t nrLargestZ(uint8_t liftingSet)
+{
+  uint16_t Z = nrLiftingBase[liftingSet];
+  while (Z * 2 <= NR_MAX_Z)
+    Z *= 2;
+  return Z;
+}
+
+bool qcBuiltinCode(size_t index, QcCodeMatch &match, uint16_t &K, uint16_t &N)
+{
+  if (index < WIFI_CODE_COUNT)
+  {
+    const QcFixedCode &code = wifiCodes[index];
+    setMatch(match, code.graph, code.Z, 0, QC_FAMILY_80211N);
+  }
+  else if (index < WIFI_CODE_COUNT + WIMAX_CODE_COUNT)
+  {
+    const QcLiftedCode &code = wimaxCodes[index - WIFI_CODE_COUNT];
+    setMatch(match, code.graph, code.maxZ, 0, QC_FAMILY_80216E);
+  }
+  else if (index < WIFI_CODE_COUNT + WIMAX_CODE_COUNT + NR_CODE_COUNT)
+  {
+    // The largest lifting size of the set, every row that fits in LDPC_MAX_N
+    uint8_t nr = index - WIFI_CODE_COUNT - WIMAX_CODE_COUNT;
+    uint8_t family = (nr < NR_LIFTING_SETS) ? QC_FAMILY_NR_BG1 : QC_FAMILY_NR_BG2;
+    uint8_t liftingSet = nr % NR_LIFTING_SETS;
+    const QcBaseGraph *graph = nrGraphs[family - QC_FAMILY_NR_BG1][liftingSet];
+    uint16_t Z = nrLargestZ(liftingSet);
+    uint32_t fullN = (uint32_t)(graph->cols - NR_PUNCTURED) * Z;
+
+    setMatch(match, graph, Z, NR_PUNCTURED, family);
+    K = infoColumns(*graph) * Z;
+    N = (fullN < LDPC_MAX_N) ? (uint16_t)fullN : LDPC_MAX_N;
+    return true;
+  }
+  else
+  {
+    return false;
+  }
+
+  K = infoColumns(*match.graph) * match.Z;
+  N = match.graph->cols * match.Z;
+  return true;
+}
@@ -0,0 +1,57 @@
+#ifndef LDPC_QC_CODES_H
+#define LDPC_QC_CODES_H
+
+#include "ldpc_qc.h"
+
+// Standard QC-LDPC code families known to the local encoder
+enum QcFamily
+{
+  QC_FAMILY_80211N = 0, // n = 648 / 1296 / 1944, Z = 27 / 54 / 81
+  QC_FAMILY_80216E = 1, // n = 24 Z, Z = 24..96 in steps of 4
+  QC_FAMILY_NR_BG1 = 2, // 5G NR base graph 1: K <= 22 Z, first 2 Z punctured
+  QC_FAMILY_NR_BG2 = 3, // 5G NR base graph 2: K <= 10 Z, first 2 Z punctured
+  QC_FAMILY_COUNT
+};
+
+// Number of 5G NR lifting-size sets (iLS 0..7, Z = a * 2^j with a = 2, 3, 5, ..., 15)
+#define NR_LIFTING_SETS 8
+#define NR_MAX_Z 384
+
+// A lifted code the local encoder can produce
+struct QcCodeMatch
+{
+  const QcBaseGraph *graph;
+  uint16_t Z;
+  uint8_t punctured; // Leading information blocks that are not transmitted
+  uint8_t family;    // QcFamily
+};
+
+// Finds the standard code with K information and N codeword bits. 802.11n and
+// 802.16e match exactly; 5G NR picks the lifting size TS 38.212 uses for K
+// (see nrSizingColumns(); the rest of the information columns is zero filler)
+// and accepts any N the graph can reach.
+bool qcFindCode(uint16_t K, uint16_t N, QcCodeMatch &match);
+
+// Enumerates one representative code per built-in table (for the benchmark);
+// K and N receive the code's dimensions
+size_t qcBuiltinCount();
+bool qcBuiltinCode(size_t index, QcCodeMatch &match, uint16_t &K, uint16_t &N);
+
+// The 5G NR shift tables of all 8 lifting sets are built in. Registers
+// another graph for one lifting set of BG1 or BG2, e.g. from the code table
+// store; the graph must stay valid while registered, and NULL restores the
+// built-in one.
+bool qcRegisterNrGraph(uint8_t family, uint8_t liftingSet, const QcBaseGraph *graph);
+
+// iLS of a 5G NR lifting size, or -1 if Z is not one
+int8_t nrLiftingSet(uint16_t Z);
+
+// Information columns Kb that size Z for K bits (TS 38.212 5.2.2): 22 for
+// BG1; 10, 9, 8 or 6 for BG2 above 640, 560, 192 and up to 192 bits. The code
+// itself keeps all 22 or 10 columns, the rest being filler.
+uint8_t nrSizingColumns(uint8_t family, uint16_t K);
+
+// Smallest 5G NR lifting size with kb * Z >= K, or 0 if none
+uint16_t nrLiftingSize(uint8_t kb, uint16_t K);
+
+#endif
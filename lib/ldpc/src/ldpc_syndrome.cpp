@@ -0,0 +1,126 @@
+#include "ldpc_syndrome.h"
+#include "ldpc_alloc.h"
+
+#include <string.h>
+
+QcSyndromeChecker::QcSyndromeChecker()
+    : K(0), N(0), Z(0), infoBits(0), infoOffset(0), parityOffset(0), fullBits(0), rows(0), scratch(0), scratchWords(0),
+      codewordStream(0), fullStream(0), accumulator(0)
+{
+}
+
+QcSyndromeChecker::~QcSyndromeChecker()
+{
+  release();
+}
+
+void QcSyndromeChecker::release()
+{
+  if (scratch != NULL)
+    ldpcFreeTable(scratch);
+  scratch = NULL;
+  scratchWords = 0;
+  rows = 0;
+}
+
+bool QcSyndromeChecker::configure(const QcBaseGraph &graph, uint16_t z, uint16_t k, uint16_t n, uint8_t punctured)
+{
+  release();
+
+  if (graph.rows > LDPC_QC_MAX_ROWS || graph.cols > LDPC_QC_MAX_COLS || graph.cols <= graph.rows || z == 0)
+    return false;
+
+  uint8_t infoCols = graph.cols - graph.rows;
+  uint32_t puncturedBits = (uint32_t)punctured * z;
+  if (k <= puncturedBits || k > (uint32_t)infoCols * z || n <= k - puncturedBits || n > LDPC_MAX_N ||
+      n - (k - puncturedBits) > (uint32_t)graph.rows * z)
+    return false;
+
+  K = k;
+  N = n;
+  Z = z;
+  infoBits = k - puncturedBits;
+  infoOffset = puncturedBits;
+  parityOffset = (uint32_t)infoCols * z;
+  fullBits = (uint32_t)graph.cols * z;
+
+  // Parity columns whose block is transmitted in full; information columns
+  // are known unless punctured (filler bits are zero)
+  uint8_t knownParityCols = (n - infoBits) / z;
+
+  uint16_t count = 0;
+  for (uint8_t r = 0; r < graph.rows; r++)
+  {
+    bool known = true;
+    uint16_t start = count;
+
+    for (uint8_t c = 0; c < graph.cols && known; c++)
+    {
+      int16_t s = graph.shifts[r * graph.cols + c];
+      if (s < 0)
+        continue;
+      known = (c >= punctured) && (c < infoCols || c - infoCols < knownParityCols);
+      if (known && count == LDPC_QC_MAX_ENTRIES)
+        return false;
+      if (known)
+      {
+        entries[count].col = c;
+        entries[count].shift = qcLiftShift(graph, s, z);
+        count++;
+      }
+    }
+
+    if (!known)
+    {
+      count = start;
+      continue;
+    }
+    rowStart[rows++] = start;
+  }
+  rowStart[rows] = count;
+  if (rows == 0)
+    return false;
+
+  size_t codewordWords = LDPC_WORDS(N) + 1;
+  size_t fullWords = LDPC_WORDS(fullBits) + 1;
+  scratchWords = codewordWords + fullWords + LDPC_WORDS(Z);
+  scratch = (uint32_t *)ldpcAllocTable(scratchWords * sizeof(uint32_t));
+  if (scratch == NULL)
+  {
+    scratchWords = 0;
+    rows = 0;
+    return false;
+  }
+
+  codewordStream = scratch;
+  fullStream = codewordStream + codewordWords;
+  accumulator = fullStream + fullWords;
+  return true;
+}
+
+bool QcSyndromeChecker::check(const uint8_t *codeword) const
+{
+  memset(scratch, 0, scratchWords * sizeof(uint32_t));
+  ldpcLoadStream(codeword, N, codewordStream);
+
+  // Expand to full codeword coordinates; unknown bits stay zero and are never read
+  ldpcXorBits(fullStream, infoOffset, codewordStream, 0, infoBits);
+  ldpcXorBits(fullStream, parityOffset, codewordStream, infoBits, N - infoBits);
+
+  uint16_t words = LDPC_WORDS(Z);
+  for (uint8_t r = 0; r < rows; r++)
+  {
+    for (uint16_t e = rowStart[r]; e < rowStart[r + 1]; e++)
+      ldpcRotateXor(accumulator, 0, fullStream, (uint32_t)entries[e].col * Z, Z, entries[e].shift);
+
+    uint32_t syndrome = 0;
+    for (uint16_t w = 0; w < words; w++)
+    {
+      syndrome |= accumulator[w];
+      accumulator[w] = 0;
+    }
+    if (syndrome != 0)
+      return false;
+  }
+  return true;
+}
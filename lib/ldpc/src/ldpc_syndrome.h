@@ -0,0 +1,51 @@
+#ifndef LDPC_SYNDROME_H
+#define LDPC_SYNDROME_H
+
+#include "ldpc_qc.h"
+
+// Parity check H * c = 0 for received QC-LDPC codewords, computed with the
+// same word-level rotate-and-XOR as the QC encoder. Codewords use the
+// QcEncoder layout (punctured, filler and truncated bits). Only checks whose
+// every column is known from the transmitted bits can be evaluated: checks
+// touching punctured or truncated parity columns are skipped, so a code
+// where no check remains (5G NR with its punctured first columns) cannot be
+// configured. Scratch memory is owned by the checker, so use one instance per
+// concurrent caller.
+class QcSyndromeChecker
+{
+public:
+  QcSyndromeChecker();
+  ~QcSyndromeChecker();
+
+  bool configure(const QcBaseGraph &graph, uint16_t Z, uint16_t K, uint16_t N, uint8_t punctured = 0);
+  void release();
+
+  bool ready() const { return scratch != 0; }
+
+  // Base rows evaluated per codeword (each is Z parity checks)
+  uint8_t checkedRows() const { return rows; }
+
+  // True if every evaluated check is satisfied by the LDPC_BYTES(N) codeword bytes
+  bool check(const uint8_t *codeword) const;
+
+  uint16_t K;
+  uint16_t N;
+
+protected:
+  QcEntry entries[LDPC_QC_MAX_ENTRIES];
+  uint16_t rowStart[LDPC_QC_MAX_ROWS + 1];
+  uint16_t Z;
+  uint16_t infoBits;     // Transmitted information bits
+  uint32_t infoOffset;   // Position of the first transmitted information bit in the full codeword
+  uint32_t parityOffset; // Position of the first parity bit in the full codeword
+  uint32_t fullBits;
+  uint8_t rows;
+
+  uint32_t *scratch;
+  size_t scratchWords;
+  uint32_t *codewordStream;
+  uint32_t *fullStream;
+  uint32_t *accumulator;
+};
+
+#endif
@@ -0,0 +1,154 @@
+#include "ldpc_table_encoder.h"
+#include "ldpc_alloc.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+TableEncoder::TableEncoder() : table(0), ownsTable(false), chunkBits(0), chunks(0), parityWords(0)
+{
+}
+
+TableEncoder::~TableEncoder()
+{
+  release();
+}
+
+size_t TableEncoder::tableBytes(uint16_t K, uint16_t N, uint8_t chunkBits)
+{
+  size_t chunks = (K + chunkBits - 1) / chunkBits;
+  return chunks * ((size_t)1 << chunkBits) * LDPC_WORDS(N - K) * sizeof(uint32_t);
+}
+
+bool TableEncoder::setShape(uint16_t k, uint16_t n, uint8_t bits)
+{
+  if ((bits != 4 && bits != 8) || k == 0 || k > LDPC_MAX_K || n <= k || n > LDPC_MAX_N)
+    return false;
+
+  release();
+  K = k;
+  N = n;
+  chunkBits = bits;
+  chunks = (K + chunkBits - 1) / chunkBits;
+  parityWords = LDPC_WORDS(N - K);
+  return true;
+}
+
+bool TableEncoder::build(uint16_t k, uint16_t n, uint8_t bits, LdpcRowSource source, void *context)
+{
+  if (!setShape(k, n, bits))
+    return false;
+
+  uint32_t *entries = (uint32_t *)ldpcAllocTable(tableBytes(K, N, chunkBits));
+  uint32_t *rowBuffer = (uint32_t *)malloc(8 * parityWords * sizeof(uint32_t));
+  if (entries == NULL || rowBuffer == NULL)
+  {
+    if (entries != NULL)
+      ldpcFreeTable(entries);
+    free(rowBuffer);
+    return false;
+  }
+
+  uint16_t entriesPerChunk = 1 << chunkBits;
+  uint32_t *rows[8];
+  for (uint8_t i = 0; i < 8; i++)
+    rows[i] = rowBuffer + i * parityWords;
+
+  for (uint16_t chunk = 0; chunk < chunks; chunk++)
+  {
+    uint32_t *base = entries + (size_t)chunk * entriesPerChunk * parityWords;
+
+    // Row i of the chunk is selected by bit (chunkBits - 1 - i) of the chunk value,
+    // matching the MSB-first order of the information bits
+    for (uint8_t i = 0; i < chunkBits; i++)
+    {
+      uint16_t row = chunk * chunkBits + i;
+      memset(rows[i], 0, parityWords * sizeof(uint32_t));
+      if (row < K)
+        source(context, row, (uint8_t *)rows[i]);
+    }
+
+    // Each entry is a smaller entry plus one row: 2^chunkBits XORs of a parity vector
+    memset(base, 0, parityWords * sizeof(uint32_t));
+    for (uint16_t value = 1; value < entriesPerChunk; value++)
+    {
+      uint8_t low = 0;
+      while (!(value & (1 << low)))
+        low++;
+
+      const uint32_t *prev = base + (size_t)(value & (value - 1)) * parityWords;
+      const uint32_t *row = rows[chunkBits - 1 - low];
+      uint32_t *entry = base + (size_t)value * parityWords;
+      for (uint16_t w = 0; w < parityWords; w++)
+        entry[w] = prev[w] ^ row[w];
+    }
+  }
+
+  free(rowBuffer);
+  table = entries;
+  ownsTable = true;
+  return true;
+}
+
+bool TableEncoder::attach(uint16_t k, uint16_t n, uint8_t bits, const uint32_t *prebuilt)
+{
+  if (prebuilt == NULL || !setShape(k, n, bits))
+    return false;
+
+  table = prebuilt;
+  ownsTable = false;
+  return true;
+}
+
+void TableEncoder::release()
+{
+  if (ownsTable && table != NULL)
+    ldpcFreeTable((void *)table);
+  table = NULL;
+  ownsTable = false;
+}
+
+void TableEncoder::encodeParity(const uint8_t *info, uint32_t *parity) const
+{
+  memset(parity, 0, parityWords * sizeof(uint32_t));
+
+  size_t stride = ((size_t)1 << chunkBits) * parityWords;
+  const uint32_t *base = table;
+
+  if (chunkBits == 8)
+  {
+    uint16_t fullBytes = K / 8;
+    for (uint16_t c = 0; c < fullBytes; c++, base += stride)
+    {
+      const uint32_t *entry = base + (size_t)info[c] * parityWords;
+      for (uint16_t w = 0; w < parityWords; w++)
+        parity[w] ^= entry[w];
+    }
+    if (K % 8)
+    {
+      uint8_t value = info[fullBytes] & (uint8_t)(0xFF << (8 - K % 8));
+      const uint32_t *entry = base + (size_t)value * parityWords;
+      for (uint16_t w = 0; w < parityWords; w++)
+        parity[w] ^= entry[w];
+    }
+    return;
+  }
+
+  for (uint16_t c = 0; c < chunks; c++, base += stride)
+  {
+    uint8_t value = (c & 1) ? (info[c >> 1] & 0x0F) : (info[c >> 1] >> 4);
+    uint16_t remaining = K - c * 4;
+    if (remaining < 4)
+      value &= (uint8_t)(0x0F << (4 - remaining)) & 0x0F;
+
+    const uint32_t *entry = base + (size_t)value * parityWords;
+    for (uint16_t w = 0; w < parityWords; w++)
+      parity[w] ^= entry[w];
+  }
+}
+
+void TableEncoder::encodeBlock(const uint8_t *info, uint8_t *codeword) const
+{
+  uint32_t parity[LDPC_WORDS(LDPC_MAX_N)];
+  encodeParity(info, parity);
+  ldpcPackCodeword(info, K, (const uint8_t *)parity, N, codeword);
+}
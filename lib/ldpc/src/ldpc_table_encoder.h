@@ -0,0 +1,50 @@
+#ifndef LDPC_TABLE_ENCODER_H
+#define LDPC_TABLE_ENCODER_H
+
+#include "ldpc_encoder.h"
+
+// "Four Russians" systematic encoder. The information bits are split into
+// chunks of chunkBits (4 or 8); for every chunk position a table holds the
+// parity contribution of all 2^chunkBits chunk values, so a block costs
+// ceil(K / chunkBits) lookups plus word-wide XORs of the parity vector.
+//
+// Table memory is ceil(K / chunkBits) * 2^chunkBits * 4 * LDPC_WORDS(N - K)
+// bytes: 8-bit chunks halve the lookups for 8x the memory of 4-bit chunks.
+// Entries are the parity bits packed MSB-first, padded to whole 32-bit words.
+class TableEncoder : public LdpcEncoder
+{
+public:
+  TableEncoder();
+  ~TableEncoder();
+
+  static size_t tableBytes(uint16_t K, uint16_t N, uint8_t chunkBits);
+
+  // Builds the tables in PSRAM (internal RAM if there is none) from the rows of
+  // the generator's parity part. Returns false if K, N, chunkBits are invalid or
+  // the allocation fails.
+  bool build(uint16_t K, uint16_t N, uint8_t chunkBits, LdpcRowSource source, void *context);
+
+  // Uses prebuilt tables in place, e.g. from flash. The encoder does not own them.
+  bool attach(uint16_t K, uint16_t N, uint8_t chunkBits, const uint32_t *table);
+
+  void release();
+  bool ready() const { return table != 0; }
+  uint8_t chunkSize() const { return chunkBits; }
+  const uint32_t *tableData() const { return table; } // tableBytes() bytes, e.g. to store in flash
+
+  void encodeBlock(const uint8_t *info, uint8_t *codeword) const;
+
+  // Computes only the parity bits (LDPC_WORDS(N - K) words)
+  void encodeParity(const uint8_t *info, uint32_t *parity) const;
+
+private:
+  bool setShape(uint16_t K, uint16_t N, uint8_t chunkBits);
+
+  const uint32_t *table;
+  bool ownsTable;
+  uint8_t chunkBits;
+  uint16_t chunks;
+  uint16_t parityWords;
+};
+
+#endif
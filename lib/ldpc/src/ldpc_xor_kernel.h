@@ -0,0 +1,46 @@
+#ifndef LDPC_XOR_KERNEL_H
+#define LDPC_XOR_KERNEL_H
+
+#include "ldpc_encoder.h"
+
+// Straight-line XOR kernels generated per code by `ldpc_host gen-kernel`.
+// Kernels are bit-sliced: every array element is one code bit across the lanes
+// of a word type W (uint8_t for a single block, uint32_t for 32 blocks, ...).
+// A generated header specialises this template for its (K, N):
+//
+//   template <typename W> static void encode(const W *u, W *p);  // K in, N - K out
+//   template <typename W> static W syndrome(const W *c);         // lanes with a failed check
+template <uint16_t K, uint16_t N>
+struct LdpcXorKernel
+{
+  static const bool available = false;
+};
+
+// Single-block LdpcEncoder on top of a generated kernel: information bits are
+// expanded to one byte lane each
+template <uint16_t CodeK, uint16_t CodeN>
+class XorKernelEncoder : public LdpcEncoder
+{
+public:
+  XorKernelEncoder()
+  {
+    K = CodeK;
+    N = CodeN;
+  }
+
+  void encodeBlock(const uint8_t *info, uint8_t *codeword) const
+  {
+    uint8_t lanes[CodeN];
+    for (uint16_t i = 0; i < CodeK; i++)
+      lanes[i] = (info[i >> 3] >> (7 - (i & 7))) & 1;
+
+    LdpcXorKernel<CodeK, CodeN>::encode(lanes, lanes + CodeK);
+
+    for (uint16_t i = 0; i < LDPC_BYTES(CodeN); i++)
+      codeword[i] = 0;
+    for (uint16_t i = 0; i < CodeN; i++)
+      codeword[i >> 3] |= (uint8_t)(lanes[i] << (7 - (i & 7)));
+  }
+};
+
+#endif
@@ -0,0 +1,229 @@
+#include "bench.h"
+#include "ldpc_bitslice.h"
+#include "ldpc_kernel_324_648.h"
+#include "ldpc_qc_codes.h"
+#include "ldpc_table_encoder.h"
+#include "parallel_encode.h"
+
+#define BENCH_WINDOW_US 200000 // Time spent encoding per configuration
+#define BENCH_SPLIT_MAX_BLOCKS 64 // Largest message of the dual-core comparison, in 802.11n 648 R1/2 blocks
+
+struct BenchShape
+{
+  uint16_t K;
+  uint16_t N;
+};
+
+// 802.11n block sizes at rate 1/2 plus a few high-rate shapes
+static const BenchShape benchShapes[] = {
+    {324, 648},
+    {648, 1296},
+    {972, 1944},
+    {1620, 1944},
+    {2048, 4096},
+};
+
+// Pseudo-random dense parity rows; throughput does not depend on the code itself
+static void randomParityRow(void *context, uint16_t row, uint8_t *rowBits)
+{
+  uint16_t parityBits = *(const uint16_t *)context;
+  uint32_t state = 0x9E3779B9UL ^ ((uint32_t)row * 0x85EBCA6BUL);
+
+  for (uint16_t i = 0; i < LDPC_BYTES(parityBits); i++)
+  {
+    state ^= state << 13;
+    state ^= state >> 17;
+    state ^= state << 5;
+    rowBits[i] = (uint8_t)state;
+  }
+  if (parityBits % 8)
+    rowBits[LDPC_BYTES(parityBits) - 1] &= (uint8_t)(0xFF << (8 - parityBits % 8));
+}
+
+// Runs encoder on one block repeatedly for BENCH_WINDOW_US; returns blocks/s
+static float measureBlocksPerSecond(const LdpcEncoder &encoder, uint8_t *info, uint8_t *codeword)
+{
+  uint32_t blocks = 0;
+  unsigned long start = micros();
+  unsigned long elapsed;
+
+  do
+  {
+    encoder.encodeBlock(info, codeword);
+    info[blocks % LDPC_BYTES(encoder.K)] ^= codeword[0]; // Keep the input changing
+    blocks++;
+    elapsed = micros() - start;
+  } while (elapsed < BENCH_WINDOW_US);
+
+  return blocks * 1e6f / elapsed;
+}
+
+// Same for batch-capable encoders: a full batch of independent blocks per pass
+static float measureBatchBlocksPerSecond(const LdpcEncoder &encoder, uint8_t *message, uint8_t *codewords)
+{
+  uint8_t lanes = encoder.batchLanes();
+  uint32_t blocks = 0;
+  unsigned long start = micros();
+  unsigned long elapsed;
+
+  do
+  {
+    ldpcEncodeBlocks(encoder, message, (uint16_t)(lanes * encoder.K), lanes, codewords);
+    message[blocks % LDPC_BYTES(encoder.K)] ^= codewords[0];
+    blocks += lanes;
+    elapsed = micros() - start;
+  } while (elapsed < BENCH_WINDOW_US);
+
+  return blocks * 1e6f / elapsed;
+}
+
+// Whole messages of `blocks` blocks through parallelEncodeBlocks(); a NULL
+// worker keeps everything on this core. Returns blocks/s; cores receives the
+// number of cores the split actually used.
+static float measureSplitBlocksPerSecond(const LdpcEncoder &encoder, const LdpcEncoder *worker, uint16_t blocks,
+                                         uint8_t *message, uint8_t *codewords, uint8_t &cores)
+{
+  uint32_t encoded = 0;
+  unsigned long start = micros();
+  unsigned long elapsed;
+
+  do
+  {
+    cores = parallelEncodeBlocks(encoder, worker, message, (uint16_t)(blocks * encoder.K), blocks, codewords);
+    message[encoded % LDPC_BYTES(encoder.K)] ^= codewords[0];
+    encoded += blocks;
+    elapsed = micros() - start;
+  } while (elapsed < BENCH_WINDOW_US);
+
+  return encoded * 1e6f / elapsed;
+}
+
+// One core against both for each kind of local encoder, at 802.11n 648 R1/2
+static void runSplitBenchmark(Print &out)
+{
+  static uint8_t message[BENCH_SPLIT_MAX_BLOCKS * LDPC_BYTES(324)];
+  static uint8_t codewords[BENCH_SPLIT_MAX_BLOCKS * LDPC_BYTES(648)];
+  static const uint16_t messageBlocks[] = {PARALLEL_MIN_BLOCKS, 16, BENCH_SPLIT_MAX_BLOCKS};
+
+  QcCodeMatch match;
+  QcEncoder qc;
+  QcEncoder workerQc;
+  uint16_t parityBits = 648 - 324;
+  TableEncoder table;
+  TableEncoder workerTable;
+  static BitslicedEncoder<324, 648> sliced;
+  static BitslicedEncoder<324, 648> workerSliced;
+
+  bool haveQc = qcFindCode(324, 648, match) && qc.configure(*match.graph, match.Z, 324, 648, match.punctured) &&
+                workerQc.configure(*match.graph, match.Z, 324, 648, match.punctured);
+  bool haveTable = table.build(324, 648, 4, randomParityRow, &parityBits) &&
+                   workerTable.attach(324, 648, 4, table.tableData());
+
+  const LdpcEncoder *encoders[] = {haveQc ? &qc : NULL, haveTable ? &table : NULL, &sliced};
+  const LdpcEncoder *workers[] = {&workerQc, &workerTable, &workerSliced};
+  const char *names[] = {"QC", "table (4-bit)", "bit-sliced"};
+
+  for (uint16_t b = 0; b < sizeof(message); b++)
+    message[b] = (uint8_t)(b * 37 + 11);
+
+  out.println("Dual-core split (802.11n 648 R1/2, whole messages):");
+  out.println("  encoder        blocks   1 core blocks/s     split blocks/s  cores  speedup");
+
+  for (uint8_t e = 0; e < sizeof(encoders) / sizeof(encoders[0]); e++)
+  {
+    if (encoders[e] == NULL)
+    {
+      out.printf("  %-13s  skipped (does not fit)\n", names[e]);
+      continue;
+    }
+
+    for (uint8_t m = 0; m < sizeof(messageBlocks) / sizeof(messageBlocks[0]); m++)
+    {
+      uint8_t cores;
+      float single = measureSplitBlocksPerSecond(*encoders[e], NULL, messageBlocks[m], message, codewords, cores);
+      float dual = measureSplitBlocksPerSecond(*encoders[e], workers[e], messageBlocks[m], message, codewords, cores);
+
+      // Too few blocks for the split (batchLanes() or PARALLEL_MIN_BLOCKS): no comparison
+      if (cores < 2)
+        out.printf("  %-13s %7u %17.1f %18.1f %6u      n/a\n", names[e], messageBlocks[m], single, dual, cores);
+      else
+        out.printf("  %-13s %7u %17.1f %18.1f %6u %7.2fx\n", names[e], messageBlocks[m], single, dual, cores,
+                   dual / single);
+    }
+  }
+}
+
+void runEncoderBenchmark(Print &out)
+{
+  static uint8_t info[LDPC_BYTES(LDPC_MAX_K)];
+  static uint8_t codeword[LDPC_BYTES(LDPC_MAX_N)];
+
+  out.println("Encoder benchmark (table encoder, random dense generator):");
+  out.println("    K     N  chunk   table KB    blocks/s   Mbit/s");
+
+  for (size_t s = 0; s < sizeof(benchShapes) / sizeof(benchShapes[0]); s++)
+  {
+    const BenchShape &shape = benchShapes[s];
+    uint16_t parityBits = shape.N - shape.K;
+
+    for (uint8_t chunkBits = 4; chunkBits <= 8; chunkBits += 4)
+    {
+      size_t tableKB = TableEncoder::tableBytes(shape.K, shape.N, chunkBits) / 1024;
+      TableEncoder encoder;
+
+      if (!encoder.build(shape.K, shape.N, chunkBits, randomParityRow, &parityBits))
+      {
+        out.printf("%5u %5u  %5u %10u    skipped (does not fit)\n", shape.K, shape.N, chunkBits, (unsigned)tableKB);
+        continue;
+      }
+
+      for (uint16_t i = 0; i < LDPC_BYTES(shape.K); i++)
+        info[i] = (uint8_t)(i * 37 + 11);
+
+      float blocksPerSecond = measureBlocksPerSecond(encoder, info, codeword);
+      out.printf("%5u %5u  %5u %10u %11.1f %8.3f\n", shape.K, shape.N, chunkBits, (unsigned)tableKB,
+                 blocksPerSecond, blocksPerSecond * shape.K / 1e6f);
+    }
+  }
+
+  out.println("QC encoder (circulant rotate-and-XOR, built-in codes):");
+  out.println("    K     N     Z  memory B    blocks/s   Mbit/s  code");
+
+  for (size_t i = 0; i < qcBuiltinCount(); i++)
+  {
+    QcCodeMatch match;
+    uint16_t K;
+    uint16_t N;
+    QcEncoder encoder;
+
+    if (!qcBuiltinCode(i, match, K, N) || !encoder.configure(*match.graph, match.Z, K, N, match.punctured))
+      continue;
+
+    for (uint16_t b = 0; b < LDPC_BYTES(K); b++)
+      info[b] = (uint8_t)(b * 37 + 11);
+
+    float blocksPerSecond = measureBlocksPerSecond(encoder, info, codeword);
+    out.printf("%5u %5u %5u %9u %11.1f %8.3f  %s\n", K, N, match.Z, (unsigned)encoder.memoryBytes(),
+               blocksPerSecond, blocksPerSecond * K / 1e6f, match.graph->name);
+  }
+
+  XorKernelEncoder<324, 648> kernel;
+  for (uint16_t b = 0; b < LDPC_BYTES(kernel.K); b++)
+    info[b] = (uint8_t)(b * 37 + 11);
+
+  float blocksPerSecond = measureBlocksPerSecond(kernel, info, codeword);
+  out.println("Generated XOR kernel (straight-line, 802.11n 648 R1/2):");
+  out.println("  lanes    blocks/s   Mbit/s");
+  out.printf("%7u %11.1f %8.3f\n", 1, blocksPerSecond, blocksPerSecond * kernel.K / 1e6f);
+
+  static BitslicedEncoder<324, 648> sliced;
+  static uint8_t batchMessage[32 * LDPC_BYTES(324)];
+  static uint8_t batchCodewords[32 * LDPC_BYTES(648)];
+  for (uint16_t b = 0; b < sizeof(batchMessage); b++)
+    batchMessage[b] = (uint8_t)(b * 37 + 11);
+
+  blocksPerSecond = measureBatchBlocksPerSecond(sliced, batchMessage, batchCodewords);
+  out.printf("%7u %11.1f %8.3f\n", sliced.batchLanes(), blocksPerSecond, blocksPerSecond * sliced.K / 1e6f);
+
+  runSplitBenchmark(out);
+}
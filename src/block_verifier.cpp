@@ -0,0 +1,114 @@
+#include "block_verifier.h"
+
+#include <Arduino.h>
+#include <atomic>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+#define VERIFY_FINISH 0xFFFF // Queued by verifierFinish() behind the last block
+
+static TaskHandle_t verifierTask = NULL;
+static SemaphoreHandle_t verifierDone = NULL;
+static BlockCheck checkBlock = NULL;
+
+// Ring indices only grow; head is written by the exchange, tail by the verifier
+static uint16_t ring[VERIFY_QUEUE_SIZE];
+static std::atomic<uint32_t> head(0);
+static std::atomic<uint32_t> tail(0);
+static uint16_t maxDepth = 0;
+
+// Current job, set before the first block is queued
+static void *jobContext = NULL;
+static BlockVerdict *jobVerdicts = NULL;
+
+static void verifierLoop(void *)
+{
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    uint32_t t = tail.load(std::memory_order_relaxed);
+    while (t != head.load(std::memory_order_acquire))
+    {
+      uint16_t block = ring[t % VERIFY_QUEUE_SIZE];
+      if (block == VERIFY_FINISH)
+        xSemaphoreGive(verifierDone);
+      else
+        jobVerdicts[block] = checkBlock(jobContext, block);
+      tail.store(++t, std::memory_order_release);
+    }
+  }
+}
+
+bool verifierBegin(BlockCheck check)
+{
+#if portNUM_PROCESSORS > 1
+  if (verifierTask != NULL)
+    return true;
+
+  verifierDone = xSemaphoreCreateBinary();
+  if (verifierDone == NULL)
+    return false;
+
+  checkBlock = check;
+  BaseType_t otherCore = (xPortGetCoreID() == 0) ? 1 : 0;
+  if (xTaskCreatePinnedToCore(verifierLoop, "ldpc_verify", VERIFY_TASK_STACK, NULL, uxTaskPriorityGet(NULL),
+                              &verifierTask, otherCore) != pdPASS)
+  {
+    vSemaphoreDelete(verifierDone);
+    verifierDone = NULL;
+    verifierTask = NULL;
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+bool verifierReady()
+{
+  return verifierTask != NULL;
+}
+
+void verifierStart(void *context, BlockVerdict *verdicts, uint16_t blocks)
+{
+  for (uint16_t i = 0; i < blocks; i++)
+    verdicts[i] = BLOCK_UNCHECKED;
+  jobContext = context;
+  jobVerdicts = verdicts;
+}
+
+// Pushes without waking the verifier when the ring is full; false then
+static bool tryPush(uint16_t value)
+{
+  uint32_t h = head.load(std::memory_order_relaxed);
+  uint32_t depth = h - tail.load(std::memory_order_acquire);
+  if (depth >= VERIFY_QUEUE_SIZE)
+    return false;
+
+  ring[h % VERIFY_QUEUE_SIZE] = value;
+  head.store(h + 1, std::memory_order_release);
+  if (depth + 1 > maxDepth)
+    maxDepth = depth + 1;
+  xTaskNotifyGive(verifierTask);
+  return true;
+}
+
+void verifierPush(uint16_t block)
+{
+  while (!tryPush(block))
+    yield();
+}
+
+void verifierFinish()
+{
+  verifierPush(VERIFY_FINISH);
+  xSemaphoreTake(verifierDone, portMAX_DELAY);
+}
+
+uint16_t verifierMaxDepth()
+{
+  return maxDepth;
+}
@@ -0,0 +1,132 @@
+#include "codec.h"
+
+#include <string.h>
+
+static const char base64Alphabet[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+// Reverse base64 table: 6-bit value per character, BASE64_BAD outside the alphabet
+#define BASE64_BAD 0x80
+static uint8_t base64Values[256];
+static bool base64ValuesReady = false;
+
+// Reflected CRC-32 table for polynomial 0xEDB88320, built on first use
+static uint32_t crc32Table[256];
+static bool crc32TableReady = false;
+
+static void buildCrc32Table()
+{
+  for (uint32_t i = 0; i < 256; i++)
+  {
+    uint32_t c = i;
+    for (int bit = 0; bit < 8; bit++)
+    {
+      c = (c & 1) ? (0xEDB88320UL ^ (c >> 1)) : (c >> 1);
+    }
+    crc32Table[i] = c;
+  }
+  crc32TableReady = true;
+}
+
+uint32_t crc32Update(uint32_t crc, const uint8_t *data, size_t length)
+{
+  if (!crc32TableReady)
+    buildCrc32Table();
+
+  crc = ~crc;
+  for (size_t i = 0; i < length; i++)
+  {
+    crc = crc32Table[(crc ^ data[i]) & 0xFF] ^ (crc >> 8);
+  }
+  return ~crc;
+}
+
+size_t base64Encode(const uint8_t *src, size_t length, char *dst)
+{
+  size_t out = 0;
+  size_t i = 0;
+
+  for (; i + 3 <= length; i += 3)
+  {
+    uint32_t v = ((uint32_t)src[i] << 16) | ((uint32_t)src[i + 1] << 8) | src[i + 2];
+    dst[out++] = base64Alphabet[(v >> 18) & 0x3F];
+    dst[out++] = base64Alphabet[(v >> 12) & 0x3F];
+    dst[out++] = base64Alphabet[(v >> 6) & 0x3F];
+    dst[out++] = base64Alphabet[v & 0x3F];
+  }
+
+  size_t remaining = length - i;
+  if (remaining > 0)
+  {
+    uint32_t v = (uint32_t)src[i] << 16;
+    if (remaining == 2)
+      v |= (uint32_t)src[i + 1] << 8;
+
+    dst[out++] = base64Alphabet[(v >> 18) & 0x3F];
+    dst[out++] = base64Alphabet[(v >> 12) & 0x3F];
+    dst[out++] = (remaining == 2) ? base64Alphabet[(v >> 6) & 0x3F] : '=';
+    dst[out++] = '=';
+  }
+
+  return out;
+}
+
+static void buildBase64Values()
+{
+  memset(base64Values, BASE64_BAD, sizeof(base64Values));
+  for (uint8_t i = 0; i < 64; i++)
+  {
+    base64Values[(uint8_t)base64Alphabet[i]] = i;
+  }
+  base64ValuesReady = true;
+}
+
+size_t base64Decode(const char *src, size_t length, uint8_t *dst, size_t capacity)
+{
+  if (!base64ValuesReady)
+    buildBase64Values();
+
+  if (length % 4 != 0)
+    return BASE64_INVALID;
+  if (length == 0)
+    return 0;
+
+  size_t padding = (src[length - 1] == '=') + (src[length - 2] == '=');
+  size_t outLength = length / 4 * 3 - padding;
+  if (outLength > capacity)
+    return BASE64_INVALID;
+
+  // Full quads: table lookups only, invalid characters accumulate into bad
+  const uint8_t *in = (const uint8_t *)src;
+  size_t fullQuads = length / 4 - (padding > 0);
+  uint8_t bad = 0;
+  size_t out = 0;
+
+  for (size_t q = 0; q < fullQuads; q++, in += 4)
+  {
+    uint8_t a = base64Values[in[0]];
+    uint8_t b = base64Values[in[1]];
+    uint8_t c = base64Values[in[2]];
+    uint8_t d = base64Values[in[3]];
+    bad |= a | b | c | d;
+
+    uint32_t v = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6) | d;
+    dst[out++] = (uint8_t)(v >> 16);
+    dst[out++] = (uint8_t)(v >> 8);
+    dst[out++] = (uint8_t)v;
+  }
+
+  if (padding > 0)
+  {
+    uint8_t a = base64Values[in[0]];
+    uint8_t b = base64Values[in[1]];
+    uint8_t c = (padding == 1) ? base64Values[in[2]] : 0;
+    bad |= a | b | c;
+
+    uint32_t v = ((uint32_t)a << 18) | ((uint32_t)b << 12) | ((uint32_t)c << 6);
+    dst[out++] = (uint8_t)(v >> 16);
+    if (padding == 1)
+      dst[out++] = (uint8_t)(v >> 8);
+  }
+
+  return (bad & BASE64_BAD) ? BASE64_INVALID : out;
+}
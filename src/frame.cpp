@@ -0,0 +1,113 @@
+#include "frame.h"
+#include "codec.h"
+
+enum FrameParserState
+{
+  PARSE_SYNC_0,
+  PARSE_SYNC_1,
+  PARSE_TYPE,
+  PARSE_LENGTH_HI,
+  PARSE_LENGTH_LO,
+  PARSE_PAYLOAD,
+  PARSE_CRC
+};
+
+void frameParserInit(FrameParser &parser, uint8_t *payload, uint16_t capacity)
+{
+  parser.payload = payload;
+  parser.capacity = capacity;
+  frameParserReset(parser);
+}
+
+void frameParserReset(FrameParser &parser)
+{
+  parser.state = PARSE_SYNC_0;
+  parser.type = 0;
+  parser.length = 0;
+  parser.received = 0;
+  parser.crc = 0;
+  parser.expectedCrc = 0;
+}
+
+FrameEvent frameParserPush(FrameParser &parser, uint8_t byte)
+{
+  switch (parser.state)
+  {
+  case PARSE_SYNC_0:
+    if (byte == FRAME_SYNC_0)
+      parser.state = PARSE_SYNC_1;
+    return FRAME_NONE;
+
+  case PARSE_SYNC_1:
+    if (byte == FRAME_SYNC_1)
+      parser.state = PARSE_TYPE;
+    else if (byte != FRAME_SYNC_0)
+      parser.state = PARSE_SYNC_0;
+    return FRAME_NONE;
+
+  case PARSE_TYPE:
+    parser.type = byte;
+    parser.crc = crc32Update(0, &byte, 1);
+    parser.state = PARSE_LENGTH_HI;
+    return FRAME_NONE;
+
+  case PARSE_LENGTH_HI:
+    parser.length = (uint16_t)byte << 8;
+    parser.crc = crc32Update(parser.crc, &byte, 1);
+    parser.state = PARSE_LENGTH_LO;
+    return FRAME_NONE;
+
+  case PARSE_LENGTH_LO:
+    parser.length |= byte;
+    parser.crc = crc32Update(parser.crc, &byte, 1);
+    parser.received = 0;
+    parser.expectedCrc = 0;
+    if (parser.length > parser.capacity)
+    {
+      frameParserReset(parser);
+      return FRAME_ERROR_LENGTH;
+    }
+    parser.state = (parser.length > 0) ? PARSE_PAYLOAD : PARSE_CRC;
+    return FRAME_NONE;
+
+  case PARSE_PAYLOAD:
+    parser.payload[parser.received++] = byte;
+    if (parser.received == parser.length)
+    {
+      parser.crc = crc32Update(parser.crc, parser.payload, parser.length);
+      parser.received = 0;
+      parser.state = PARSE_CRC;
+    }
+    return FRAME_NONE;
+
+  case PARSE_CRC:
+    parser.expectedCrc = (parser.expectedCrc << 8) | byte;
+    if (++parser.received < FRAME_CRC_LENGTH)
+      return FRAME_NONE;
+
+    parser.state = PARSE_SYNC_0;
+    parser.received = 0;
+    return (parser.expectedCrc == parser.crc) ? FRAME_READY : FRAME_ERROR_CRC;
+  }
+
+  frameParserReset(parser);
+  return FRAME_NONE;
+}
+
+uint32_t frameWriteHeader(uint8_t *dst, uint8_t type, uint16_t length)
+{
+  dst[0] = FRAME_SYNC_0;
+  dst[1] = FRAME_SYNC_1;
+  dst[2] = type;
+  dst[3] = (uint8_t)(length >> 8);
+  dst[4] = (uint8_t)(length & 0xFF);
+  return crc32Update(0, dst + 2, 3);
+}
+
+void frameWriteCrc(uint8_t *dst, uint32_t crc)
+{
+  dst[0] = (uint8_t)(crc >> 24);
+  dst[1] = (uint8_t)(crc >> 16);
+  dst[2] = (uint8_t)(crc >> 8);
+  dst[3] = (uint8_t)(crc & 0xFF);
+}
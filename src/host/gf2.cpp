@@ -0,0 +1,421 @@
+#include "gf2.h"
+
+#include <algorithm>
+#include <stdio.h>
+#include <string.h>
+#include <thread>
+
+#include "ldpc_bitslice.h"
+#include "ldpc_table_encoder.h"
+
+#define GF2_GROUP_BITS 8                // Pivots per Four Russians table
+#define GF2_TABLES 4                    // Tables applied per pass over the rows
+#define GF2_PARALLEL_WORDS (1UL << 18)  // Smallest clearing pass worth splitting across threads
+
+void Gf2Matrix::resize(uint32_t r, uint32_t c)
+{
+  rows = r;
+  cols = c;
+  stride = ((c + 63) / 64 + 7) & ~7U;
+  words.assign((size_t)rows * stride, 0);
+}
+
+void gf2FromParityMatrix(const ParityMatrix &H, const std::vector<uint32_t> &order, Gf2Matrix &dense)
+{
+  std::vector<uint32_t> position(H.cols);
+  for (uint32_t j = 0; j < H.cols; j++)
+    position[order[j]] = j;
+
+  dense.resize(H.rows, H.cols);
+  for (uint32_t r = 0; r < H.rows; r++)
+  {
+    for (uint32_t col : H.rowCols[r])
+    {
+      uint32_t c = position[col];
+      dense.row(r)[c >> 6] |= 1ULL << (63 - (c & 63));
+    }
+  }
+}
+
+static void xorWords(uint64_t *dst, const uint64_t *src, uint32_t count)
+{
+  for (uint32_t i = 0; i < count; i++)
+    dst[i] ^= src[i];
+}
+
+// Same for whole cache lines, as generic vectors the compiler maps onto the
+// widest registers of the target
+typedef uint64_t Gf2Line __attribute__((vector_size(64), aligned(8)));
+
+static void xorLines(uint64_t *dst, const uint64_t *src, uint32_t count)
+{
+  Gf2Line *d = (Gf2Line *)dst;
+  const Gf2Line *s = (const Gf2Line *)src;
+  for (uint32_t i = 0; i < count / 8; i++)
+    d[i] ^= s[i];
+}
+
+// dst ^= src[0] ^ ... ^ src[GF2_TABLES - 1], whole cache lines
+static void xorLines4(uint64_t *dst, const uint64_t *const *src, uint32_t count)
+{
+  static_assert(GF2_TABLES == 4, "xorLines4 takes four tables");
+  Gf2Line *d = (Gf2Line *)dst;
+  const Gf2Line *a = (const Gf2Line *)src[0];
+  const Gf2Line *b = (const Gf2Line *)src[1];
+  const Gf2Line *c = (const Gf2Line *)src[2];
+  const Gf2Line *e = (const Gf2Line *)src[3];
+  for (uint32_t i = 0; i < count / 8; i++)
+    d[i] ^= a[i] ^ b[i] ^ c[i] ^ e[i];
+}
+
+// Runs fn(first, last) over [0, rows) split across threads
+template <typename Fn>
+static void forRowRanges(uint32_t rows, unsigned threads, Fn fn)
+{
+  if (threads <= 1 || rows < 2 * threads)
+  {
+    fn(0, rows);
+    return;
+  }
+
+  std::vector<std::thread> workers;
+  uint32_t share = (rows + threads - 1) / threads;
+  for (uint32_t first = 0; first < rows; first += share)
+    workers.emplace_back(fn, first, first + share < rows ? first + share : rows);
+  for (std::thread &worker : workers)
+    worker.join();
+}
+
+uint32_t gf2ReduceEchelon(Gf2Matrix &matrix, std::vector<uint32_t> &pivots, unsigned threads)
+{
+  if (threads == 0)
+    threads = std::thread::hardware_concurrency();
+
+  const uint32_t entriesPerTable = 1U << GF2_GROUP_BITS;
+  const uint32_t passPivots = GF2_GROUP_BITS * GF2_TABLES;
+  std::vector<uint64_t> tables((size_t)GF2_TABLES * entriesPerTable * matrix.stride);
+  uint32_t passCols[GF2_GROUP_BITS * GF2_TABLES];
+  uint32_t rank = 0;
+  uint32_t col = 0;
+  pivots.clear();
+
+  while (col < matrix.cols && rank < matrix.rows)
+  {
+    // Rows from `rank` down are zero left of `col`, so every row operation
+    // of this pass starts at the cache line of the first pivot
+    uint32_t firstWord = (col >> 6) & ~7U;
+    uint32_t width = matrix.stride - firstWord;
+    uint32_t count = 0;
+
+    // Up to passPivots pivots, kept reduced against each other
+    for (; count < passPivots && col < matrix.cols && rank + count < matrix.rows; col++)
+    {
+      uint32_t found = matrix.rows;
+      for (uint32_t r = rank + count; r < matrix.rows; r++)
+      {
+        uint64_t *candidate = matrix.row(r) + firstWord;
+        for (uint32_t g = 0; g < count; g++)
+        {
+          if (matrix.get(r, passCols[g]))
+            xorLines(candidate, matrix.row(rank + g) + firstWord, width);
+        }
+        if (matrix.get(r, col))
+        {
+          found = r;
+          break;
+        }
+      }
+      if (found == matrix.rows)
+        continue;
+
+      uint32_t target = rank + count;
+      if (found != target)
+      {
+        for (uint32_t w = firstWord; w < matrix.stride; w++)
+          std::swap(matrix.row(found)[w], matrix.row(target)[w]);
+      }
+      for (uint32_t g = 0; g < count; g++)
+      {
+        if (matrix.get(rank + g, col))
+          xorLines(matrix.row(rank + g) + firstWord, matrix.row(target) + firstWord, width);
+      }
+      passCols[count++] = col;
+    }
+    if (count == 0)
+      break;
+
+    // Table t covers pivots t * 8 .. t * 8 + 7: entry v is the sum of the
+    // pivot rows selected by the bits of v. In Gray code order each entry is
+    // the previous one plus a single row. Entry 0 stays zero, so unused
+    // tables cost nothing but an XOR with zeros.
+    uint8_t tableCount = (count + GF2_GROUP_BITS - 1) / GF2_GROUP_BITS;
+    for (uint8_t t = 0; t < tableCount; t++)
+    {
+      uint64_t *table = tables.data() + (size_t)t * entriesPerTable * width;
+      uint32_t groupSize = count - t * GF2_GROUP_BITS < GF2_GROUP_BITS ? count - t * GF2_GROUP_BITS : GF2_GROUP_BITS;
+      memset(table, 0, width * sizeof(uint64_t));
+      for (uint32_t i = 1; i < (1U << groupSize); i++)
+      {
+        uint32_t gray = i ^ (i >> 1);
+        uint32_t previous = (i - 1) ^ ((i - 1) >> 1);
+        uint8_t bit = __builtin_ctz(gray ^ previous);
+        uint64_t *entry = table + (size_t)gray * width;
+        memcpy(entry, table + (size_t)previous * width, width * sizeof(uint64_t));
+        xorLines(entry, matrix.row(rank + t * GF2_GROUP_BITS + bit) + firstWord, width);
+      }
+    }
+
+    // Every other row reads its bits at the pivot columns first (the tables
+    // leave each other's pivot columns alone) and then streams through once
+    uint32_t passStart = rank;
+    const uint64_t *entries = tables.data();
+    auto clear = [&matrix, &passCols, entries, passStart, count, tableCount, firstWord, width](uint32_t first,
+                                                                                             uint32_t last) {
+      const size_t tableWords = (size_t)entriesPerTable * width;
+      for (uint32_t r = first; r < last; r++)
+      {
+        if (r >= passStart && r < passStart + count)
+          continue;
+        const uint64_t *selected[GF2_TABLES];
+        bool any = false;
+        for (uint8_t t = 0; t < GF2_TABLES; t++)
+        {
+          uint32_t index = 0;
+          for (uint32_t g = t * GF2_GROUP_BITS; g < count && g < (t + 1U) * GF2_GROUP_BITS; g++)
+            index |= (uint32_t)matrix.get(r, passCols[g]) << (g - t * GF2_GROUP_BITS);
+          any |= index != 0;
+          selected[t] = entries + (t < tableCount ? t * tableWords + (size_t)index * width : 0);
+        }
+        if (any)
+          xorLines4(matrix.row(r) + firstWord, selected, width);
+      }
+    };
+    bool parallel = (size_t)matrix.rows * width >= GF2_PARALLEL_WORDS;
+    forRowRanges(matrix.rows, parallel ? threads : 1, clear);
+
+    for (uint32_t g = 0; g < count; g++)
+      pivots.push_back(passCols[g]);
+    rank += count;
+  }
+  return rank;
+}
+
+void gf2Transpose(const Gf2Matrix &src, Gf2Matrix &dst)
+{
+  uint64_t block[64];
+  dst.resize(src.cols, src.rows);
+
+  for (uint32_t rb = 0; rb < src.rows; rb += 64)
+  {
+    for (uint32_t cb = 0; cb < src.cols; cb += 64)
+    {
+      for (uint32_t i = 0; i < 64; i++)
+        block[i] = rb + i < src.rows ? src.row(rb + i)[cb >> 6] : 0;
+      ldpcTransposeBits(block);
+      for (uint32_t i = 0; i < 64 && cb + i < src.cols; i++)
+        dst.row(cb + i)[rb >> 6] = block[i];
+    }
+  }
+}
+
+// Copies `length` bits of src starting at bit srcPos to dst at bit dstPos;
+// dst must be zero in the destination range
+static void orBits(uint64_t *dst, uint32_t dstPos, const uint64_t *src, uint32_t srcPos, uint32_t length)
+{
+  while (length > 0)
+  {
+    uint32_t srcShift = srcPos & 63;
+    uint32_t dstShift = dstPos & 63;
+    uint32_t take = 64 - (srcShift > dstShift ? srcShift : dstShift);
+    if (take > length)
+      take = length;
+
+    uint64_t bits = (src[srcPos >> 6] << srcShift) >> (64 - take);
+    dst[dstPos >> 6] |= bits << (64 - take - dstShift);
+    srcPos += take;
+    dstPos += take;
+    length -= take;
+  }
+}
+
+bool Gf2Generator::identityOrder() const
+{
+  for (uint32_t t = 0; t < N; t++)
+  {
+    if (columnOrder[t] != t)
+      return false;
+  }
+  return true;
+}
+
+bool gf2BuildGenerator(const ParityMatrix &H, Gf2Generator &G, std::string &error, unsigned threads)
+{
+  if (H.rows == 0 || H.cols <= H.rows)
+  {
+    error = "H must have fewer rows than columns";
+    return false;
+  }
+
+  // Eliminate the parity columns first so they become the pivots when they can
+  uint32_t M = H.rows;
+  uint32_t infoCols = H.cols - M;
+  std::vector<uint32_t> order(H.cols);
+  for (uint32_t j = 0; j < H.cols; j++)
+    order[j] = j < M ? infoCols + j : j - M;
+
+  Gf2Matrix reduced;
+  std::vector<uint32_t> pivots;
+  gf2FromParityMatrix(H, order, reduced);
+  uint32_t rank = gf2ReduceEchelon(reduced, pivots, threads);
+  if (rank == 0)
+  {
+    error = "H has no checks";
+    return false;
+  }
+
+  G.N = H.cols;
+  G.rank = rank;
+  G.K = H.cols - rank;
+  G.columnOrder.clear();
+
+  // Information positions are the non-pivot columns in H order
+  std::vector<bool> isPivot(H.cols, false);
+  for (uint32_t p : pivots)
+    isPivot[p] = true;
+  std::vector<uint32_t> freeCols;
+  for (uint32_t j = M; j < H.cols; j++)
+  {
+    if (!isPivot[j])
+      freeCols.push_back(j);
+  }
+  for (uint32_t j = 0; j < M; j++)
+  {
+    if (!isPivot[j])
+      freeCols.push_back(j);
+  }
+  for (uint32_t j : freeCols)
+    G.columnOrder.push_back(order[j]);
+  for (uint32_t p : pivots)
+    G.columnOrder.push_back(order[p]);
+
+  // Pivot row i reads p_i = sum_j R[i][free_j] u_j; gather R's free columns in
+  // runs and transpose into the K x rank parity part
+  Gf2Matrix R;
+  R.resize(rank, G.K);
+  for (uint32_t start = 0; start < freeCols.size();)
+  {
+    uint32_t run = 1;
+    while (start + run < freeCols.size() && freeCols[start + run] == freeCols[start] + run)
+      run++;
+    for (uint32_t i = 0; i < rank; i++)
+      orBits(R.row(i), start, reduced.row(i), freeCols[start], run);
+    start += run;
+  }
+  gf2Transpose(R, G.parity);
+  return true;
+}
+
+int64_t gf2VerifyGenerator(const ParityMatrix &H, const Gf2Generator &G)
+{
+  // Column t of the generator for every codeword position t: a unit vector
+  // for information positions, a row of the transposed parity part otherwise
+  Gf2Matrix columns;
+  gf2Transpose(G.parity, columns);
+
+  std::vector<uint32_t> position(G.N);
+  for (uint32_t t = 0; t < G.N; t++)
+    position[G.columnOrder[t]] = t;
+
+  uint32_t words = (G.K + 63) / 64;
+  std::vector<uint64_t> syndrome(words);
+  for (uint32_t r = 0; r < H.rows; r++)
+  {
+    std::fill(syndrome.begin(), syndrome.end(), 0);
+    for (uint32_t col : H.rowCols[r])
+    {
+      uint32_t t = position[col];
+      if (t < G.K)
+        syndrome[t >> 6] ^= 1ULL << (63 - (t & 63));
+      else
+        xorWords(syndrome.data(), columns.row(t - G.K), words);
+    }
+    for (uint32_t w = 0; w < words; w++)
+    {
+      if (syndrome[w])
+        return (int64_t)w * 64 + __builtin_clzll(syndrome[w]);
+    }
+  }
+  return -1;
+}
+
+// Parity row of the generator, MSB-first bytes
+static void generatorRow(void *context, uint16_t row, uint8_t *rowBits)
+{
+  const Gf2Generator &G = *(const Gf2Generator *)context;
+  const uint64_t *words = G.parity.row(row);
+  for (uint32_t i = 0; i < LDPC_BYTES(G.rank); i++)
+    rowBits[i] = (uint8_t)(words[i >> 3] >> (56 - 8 * (i & 7)));
+}
+
+bool gf2WriteBlob(const char *path, const Gf2Generator &G, uint8_t chunkBits, std::string &error)
+{
+  static_assert(sizeof(Gf2BlobHeader) == 32, "blob header layout");
+
+  uint32_t rowBytes = LDPC_WORDS(G.rank) * sizeof(uint32_t);
+  std::vector<uint8_t> payload;
+  if (chunkBits == 0)
+  {
+    payload.assign((size_t)G.K * rowBytes, 0);
+    for (uint32_t r = 0; r < G.K; r++)
+      generatorRow((void *)&G, r, &payload[(size_t)r * rowBytes]);
+  }
+  else
+  {
+    TableEncoder table;
+    if (G.K > LDPC_MAX_K || G.N > LDPC_MAX_N || !table.build(G.K, G.N, chunkBits, generatorRow, (void *)&G))
+    {
+      error = "cannot build a " + std::to_string(chunkBits) + "-bit table for K=" + std::to_string(G.K) +
+              " N=" + std::to_string(G.N);
+      return false;
+    }
+    const uint8_t *entries = (const uint8_t *)table.tableData();
+    payload.assign(entries, entries + TableEncoder::tableBytes(G.K, G.N, chunkBits));
+  }
+
+  Gf2BlobHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = GF2_BLOB_MAGIC;
+  header.version = GF2_BLOB_VERSION;
+  header.K = G.K;
+  header.N = G.N;
+  header.chunkBits = chunkBits;
+  header.payloadBytes = payload.size();
+  if (G.identityOrder())
+  {
+    header.flags = GF2_BLOB_IDENTITY_ORDER;
+    header.payloadOffset = sizeof(header);
+  }
+  else
+  {
+    header.orderOffset = sizeof(header);
+    header.payloadOffset = sizeof(header) + G.N * sizeof(uint32_t);
+  }
+
+  FILE *out = fopen(path, "wb");
+  if (out == NULL)
+  {
+    error = std::string("cannot create ") + path;
+    return false;
+  }
+  bool ok = fwrite(&header, sizeof(header), 1, out) == 1;
+  if (ok && header.orderOffset)
+    ok = fwrite(G.columnOrder.data(), sizeof(uint32_t), G.N, out) == G.N;
+  if (ok)
+    ok = fwrite(payload.data(), 1, payload.size(), out) == payload.size();
+  if (fclose(out) != 0 || !ok)
+  {
+    error = std::string("cannot write ") + path;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,96 @@
+#ifndef GF2_H
+#define GF2_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "parity_matrix.h"
+
+// Dense GF(2) matrix, one word-packed row per matrix row. Column c is bit
+// (63 - c % 64) of word c / 64, so a row read as big-endian bytes is the
+// MSB-first bit string the encoders use. Rows are padded to a multiple of
+// 8 words (one cache line) and the padding stays zero.
+struct Gf2Matrix
+{
+  uint32_t rows = 0;
+  uint32_t cols = 0;
+  uint32_t stride = 0; // Words per row
+  std::vector<uint64_t> words;
+
+  void resize(uint32_t rows, uint32_t cols);
+
+  uint64_t *row(uint32_t r) { return &words[(size_t)r * stride]; }
+  const uint64_t *row(uint32_t r) const { return &words[(size_t)r * stride]; }
+
+  bool get(uint32_t r, uint32_t c) const { return (row(r)[c >> 6] >> (63 - (c & 63))) & 1; }
+  void flip(uint32_t r, uint32_t c) { row(r)[c >> 6] ^= 1ULL << (63 - (c & 63)); }
+};
+
+// Dense copy of H with its columns taken in `order` (order[j] = column of H
+// that becomes column j)
+void gf2FromParityMatrix(const ParityMatrix &H, const std::vector<uint32_t> &order, Gf2Matrix &dense);
+
+// Reduced row echelon form by the Method of Four Russians: each pass finds up
+// to 32 pivots, combines every 8 pivot rows into a 256-entry table in
+// Gray-code order (one row XOR per entry) and clears all other rows with one
+// lookup per table, so a row is streamed once per 32 pivots. The clearing
+// pass is split across `threads` threads (0: one per hardware thread). Rows
+// are permuted so row i holds pivot i; pivots receives the pivot column of
+// every row up to the rank, which is returned.
+uint32_t gf2ReduceEchelon(Gf2Matrix &matrix, std::vector<uint32_t> &pivots, unsigned threads = 0);
+
+// Transposes src into dst with 64 x 64 bit block transposes
+void gf2Transpose(const Gf2Matrix &src, Gf2Matrix &dst);
+
+// Systematic generator derived from H. Codeword position t holds column
+// columnOrder[t] of H: the K = N - rank information positions first, then
+// the rank parity positions. parity is the K x rank parity part, so parity
+// bits = info * parity. Where the last M columns of H are full rank (every
+// code the encoders support) they are chosen as the parity positions and
+// columnOrder is the identity.
+struct Gf2Generator
+{
+  uint32_t K = 0;
+  uint32_t N = 0;
+  uint32_t rank = 0;
+  std::vector<uint32_t> columnOrder;
+  Gf2Matrix parity;
+
+  bool identityOrder() const;
+};
+
+bool gf2BuildGenerator(const ParityMatrix &H, Gf2Generator &G, std::string &error, unsigned threads = 0);
+
+// Checks H * G^T = 0 for every generator row; returns the first bad row or -1
+int64_t gf2VerifyGenerator(const ParityMatrix &H, const Gf2Generator &G);
+
+// Flash-ready generator blob, little-endian, every section 4-byte aligned:
+//
+//   Gf2BlobHeader
+//   columnOrder    N uint32 (omitted when GF2_BLOB_IDENTITY_ORDER is set)
+//   payload        chunkBits == 0: K parity rows of LDPC_WORDS(N - K) words,
+//                  bits MSB-first in byte order (the LdpcRowSource layout);
+//                  chunkBits 4 / 8: the prebuilt TableEncoder table, ready
+//                  for TableEncoder::attach()
+#define GF2_BLOB_MAGIC 0x4D47444CUL // "LDGM"
+#define GF2_BLOB_VERSION 1
+#define GF2_BLOB_IDENTITY_ORDER 0x0001
+
+struct Gf2BlobHeader
+{
+  uint32_t magic;
+  uint16_t version;
+  uint16_t flags;
+  uint32_t K;
+  uint32_t N;
+  uint8_t chunkBits;
+  uint8_t reserved[3];
+  uint32_t orderOffset;   // Bytes from the start of the blob, 0 if omitted
+  uint32_t payloadOffset;
+  uint32_t payloadBytes;
+};
+
+bool gf2WriteBlob(const char *path, const Gf2Generator &G, uint8_t chunkBits, std::string &error);
+
+#endif
@@ -0,0 +1,22 @@
+#ifndef HOST_DECODE_H
+#define HOST_DECODE_H
+
+#include <stdint.h>
+
+// Lanes per layer step; the lifted rows are padded to a multiple of this
+#define HOST_DECODE_LANES 16
+
+// One layer of the host min-sum decoder, one per instruction set
+// (host_decode_*.cpp). q holds `degree` rows of `lanes` int16 posterior LLRs,
+// already rotated so lane i of every row belongs to check i of the layer;
+// messages holds the matching int8 check-to-variable messages. Both are
+// updated in place with the same arithmetic as QcLayeredDecoder::updateLayer()
+// (posteriors saturate at +-LDPC_POSTERIOR_MAX). lanes is a multiple of
+// HOST_DECODE_LANES. The AVX2 variant returns false if it was not compiled in;
+// callers must check the CPU first (hostDetectIsa()).
+bool hostDecodeLayerScalar(int16_t *q, int8_t *messages, uint8_t degree, uint16_t lanes, uint8_t minSum,
+                           uint8_t parameter);
+bool hostDecodeLayerAvx2(int16_t *q, int8_t *messages, uint8_t degree, uint16_t lanes, uint8_t minSum,
+                         uint8_t parameter);
+
+#endif
@@ -0,0 +1,82 @@
+#include "host_decode.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+
+#include "ldpc_decoder.h"
+
+#pragma GCC target("avx2")
+
+// 16 checks per step: int16 posteriors and the int8 messages widened to int16
+bool hostDecodeLayerAvx2(int16_t *q, int8_t *messages, uint8_t degree, uint16_t lanes, uint8_t minSum,
+                         uint8_t parameter)
+{
+  const __m256i llrMax = _mm256_set1_epi16(LDPC_LLR_MAX);
+  const __m256i param = _mm256_set1_epi16(parameter);
+  const __m256i one = _mm256_set1_epi16(1);
+  const __m256i upper = _mm256_set1_epi16(LDPC_POSTERIOR_MAX);
+  const __m256i lower = _mm256_set1_epi16(-LDPC_POSTERIOR_MAX);
+
+  for (uint16_t i = 0; i < lanes; i += HOST_DECODE_LANES)
+  {
+    __m256i min1 = llrMax;
+    __m256i min2 = llrMax;
+    __m256i minIndex = _mm256_setzero_si256();
+    __m256i signs = _mm256_setzero_si256();
+
+    // Variable-to-check messages, the two smallest magnitudes and the sign parity
+    for (uint8_t d = 0; d < degree; d++)
+    {
+      __m256i *row = (__m256i *)(q + (uint32_t)d * lanes + i);
+      __m128i packed = _mm_loadu_si128((const __m128i *)(messages + (uint32_t)d * lanes + i));
+      __m256i value = _mm256_sub_epi16(_mm256_loadu_si256(row), _mm256_cvtepi8_epi16(packed));
+      _mm256_storeu_si256(row, value);
+
+      __m256i magnitude = _mm256_abs_epi16(value);
+      __m256i smaller = _mm256_cmpgt_epi16(min1, magnitude);
+      min2 = _mm256_min_epi16(min2, _mm256_max_epi16(min1, magnitude));
+      min1 = _mm256_min_epi16(min1, magnitude);
+      minIndex = _mm256_blendv_epi8(minIndex, _mm256_set1_epi16(d), smaller);
+      signs = _mm256_xor_si256(signs, value);
+    }
+
+    if (minSum == LDPC_MINSUM_OFFSET)
+    {
+      min1 = _mm256_subs_epu16(min1, param);
+      min2 = _mm256_subs_epu16(min2, param);
+    }
+    else
+    {
+      min1 = _mm256_srli_epi16(_mm256_mullo_epi16(min1, param), 4); // / LDPC_MINSUM_NORMALIZE_ONE
+      min2 = _mm256_srli_epi16(_mm256_mullo_epi16(min2, param), 4);
+    }
+
+    // Check-to-variable messages and posterior update
+    for (uint8_t d = 0; d < degree; d++)
+    {
+      __m256i *row = (__m256i *)(q + (uint32_t)d * lanes + i);
+      __m256i value = _mm256_loadu_si256(row);
+      __m256i isMin = _mm256_cmpeq_epi16(minIndex, _mm256_set1_epi16(d));
+      __m256i magnitude = _mm256_blendv_epi8(min1, min2, isMin);
+      __m256i message = _mm256_sign_epi16(magnitude, _mm256_or_si256(_mm256_xor_si256(signs, value), one));
+
+      __m256i posterior = _mm256_add_epi16(value, message);
+      _mm256_storeu_si256(row, _mm256_max_epi16(_mm256_min_epi16(posterior, upper), lower));
+
+      __m128i packed = _mm_packs_epi16(_mm256_castsi256_si128(message), _mm256_extracti128_si256(message, 1));
+      _mm_storeu_si128((__m128i *)(messages + (uint32_t)d * lanes + i), packed);
+    }
+  }
+  return true;
+}
+
+#else
+
+bool hostDecodeLayerAvx2(int16_t *q, int8_t *messages, uint8_t degree, uint16_t lanes, uint8_t minSum,
+                         uint8_t parameter)
+{
+  return false;
+}
+
+#endif
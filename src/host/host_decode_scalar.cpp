@@ -0,0 +1,61 @@
+#include "host_decode.h"
+
+#include "ldpc_decoder.h"
+
+bool hostDecodeLayerScalar(int16_t *q, int8_t *messages, uint8_t degree, uint16_t lanes, uint8_t minSum,
+                           uint8_t parameter)
+{
+  for (uint16_t i = 0; i < lanes; i++)
+  {
+    int16_t min1 = LDPC_LLR_MAX;
+    int16_t min2 = LDPC_LLR_MAX;
+    uint8_t minIndex = 0;
+    uint8_t negative = 0;
+
+    for (uint8_t d = 0; d < degree; d++)
+    {
+      int16_t &value = q[(uint32_t)d * lanes + i];
+      value -= messages[(uint32_t)d * lanes + i];
+
+      int16_t magnitude = value < 0 ? -value : value;
+      if (magnitude < min1)
+      {
+        min2 = min1;
+        min1 = magnitude;
+        minIndex = d;
+      }
+      else if (magnitude < min2)
+      {
+        min2 = magnitude;
+      }
+      negative ^= (value < 0);
+    }
+
+    if (minSum == LDPC_MINSUM_OFFSET)
+    {
+      min1 = min1 > parameter ? min1 - parameter : 0;
+      min2 = min2 > parameter ? min2 - parameter : 0;
+    }
+    else
+    {
+      min1 = (min1 * parameter) / LDPC_MINSUM_NORMALIZE_ONE;
+      min2 = (min2 * parameter) / LDPC_MINSUM_NORMALIZE_ONE;
+    }
+
+    for (uint8_t d = 0; d < degree; d++)
+    {
+      int16_t &value = q[(uint32_t)d * lanes + i];
+      int16_t magnitude = (d == minIndex) ? min2 : min1;
+      int8_t message = (int8_t)((negative ^ (value < 0)) ? -magnitude : magnitude);
+      int32_t posterior = (int32_t)value + message;
+      if (posterior > LDPC_POSTERIOR_MAX)
+        posterior = LDPC_POSTERIOR_MAX;
+      if (posterior < -LDPC_POSTERIOR_MAX)
+        posterior = -LDPC_POSTERIOR_MAX;
+
+      messages[(uint32_t)d * lanes + i] = message;
+      value = (int16_t)posterior;
+    }
+  }
+  return true;
+}
@@ -0,0 +1,169 @@
+#include "host_decoder.h"
+
+#include <algorithm>
+#include <string.h>
+
+#include "host_decode.h"
+#include "ldpc_qc_codes.h"
+
+HostDecoder::HostDecoder()
+    : K(0), N(0), graph(0), isa(HOST_ISA_SCALAR), Z(0), lanes(0), infoBits(0), infoOffset(0), parityOffset(0),
+      fullBits(0), usedRows(0), maxDegree(0), iterations(LDPC_DECODER_ITERATIONS), minSum(LDPC_MINSUM_NORMALIZED),
+      minSumParameter(12)
+{
+}
+
+bool HostDecoder::configure(uint16_t k, uint16_t n, HostIsa requested)
+{
+  QcCodeMatch match;
+  graph = NULL;
+  if (!qcFindCode(k, n, match))
+    return false;
+
+  // Same code layout as QcLayeredDecoder::configure()
+  const QcBaseGraph &baseGraph = *match.graph;
+  uint8_t infoCols = baseGraph.cols - baseGraph.rows;
+  uint32_t puncturedBits = (uint32_t)match.punctured * match.Z;
+  uint32_t parityBits = n - (k - puncturedBits);
+  uint8_t rows = (parityBits + match.Z - 1) / match.Z;
+  if (rows > baseGraph.rows)
+    return false;
+
+  entries.clear();
+  rowStart.assign(rows + 1, 0);
+  maxDegree = 0;
+  for (uint8_t r = 0; r < rows; r++)
+  {
+    rowStart[r] = entries.size();
+    for (uint8_t c = 0; c < infoCols + rows; c++)
+    {
+      int16_t s = baseGraph.shifts[r * baseGraph.cols + c];
+      if (s < 0)
+        continue;
+      QcEntry entry;
+      entry.col = c;
+      entry.shift = qcLiftShift(baseGraph, s, match.Z);
+      entries.push_back(entry);
+    }
+    uint8_t degree = entries.size() - rowStart[r];
+    if (degree > maxDegree)
+      maxDegree = degree;
+  }
+  rowStart[rows] = entries.size();
+
+  HostIsa best = hostDetectIsa();
+  if (requested > best)
+    requested = best;
+  isa = requested >= HOST_ISA_AVX2 ? HOST_ISA_AVX2 : HOST_ISA_SCALAR;
+
+  K = k;
+  N = n;
+  Z = match.Z;
+  lanes = (Z + HOST_DECODE_LANES - 1) / HOST_DECODE_LANES * HOST_DECODE_LANES;
+  usedRows = rows;
+  infoBits = k - puncturedBits;
+  infoOffset = puncturedBits;
+  parityOffset = (uint32_t)infoCols * Z;
+  fullBits = (uint32_t)(infoCols + rows) * Z;
+
+  posterior.assign(fullBits, 0);
+  messages.assign(entries.size() * lanes, 0);
+  rotated.assign((size_t)maxDegree * lanes, 0);
+  graph = &baseGraph;
+  return true;
+}
+
+// Copies the posteriors of a layer's entries into `rotated`, check i in lane i
+void HostDecoder::gather(uint8_t row)
+{
+  for (uint16_t e = rowStart[row]; e < rowStart[row + 1]; e++)
+  {
+    const int16_t *column = posterior.data() + (uint32_t)entries[e].col * Z;
+    int16_t *lane = rotated.data() + (size_t)(e - rowStart[row]) * lanes;
+    uint16_t shift = entries[e].shift;
+    memcpy(lane, column + shift, (Z - shift) * sizeof(int16_t));
+    memcpy(lane + Z - shift, column, shift * sizeof(int16_t));
+  }
+}
+
+void HostDecoder::scatter(uint8_t row)
+{
+  for (uint16_t e = rowStart[row]; e < rowStart[row + 1]; e++)
+  {
+    int16_t *column = posterior.data() + (uint32_t)entries[e].col * Z;
+    const int16_t *lane = rotated.data() + (size_t)(e - rowStart[row]) * lanes;
+    uint16_t shift = entries[e].shift;
+    memcpy(column + shift, lane, (Z - shift) * sizeof(int16_t));
+    memcpy(column, lane + Z - shift, shift * sizeof(int16_t));
+  }
+}
+
+// Same stopping rule as QcLayeredDecoder::satisfied(): every check holds and
+// no bit in a check is still an erasure
+bool HostDecoder::satisfied()
+{
+  uint16_t parity[NR_MAX_Z];
+  uint16_t erased[NR_MAX_Z];
+
+  for (uint8_t r = 0; r < usedRows; r++)
+  {
+    gather(r);
+    memset(parity, 0, Z * sizeof(uint16_t));
+    memset(erased, 0, Z * sizeof(uint16_t));
+    for (uint16_t e = rowStart[r]; e < rowStart[r + 1]; e++)
+    {
+      const int16_t *lane = rotated.data() + (size_t)(e - rowStart[r]) * lanes;
+      for (uint16_t i = 0; i < Z; i++)
+      {
+        parity[i] ^= (uint16_t)lane[i];
+        erased[i] |= (lane[i] == 0);
+      }
+    }
+
+    uint16_t failed = 0;
+    for (uint16_t i = 0; i < Z; i++)
+      failed |= (parity[i] >> 15) | erased[i];
+    if (failed)
+      return false;
+  }
+  return true;
+}
+
+bool HostDecoder::decode(const int8_t *llr, uint8_t *info, uint8_t &iterationsUsed)
+{
+  std::fill(posterior.begin(), posterior.end(), 0);
+  std::fill(messages.begin(), messages.end(), 0);
+  for (uint32_t i = K; i < parityOffset; i++)
+    posterior[i] = LDPC_POSTERIOR_MAX; // Filler bits are known zeros
+  for (uint16_t t = 0; t < infoBits; t++)
+    posterior[infoOffset + t] = llr[t];
+  for (uint16_t t = infoBits; t < N; t++)
+    posterior[parityOffset + (t - infoBits)] = llr[t];
+
+  bool ok = satisfied();
+  iterationsUsed = 0;
+  while (!ok && iterationsUsed < iterations)
+  {
+    for (uint8_t r = 0; r < usedRows; r++)
+    {
+      uint8_t degree = rowStart[r + 1] - rowStart[r];
+      int8_t *layer = messages.data() + (size_t)rowStart[r] * lanes;
+      gather(r);
+      if (isa == HOST_ISA_AVX2)
+        hostDecodeLayerAvx2(rotated.data(), layer, degree, lanes, minSum, minSumParameter);
+      else
+        hostDecodeLayerScalar(rotated.data(), layer, degree, lanes, minSum, minSumParameter);
+      scatter(r);
+    }
+    iterationsUsed++;
+    ok = satisfied();
+  }
+
+  memset(info, 0, LDPC_BYTES(K));
+  for (uint16_t i = 0; i < K; i++)
+  {
+    if (posterior[i] < 0)
+      info[i >> 3] |= (uint8_t)(0x80 >> (i & 7));
+  }
+  return ok;
+}
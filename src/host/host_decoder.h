@@ -0,0 +1,68 @@
+#ifndef HOST_DECODER_H
+#define HOST_DECODER_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "host_encoder.h"
+#include "ldpc_decoder.h"
+
+// Layered min-sum decoder for the native tools, vectorised across the Z
+// checks of a layer. Before each layer the posteriors of every entry are
+// copied out rotated by the entry's shift, so check i of the layer sits in
+// lane i of every row; the layer then runs as straight int16 vector code
+// (host_decode_*.cpp) and the rows are copied back. The arithmetic matches
+// QcLayeredDecoder exactly, so the simulated error rates are the device's.
+// Scratch memory is owned by the decoder, so use one instance per thread.
+class HostDecoder
+{
+public:
+  HostDecoder();
+
+  // Returns false if (K, N) is not a built-in code. isa is clamped to what
+  // the CPU supports; anything from AVX2 up uses the AVX2 layer kernel.
+  bool configure(uint16_t K, uint16_t N, HostIsa isa = HOST_ISA_COUNT);
+
+  void setIterations(uint8_t maxIterations) { iterations = maxIterations ? maxIterations : 1; }
+  void setMinSum(LdpcMinSum kind, uint8_t parameter)
+  {
+    minSum = kind;
+    minSumParameter = parameter;
+  }
+
+  // Same contract as QcLayeredDecoder::decode()
+  bool decode(const int8_t *llr, uint8_t *info, uint8_t &iterationsUsed);
+
+  HostIsa activeIsa() const { return isa; }
+  const char *codeName() const { return graph ? graph->name : "?"; }
+
+  uint16_t K;
+  uint16_t N;
+
+private:
+  void gather(uint8_t row);
+  void scatter(uint8_t row);
+  bool satisfied();
+
+  const QcBaseGraph *graph;
+  HostIsa isa;
+  std::vector<QcEntry> entries;
+  std::vector<uint16_t> rowStart;
+  uint16_t Z;
+  uint16_t lanes; // Z rounded up to HOST_DECODE_LANES
+  uint16_t infoBits;
+  uint32_t infoOffset;
+  uint32_t parityOffset;
+  uint32_t fullBits;
+  uint8_t usedRows;
+  uint8_t maxDegree;
+  uint8_t iterations;
+  uint8_t minSum;
+  uint8_t minSumParameter;
+
+  std::vector<int16_t> posterior; // fullBits
+  std::vector<int8_t> messages;   // rowStart[usedRows] * lanes, layer by layer
+  std::vector<int16_t> rotated;   // maxDegree * lanes
+};
+
+#endif
@@ -0,0 +1,87 @@
+#include "host_encoder.h"
+
+#include <string.h>
+
+#include "host_slice.h"
+#include "ldpc_qc_codes.h"
+
+typedef bool (*SliceEncodeFn)(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                              uint8_t *out);
+
+static const SliceEncodeFn sliceEncoders[HOST_ISA_COUNT] = {hostSliceEncodeScalar, hostSliceEncodeSse4,
+                                                             hostSliceEncodeAvx2, hostSliceEncodeAvx512};
+
+HostIsa hostDetectIsa()
+{
+#if defined(__x86_64__) || defined(__i386__)
+  __builtin_cpu_init();
+  if (__builtin_cpu_supports("avx512f"))
+    return HOST_ISA_AVX512;
+  if (__builtin_cpu_supports("avx2"))
+    return HOST_ISA_AVX2;
+  if (__builtin_cpu_supports("sse4.1"))
+    return HOST_ISA_SSE4;
+#endif
+  return HOST_ISA_SCALAR;
+}
+
+const char *hostIsaName(HostIsa isa)
+{
+  switch (isa)
+  {
+  case HOST_ISA_SCALAR:
+    return "scalar";
+  case HOST_ISA_SSE4:
+    return "SSE4.1";
+  case HOST_ISA_AVX2:
+    return "AVX2";
+  case HOST_ISA_AVX512:
+    return "AVX-512";
+  default:
+    return "?";
+  }
+}
+
+bool HostEncoder::configure(uint16_t K, uint16_t N, HostIsa isa)
+{
+  HostIsa best = hostDetectIsa();
+  this->K = K;
+  this->N = N;
+  this->isa = isa < best ? isa : best;
+
+  sliced = hostSliceAvailable(K, N);
+  if (sliced)
+    return true;
+
+  QcCodeMatch match;
+  return qcFindCode(K, N, match) && fallback.configure(*match.graph, match.Z, K, N, match.punctured);
+}
+
+bool HostEncoder::encode(const uint8_t *message, uint32_t messageBits, uint32_t blocks, uint8_t *out)
+{
+  if (sliced)
+    return sliceEncoders[isa](K, N, message, messageBits, blocks, out);
+
+
+  // Same zero padding as ldpcEncodeBlocks(), without its 16-bit length limit
+  uint32_t kBytes = LDPC_BYTES(K);
+  uint32_t nBytes = LDPC_BYTES(N);
+  uint32_t messageBytes = LDPC_BYTES(messageBits);
+  uint8_t info[LDPC_BYTES(LDPC_MAX_K)];
+
+  for (uint32_t block = 0; block < blocks; block++)
+  {
+    uint32_t start = block * kBytes;
+    const uint8_t *src = message + start;
+
+    if (start + kBytes > messageBytes)
+    {
+      uint32_t available = start < messageBytes ? messageBytes - start : 0;
+      memcpy(info, src, available);
+      memset(info + available, 0, kBytes - available);
+      src = info;
+    }
+    fallback.encodeBlock(src, out + (uint64_t)block * nBytes);
+  }
+  return true;
+}
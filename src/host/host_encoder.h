@@ -0,0 +1,53 @@
+#ifndef HOST_ENCODER_H
+#define HOST_ENCODER_H
+
+#include <stdint.h>
+
+#include "ldpc_qc.h"
+
+// Instruction sets the host encoder can dispatch to, in increasing width
+enum HostIsa
+{
+  HOST_ISA_SCALAR = 0, // 64 blocks per pass
+  HOST_ISA_SSE4 = 1,   // 128 blocks per pass
+  HOST_ISA_AVX2 = 2,   // 256 blocks per pass
+  HOST_ISA_AVX512 = 3, // 512 blocks per pass
+  HOST_ISA_COUNT
+};
+
+// Widest instruction set this CPU supports
+HostIsa hostDetectIsa();
+const char *hostIsaName(HostIsa isa);
+
+// Reference encoder for the native tools. Produces exactly the bytes the
+// device writes to encoded_buffer for the same message, so captured sessions
+// can be checked block by block. Codes with a generated XOR kernel are
+// bit-sliced across the widest supported vectors; other built-in codes fall
+// back to the portable QC encoder.
+class HostEncoder
+{
+public:
+  HostEncoder() : K(0), N(0), isa(HOST_ISA_SCALAR), sliced(false) {}
+
+  // Returns false if (K, N) is neither a kernel nor a built-in code. isa is
+  // clamped to what the CPU supports.
+  bool configure(uint16_t K, uint16_t N, HostIsa isa = HOST_ISA_COUNT);
+
+  // Encodes `blocks` blocks of message into out (blocks * LDPC_BYTES(N) bytes).
+  // Returns false if the bit-sliced encoder cannot allocate its scratch.
+  bool encode(const uint8_t *message, uint32_t messageBits, uint32_t blocks, uint8_t *out);
+
+  // Instruction set in use; meaningful only when bitSliced()
+  HostIsa activeIsa() const { return isa; }
+  bool bitSliced() const { return sliced; }
+
+  uint16_t K;
+  uint16_t N;
+
+private:
+  HostIsa isa;
+  bool sliced;
+  QcEncoder fallback;
+};
+
+#endif
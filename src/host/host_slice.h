@@ -0,0 +1,27 @@
+#ifndef HOST_SLICE_H
+#define HOST_SLICE_H
+
+#include <stdint.h>
+
+// Codes with a generated kernel header included by host_slice_impl.h
+#define HOST_KERNELS(X) X(324, 648)
+
+// True if (K, N) is in HOST_KERNELS
+bool hostSliceAvailable(uint16_t K, uint16_t N);
+
+// Bit-sliced encoders for codes with a generated XOR kernel, one per
+// instruction set (host_slice_*.cpp). Each encodes `blocks` blocks of message
+// into out with the device layout of encoded_buffer and returns false if
+// (K, N) has no kernel, the instruction set was not compiled in or the
+// scratch slices cannot be allocated. Callers
+// must check the CPU first (hostDetectIsa()).
+bool hostSliceEncodeScalar(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                           uint8_t *out);
+bool hostSliceEncodeSse4(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                         uint8_t *out);
+bool hostSliceEncodeAvx2(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                         uint8_t *out);
+bool hostSliceEncodeAvx512(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                           uint8_t *out);
+
+#endif
@@ -0,0 +1,63 @@
+#include "host_slice.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ldpc_xor_kernel.h"
+
+#pragma GCC target("avx2")
+
+namespace
+{
+
+const unsigned LANE_WORDS = 4;
+
+struct Lanes
+{
+  __m256i v;
+
+  Lanes() = default;
+  Lanes(int zero) : v(_mm256_set1_epi64x((long long)zero)) {}
+
+  static Lanes broadcast(uint64_t word) { return fromVector(_mm256_set1_epi64x((long long)word)); }
+  static Lanes load(const uint64_t *words) { return fromVector(_mm256_loadu_si256((__m256i *)words)); }
+  void store(uint64_t *words) const { _mm256_storeu_si256((__m256i *)words, v); }
+
+  static Lanes fromVector(__m256i vector)
+  {
+    Lanes lanes;
+    lanes.v = vector;
+    return lanes;
+  }
+
+  Lanes operator^(Lanes other) const { return fromVector(_mm256_xor_si256(v, other.v)); }
+  Lanes operator|(Lanes other) const { return fromVector(_mm256_or_si256(v, other.v)); }
+  Lanes operator&(Lanes other) const { return fromVector(_mm256_and_si256(v, other.v)); }
+  Lanes operator>>(unsigned n) const { return fromVector(_mm256_srli_epi64(v, n)); }
+  Lanes operator<<(unsigned n) const { return fromVector(_mm256_slli_epi64(v, n)); }
+  Lanes &operator^=(Lanes other) { v = _mm256_xor_si256(v, other.v); return *this; }
+  Lanes &operator|=(Lanes other) { v = _mm256_or_si256(v, other.v); return *this; }
+};
+
+} // namespace
+
+#include "host_slice_impl.h"
+
+bool hostSliceEncodeAvx2(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                         uint8_t *out)
+{
+  return encodeWithKernel(K, N, message, messageBits, blocks, out);
+}
+
+#else
+
+bool hostSliceEncodeAvx2(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                         uint8_t *out)
+{
+  return false;
+}
+
+#endif
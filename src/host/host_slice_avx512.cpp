@@ -0,0 +1,63 @@
+#include "host_slice.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ldpc_xor_kernel.h"
+
+#pragma GCC target("avx512f")
+
+namespace
+{
+
+const unsigned LANE_WORDS = 8;
+
+struct Lanes
+{
+  __m512i v;
+
+  Lanes() = default;
+  Lanes(int zero) : v(_mm512_set1_epi64((long long)zero)) {}
+
+  static Lanes broadcast(uint64_t word) { return fromVector(_mm512_set1_epi64((long long)word)); }
+  static Lanes load(const uint64_t *words) { return fromVector(_mm512_loadu_si512((__m512i *)words)); }
+  void store(uint64_t *words) const { _mm512_storeu_si512((__m512i *)words, v); }
+
+  static Lanes fromVector(__m512i vector)
+  {
+    Lanes lanes;
+    lanes.v = vector;
+    return lanes;
+  }
+
+  Lanes operator^(Lanes other) const { return fromVector(_mm512_xor_si512(v, other.v)); }
+  Lanes operator|(Lanes other) const { return fromVector(_mm512_or_si512(v, other.v)); }
+  Lanes operator&(Lanes other) const { return fromVector(_mm512_and_si512(v, other.v)); }
+  Lanes operator>>(unsigned n) const { return fromVector(_mm512_maskz_srli_epi64((__mmask8)0xFF, v, n)); }
+  Lanes operator<<(unsigned n) const { return fromVector(_mm512_maskz_slli_epi64((__mmask8)0xFF, v, n)); }
+  Lanes &operator^=(Lanes other) { v = _mm512_xor_si512(v, other.v); return *this; }
+  Lanes &operator|=(Lanes other) { v = _mm512_or_si512(v, other.v); return *this; }
+};
+
+} // namespace
+
+#include "host_slice_impl.h"
+
+bool hostSliceEncodeAvx512(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                           uint8_t *out)
+{
+  return encodeWithKernel(K, N, message, messageBits, blocks, out);
+}
+
+#else
+
+bool hostSliceEncodeAvx512(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                           uint8_t *out)
+{
+  return false;
+}
+
+#endif
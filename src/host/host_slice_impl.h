@@ -0,0 +1,156 @@
+// Bit-sliced batch encoding shared by the per-ISA translation units
+// (host_slice_*.cpp). Each unit includes ldpc_xor_kernel.h, switches the
+// target instruction set, defines `Lanes` (LANE_WORDS 64-bit elements with
+// bitwise operators and per-element shifts) and then includes this file, so
+// the kernels below are compiled for that instruction set. Everything here
+// lives in an anonymous namespace so the instantiations of different units
+// never merge at link time.
+//
+// A batch is 64 * LANE_WORDS blocks. Element g of every slice carries blocks
+// g * 64 .. g * 64 + 63, so the 64 x 64 transposes of the LANE_WORDS groups run
+// side by side in the vector elements.
+#ifndef HOST_SLICE_IMPL_H
+#define HOST_SLICE_IMPL_H
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "host_slice.h"
+#include "ldpc_kernel_324_648.h"
+
+namespace
+{
+
+const unsigned BATCH_BLOCKS = 64 * LANE_WORDS;
+
+// Transposes the 64 x 64 bit matrix held in every element of rows[0..63]
+void transposeLanes(Lanes *rows)
+{
+  static const uint64_t masks[] = {0x00000000FFFFFFFFULL, 0x0000FFFF0000FFFFULL, 0x00FF00FF00FF00FFULL,
+                                   0x0F0F0F0F0F0F0F0FULL, 0x3333333333333333ULL, 0x5555555555555555ULL};
+  unsigned stage = 0;
+
+  for (unsigned j = 32; j != 0; j >>= 1, stage++)
+  {
+    Lanes mask = Lanes::broadcast(masks[stage]);
+    for (unsigned k = 0; k < 64; k = ((k | j) + 1) & ~j)
+    {
+      Lanes t = (rows[k] ^ (rows[k | j] >> j)) & mask;
+      rows[k] ^= t;
+      rows[k | j] ^= t << j;
+    }
+  }
+}
+
+// MSB-first 64-bit word of a block at byte offset `byte`, zero past `available`
+inline uint64_t loadBlockWord(const uint8_t *block, uint32_t byte, uint32_t available)
+{
+  uint64_t word = 0;
+  if (byte + 8 <= available)
+  {
+    memcpy(&word, block + byte, 8);
+    return __builtin_bswap64(word);
+  }
+  for (uint32_t i = byte; i < byte + 8; i++)
+    word = (word << 8) | (i < available ? block[i] : 0);
+  return word;
+}
+
+inline void storeBlockWord(uint8_t *block, uint32_t byte, uint32_t bytes, uint64_t word)
+{
+  if (byte + 8 <= bytes)
+  {
+    word = __builtin_bswap64(word);
+    memcpy(block + byte, &word, 8);
+    return;
+  }
+  for (uint32_t i = 0; byte + i < bytes; i++)
+    block[byte + i] = (uint8_t)(word >> (56 - 8 * i));
+}
+
+// Returns false if the codeword slices cannot be allocated
+template <uint16_t K, uint16_t N>
+bool encodeSliced(const uint8_t *message, uint32_t messageBits, uint32_t blocks, uint8_t *out)
+{
+  const uint32_t kBytes = LDPC_BYTES(K);
+  const uint32_t nBytes = LDPC_BYTES(N);
+  const uint32_t slices = (N + 63) / 64 * 64;
+  const uint32_t messageBytes = LDPC_BYTES(messageBits);
+
+  // aligned_alloc() takes a size that is a multiple of the alignment
+  const size_t align = alignof(Lanes) > sizeof(void *) ? alignof(Lanes) : sizeof(void *);
+  const size_t bytes = (slices * sizeof(Lanes) + align - 1) / align * align;
+  Lanes *codeword = (Lanes *)aligned_alloc(align, bytes);
+  if (codeword == NULL)
+    return false;
+
+  Lanes rows[64];
+  uint64_t words[LANE_WORDS];
+
+  for (uint32_t first = 0; first < blocks; first += BATCH_BLOCKS)
+  {
+    uint32_t count = blocks - first < BATCH_BLOCKS ? blocks - first : BATCH_BLOCKS;
+
+    for (uint32_t bit = 0; bit < K; bit += 64)
+    {
+      for (unsigned r = 0; r < 64; r++)
+      {
+        for (unsigned g = 0; g < LANE_WORDS; g++)
+        {
+          uint32_t block = first + g * 64 + r;
+          uint32_t start = block * kBytes;
+          uint32_t available = start >= messageBytes ? 0 : messageBytes - start;
+          if (available > kBytes)
+            available = kBytes;
+          words[g] = block < blocks ? loadBlockWord(message + start, bit / 8, available) : 0;
+        }
+        rows[r] = Lanes::load(words);
+      }
+      transposeLanes(rows);
+      for (unsigned i = 0; i < 64; i++)
+        codeword[bit + i] = rows[i];
+    }
+
+    LdpcXorKernel<K, N>::encode(codeword, codeword + K);
+    for (uint32_t i = N; i < slices; i++)
+      codeword[i] = Lanes(0);
+
+    for (uint32_t bit = 0; bit < N; bit += 64)
+    {
+      for (unsigned i = 0; i < 64; i++)
+        rows[i] = codeword[bit + i];
+      transposeLanes(rows);
+      for (unsigned r = 0; r < 64; r++)
+      {
+        rows[r].store(words);
+        for (unsigned g = 0; g < LANE_WORDS; g++)
+        {
+          if (g * 64 + r < count)
+            storeBlockWord(out + (uint64_t)(first + g * 64 + r) * nBytes, bit / 8, nBytes, words[g]);
+        }
+      }
+    }
+  }
+
+  free(codeword);
+  return true;
+}
+
+// Codes with a generated kernel; returns false for any other (K, N) or when
+// the scratch cannot be allocated
+bool encodeWithKernel(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                      uint8_t *out)
+{
+#define HOST_KERNEL_CASE(k, n)                             \
+  if (K == k && N == n)                                    \
+  {                                                        \
+    return encodeSliced<k, n>(message, messageBits, blocks, out); \
+  }
+  HOST_KERNELS(HOST_KERNEL_CASE)
+#undef HOST_KERNEL_CASE
+  return false;
+}
+
+} // namespace
+
+#endif
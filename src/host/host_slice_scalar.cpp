@@ -0,0 +1,58 @@
+#include "host_slice.h"
+
+#include <stdlib.h>
+#include <string.h>
+
+#include "ldpc_xor_kernel.h"
+
+namespace
+{
+
+const unsigned LANE_WORDS = 1;
+
+struct Lanes
+{
+  uint64_t v;
+
+  Lanes() = default;
+  Lanes(int zero) : v((uint64_t)zero) {}
+
+  static Lanes broadcast(uint64_t word) { return fromWord(word); }
+  static Lanes load(const uint64_t *words) { return fromWord(words[0]); }
+  void store(uint64_t *words) const { words[0] = v; }
+
+  static Lanes fromWord(uint64_t word)
+  {
+    Lanes lanes;
+    lanes.v = word;
+    return lanes;
+  }
+
+  Lanes operator^(Lanes other) const { return fromWord(v ^ other.v); }
+  Lanes operator|(Lanes other) const { return fromWord(v | other.v); }
+  Lanes operator&(Lanes other) const { return fromWord(v & other.v); }
+  Lanes operator>>(unsigned n) const { return fromWord(v >> n); }
+  Lanes operator<<(unsigned n) const { return fromWord(v << n); }
+  Lanes &operator^=(Lanes other) { v ^= other.v; return *this; }
+  Lanes &operator|=(Lanes other) { v |= other.v; return *this; }
+};
+
+} // namespace
+
+#include "host_slice_impl.h"
+
+bool hostSliceEncodeScalar(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                           uint8_t *out)
+{
+  return encodeWithKernel(K, N, message, messageBits, blocks, out);
+}
+
+bool hostSliceAvailable(uint16_t K, uint16_t N)
+{
+#define HOST_KERNEL_MATCH(k, n) \
+  if (K == k && N == n)         \
+    return true;
+  HOST_KERNELS(HOST_KERNEL_MATCH)
+#undef HOST_KERNEL_MATCH
+  return false;
+}
@@ -0,0 +1,63 @@
+#include "host_slice.h"
+
+#if defined(__x86_64__) || defined(__i386__)
+
+#include <immintrin.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ldpc_xor_kernel.h"
+
+#pragma GCC target("sse4.1")
+
+namespace
+{
+
+const unsigned LANE_WORDS = 2;
+
+struct Lanes
+{
+  __m128i v;
+
+  Lanes() = default;
+  Lanes(int zero) : v(_mm_set1_epi64x((long long)zero)) {}
+
+  static Lanes broadcast(uint64_t word) { return fromVector(_mm_set1_epi64x((long long)word)); }
+  static Lanes load(const uint64_t *words) { return fromVector(_mm_loadu_si128((__m128i *)words)); }
+  void store(uint64_t *words) const { _mm_storeu_si128((__m128i *)words, v); }
+
+  static Lanes fromVector(__m128i vector)
+  {
+    Lanes lanes;
+    lanes.v = vector;
+    return lanes;
+  }
+
+  Lanes operator^(Lanes other) const { return fromVector(_mm_xor_si128(v, other.v)); }
+  Lanes operator|(Lanes other) const { return fromVector(_mm_or_si128(v, other.v)); }
+  Lanes operator&(Lanes other) const { return fromVector(_mm_and_si128(v, other.v)); }
+  Lanes operator>>(unsigned n) const { return fromVector(_mm_srli_epi64(v, n)); }
+  Lanes operator<<(unsigned n) const { return fromVector(_mm_slli_epi64(v, n)); }
+  Lanes &operator^=(Lanes other) { v = _mm_xor_si128(v, other.v); return *this; }
+  Lanes &operator|=(Lanes other) { v = _mm_or_si128(v, other.v); return *this; }
+};
+
+} // namespace
+
+#include "host_slice_impl.h"
+
+bool hostSliceEncodeSse4(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                         uint8_t *out)
+{
+  return encodeWithKernel(K, N, message, messageBits, blocks, out);
+}
+
+#else
+
+bool hostSliceEncodeSse4(uint16_t K, uint16_t N, const uint8_t *message, uint32_t messageBits, uint32_t blocks,
+                         uint8_t *out)
+{
+  return false;
+}
+
+#endif
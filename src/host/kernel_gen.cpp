@@ -0,0 +1,335 @@
+#include "kernel_gen.h"
+
+#include <stdio.h>
+
+typedef std::vector<uint64_t> BitRow;
+
+static void flipBit(BitRow &row, uint32_t bit)
+{
+  row[bit >> 6] ^= 1ULL << (bit & 63);
+}
+
+static bool testBit(const BitRow &row, uint32_t bit)
+{
+  return (row[bit >> 6] >> (bit & 63)) & 1;
+}
+
+static void xorInto(BitRow &dst, const BitRow &src)
+{
+  for (size_t i = 0; i < dst.size(); i++)
+    dst[i] ^= src[i];
+}
+
+// Gauss-Jordan inverse of a g x g matrix; false if singular
+static bool invert(std::vector<BitRow> matrix, std::vector<BitRow> &inverse, uint32_t g)
+{
+  size_t words = (g + 63) / 64;
+  inverse.assign(g, BitRow(words, 0));
+  for (uint32_t i = 0; i < g; i++)
+    flipBit(inverse[i], i);
+
+  for (uint32_t col = 0; col < g; col++)
+  {
+    uint32_t pivot = col;
+    while (pivot < g && !testBit(matrix[pivot], col))
+      pivot++;
+    if (pivot == g)
+      return false;
+
+    std::swap(matrix[pivot], matrix[col]);
+    std::swap(inverse[pivot], inverse[col]);
+    for (uint32_t r = 0; r < g; r++)
+    {
+      if (r != col && testBit(matrix[r], col))
+      {
+        xorInto(matrix[r], matrix[col]);
+        xorInto(inverse[r], inverse[col]);
+      }
+    }
+  }
+  return true;
+}
+
+bool buildSchedule(const ParityMatrix &H, EncodingSchedule &schedule, std::string &error)
+{
+  uint32_t M = H.rows;
+  uint32_t K = H.cols - H.rows;
+  schedule = EncodingSchedule();
+  schedule.K = K;
+  schedule.M = M;
+  schedule.symbolic.assign(M, -1);
+
+  // Parity adjacency and the number of unresolved parity bits per check
+  std::vector<std::vector<uint32_t>> parityRows(M);
+  std::vector<uint32_t> unresolved(M, 0);
+  for (uint32_t r = 0; r < M; r++)
+  {
+    for (uint32_t col : H.rowCols[r])
+    {
+      if (col >= K)
+      {
+        parityRows[col - K].push_back(r);
+        unresolved[r]++;
+      }
+    }
+  }
+
+  std::vector<bool> resolved(M, false);
+  std::vector<bool> rowUsed(M, false);
+  std::vector<uint32_t> ready;
+  uint32_t remaining = M;
+  uint32_t symbolicCount = 0;
+
+  for (uint32_t r = 0; r < M; r++)
+  {
+    if (unresolved[r] == 1)
+      ready.push_back(r);
+  }
+
+  auto resolve = [&](uint32_t parity) {
+    resolved[parity] = true;
+    remaining--;
+    for (uint32_t r : parityRows[parity])
+    {
+      if (--unresolved[r] == 1 && !rowUsed[r])
+        ready.push_back(r);
+    }
+  };
+
+  while (remaining > 0)
+  {
+    if (!ready.empty())
+    {
+      uint32_t r = ready.back();
+      ready.pop_back();
+      if (rowUsed[r] || unresolved[r] != 1)
+        continue;
+
+      for (uint32_t col : H.rowCols[r])
+      {
+        if (col >= K && !resolved[col - K])
+        {
+          rowUsed[r] = true;
+          schedule.steps.push_back({col - K, r});
+          resolve(col - K);
+          break;
+        }
+      }
+      continue;
+    }
+
+    // Stalled: in a check with the fewest unknowns, make the unknown with the
+    // most unresolved checks symbolic
+    uint32_t bestRow = M;
+    for (uint32_t r = 0; r < M; r++)
+    {
+      if (!rowUsed[r] && unresolved[r] >= 2 && (bestRow == M || unresolved[r] < unresolved[bestRow]))
+        bestRow = r;
+    }
+    if (bestRow == M)
+    {
+      error = "parity part is rank deficient: some parity bits appear in no usable check";
+      return false;
+    }
+
+    uint32_t bestParity = M;
+    uint32_t bestWeight = 0;
+    for (uint32_t col : H.rowCols[bestRow])
+    {
+      if (col < K || resolved[col - K])
+        continue;
+      uint32_t weight = 0;
+      for (uint32_t r : parityRows[col - K])
+        weight += !rowUsed[r];
+      if (bestParity == M || weight > bestWeight)
+      {
+        bestParity = col - K;
+        bestWeight = weight;
+      }
+    }
+
+    schedule.symbolic[bestParity] = symbolicCount++;
+    resolve(bestParity);
+  }
+
+  for (uint32_t r = 0; r < M; r++)
+  {
+    if (!rowUsed[r])
+      schedule.leftoverRows.push_back(r);
+  }
+  if (schedule.leftoverRows.size() != symbolicCount)
+  {
+    error = "parity part is singular (redundant checks); reorder the columns or remove dependent rows";
+    return false;
+  }
+
+  // Propagate the dependence on the symbolic bits through the steps
+  uint32_t g = symbolicCount;
+  size_t words = (g + 63) / 64;
+  std::vector<BitRow> deps(M, BitRow(words, 0));
+  for (uint32_t p = 0; p < M; p++)
+  {
+    if (schedule.symbolic[p] >= 0)
+      flipBit(deps[p], schedule.symbolic[p]);
+  }
+  for (const EncodingSchedule::Step &step : schedule.steps)
+  {
+    for (uint32_t col : H.rowCols[step.row])
+    {
+      if (col >= K && col - K != step.parity)
+        xorInto(deps[step.parity], deps[col - K]);
+    }
+  }
+
+  std::vector<BitRow> phi(g, BitRow(words, 0));
+  for (uint32_t i = 0; i < g; i++)
+  {
+    for (uint32_t col : H.rowCols[schedule.leftoverRows[i]])
+    {
+      if (col >= K)
+        xorInto(phi[i], deps[col - K]);
+    }
+  }
+
+  std::vector<BitRow> inverse;
+  if (!invert(phi, inverse, g))
+  {
+    error = "parity part is singular: symbolic system has no unique solution";
+    return false;
+  }
+
+  schedule.inverse.assign(g, std::vector<uint32_t>());
+  for (uint32_t i = 0; i < g; i++)
+  {
+    for (uint32_t j = 0; j < g; j++)
+    {
+      if (testBit(inverse[i], j))
+        schedule.inverse[i].push_back(j);
+    }
+  }
+
+  schedule.corrections.assign(M, std::vector<uint32_t>());
+  for (uint32_t p = 0; p < M; p++)
+  {
+    if (schedule.symbolic[p] >= 0)
+      continue;
+    for (uint32_t k = 0; k < g; k++)
+    {
+      if (testBit(deps[p], k))
+        schedule.corrections[p].push_back(k);
+    }
+  }
+  return true;
+}
+
+// Writes "a ^ b ^ c" for the variables of a check except `skip`, with symbolic
+// parity bits left out (they are zero in the first pass). Returns the XOR count.
+static uint32_t writeCheckTerms(FILE *out, const ParityMatrix &H, const EncodingSchedule &schedule, uint32_t row,
+                                int64_t skip)
+{
+  uint32_t K = schedule.K;
+  uint32_t terms = 0;
+
+  for (uint32_t col : H.rowCols[row])
+  {
+    if ((int64_t)col == skip || (col >= K && schedule.symbolic[col - K] >= 0))
+      continue;
+    if (col < K)
+      fprintf(out, "%su[%u]", terms ? " ^ " : "", col);
+    else
+      fprintf(out, "%sp[%u]", terms ? " ^ " : "", col - K);
+    terms++;
+  }
+  if (terms == 0)
+    fprintf(out, "0");
+  return terms ? terms - 1 : 0;
+}
+
+bool writeKernelHeader(const char *path, const char *source, const ParityMatrix &H,
+                       const EncodingSchedule &schedule, std::string &error)
+{
+  FILE *out = fopen(path, "w");
+  if (out == NULL)
+  {
+    error = std::string("cannot create ") + path;
+    return false;
+  }
+
+  uint32_t K = schedule.K;
+  uint32_t N = H.cols;
+  uint32_t g = schedule.leftoverRows.size();
+  uint32_t encodeXors = 0;
+  uint32_t syndromeXors = 0;
+
+  for (const EncodingSchedule::Step &step : schedule.steps)
+    encodeXors += H.rowCols[step.row].size() > 2 ? H.rowCols[step.row].size() - 2 : 0;
+  for (uint32_t i = 0; i < g; i++)
+    encodeXors += H.rowCols[schedule.leftoverRows[i]].size() + schedule.inverse[i].size();
+  for (uint32_t p = 0; p < schedule.M; p++)
+    encodeXors += schedule.corrections[p].size();
+  for (uint32_t r = 0; r < H.rows; r++)
+    syndromeXors += H.rowCols[r].size();
+
+  fprintf(out, "// Generated by `ldpc_host gen-kernel %s`; do not edit.\n", source);
+  fprintf(out, "// K = %u, N = %u, %zu peeled parity bits, %u symbolic, ~%u XORs to encode\n", K, N,
+          schedule.steps.size(), g, encodeXors);
+  fprintf(out, "#ifndef LDPC_KERNEL_%u_%u_H\n#define LDPC_KERNEL_%u_%u_H\n\n", K, N, K, N);
+  fprintf(out, "#include \"ldpc_xor_kernel.h\"\n\n");
+  fprintf(out, "template <>\nstruct LdpcXorKernel<%u, %u>\n{\n", K, N);
+  fprintf(out, "  static const bool available = true;\n\n");
+
+  // Encoder: particular solution with the symbolic bits at zero, residuals of
+  // the unused checks, symbolic bits from the inverse, then corrections
+  fprintf(out, "  template <typename W>\n  static void encode(const W *u, W *p)\n  {\n");
+  for (const EncodingSchedule::Step &step : schedule.steps)
+  {
+    fprintf(out, "    p[%u] = ", step.parity);
+    writeCheckTerms(out, H, schedule, step.row, (int64_t)K + step.parity);
+    fprintf(out, ";\n");
+  }
+  for (uint32_t i = 0; i < g; i++)
+  {
+    fprintf(out, "    const W r%u = ", i);
+    writeCheckTerms(out, H, schedule, schedule.leftoverRows[i], -1);
+    fprintf(out, ";\n");
+  }
+  for (uint32_t i = 0; i < g; i++)
+  {
+    fprintf(out, "    const W g%u = ", i);
+    for (size_t j = 0; j < schedule.inverse[i].size(); j++)
+      fprintf(out, "%sr%u", j ? " ^ " : "", schedule.inverse[i][j]);
+    if (schedule.inverse[i].empty())
+      fprintf(out, "0");
+    fprintf(out, ";\n");
+  }
+  for (uint32_t p = 0; p < schedule.M; p++)
+  {
+    if (schedule.symbolic[p] >= 0)
+    {
+      fprintf(out, "    p[%u] = g%d;\n", p, schedule.symbolic[p]);
+    }
+    else if (!schedule.corrections[p].empty())
+    {
+      fprintf(out, "    p[%u] ^= ", p);
+      for (size_t j = 0; j < schedule.corrections[p].size(); j++)
+        fprintf(out, "%sg%u", j ? " ^ " : "", schedule.corrections[p][j]);
+      fprintf(out, ";\n");
+    }
+  }
+  fprintf(out, "  }\n\n");
+
+  // Syndrome: OR of every check, so each set lane marks a failed block
+  fprintf(out, "  template <typename W>\n  static W syndrome(const W *c)\n  {\n    W s = 0;\n");
+  for (uint32_t r = 0; r < H.rows; r++)
+  {
+    fprintf(out, "    s |= ");
+    for (size_t j = 0; j < H.rowCols[r].size(); j++)
+      fprintf(out, "%sc[%u]", j ? " ^ " : "", H.rowCols[r][j]);
+    fprintf(out, ";\n");
+  }
+  fprintf(out, "    return s;\n  }\n};\n\n#endif\n");
+
+  fclose(out);
+  fprintf(stderr, "%s: K=%u N=%u, %u encode XORs, %u syndrome XORs\n", path, K, N, encodeXors, syndromeXors);
+  return true;
+}
@@ -0,0 +1,38 @@
+#ifndef KERNEL_GEN_H
+#define KERNEL_GEN_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "parity_matrix.h"
+
+// Encoding schedule derived from H = [A | B] (B = last M columns):
+// Richardson-Urbanke style peeling resolves one parity bit per check, treating
+// a few parity bits as symbolic unknowns whenever peeling stalls. Those are
+// solved afterwards from the unused checks with a small dense inverse.
+struct EncodingSchedule
+{
+  struct Step
+  {
+    uint32_t parity; // Parity bit resolved (0..M-1)
+    uint32_t row;    // Check it is resolved from
+  };
+
+  uint32_t K = 0;
+  uint32_t M = 0;
+  std::vector<Step> steps;                         // In resolution order
+  std::vector<int32_t> symbolic;                   // Symbolic index per parity bit, -1 if resolved by a step
+  std::vector<uint32_t> leftoverRows;              // Checks not used by a step, one per symbolic bit
+  std::vector<std::vector<uint32_t>> inverse;      // g = inverse * residual, as index lists
+  std::vector<std::vector<uint32_t>> corrections;  // Symbolic bits each parity bit depends on
+};
+
+bool buildSchedule(const ParityMatrix &H, EncodingSchedule &schedule, std::string &error);
+
+// Emits a header specialising LdpcXorKernel<K, N> with straight-line XORs for
+// encoding and the syndrome check
+bool writeKernelHeader(const char *path, const char *source, const ParityMatrix &H,
+                       const EncodingSchedule &schedule, std::string &error);
+
+#endif
@@ -0,0 +1,479 @@
+// Host-side companion tool, built by the `native` PlatformIO environment:
+//
+//   ldpc_host gen-kernel <H.alist | H.qc> <out.h>   compile H into an XOR kernel header
+//   ldpc_host gen-matrix <H.alist | H.qc> <out.bin> [table=4|8] [threads=N]
+//                                                   systematic generator blob (see gf2.h)
+//   ldpc_host pack-store <out.bin> <item> ...       code table store image for the ldpc_codes partition
+//                                                   items: bg1:<iLS>=<graph.qc> bg2:<iLS>=<graph.qc> gen=<G.bin>
+//   ldpc_host list-store <image.bin>                show the index of a store image
+//   ldpc_host export-qc <K> <N> <out.qc>            write a built-in code in QC text form
+//   ldpc_host list-codes                            list the built-in codes
+//   ldpc_host encode <K> <N> <message> <out>        encode a file with the device layout
+//   ldpc_host verify <K> <N> <message> <encoded>    check captured encoded_buffer output
+//   ldpc_host bench <K> <N>                         host encoder throughput per instruction set
+//   ldpc_host simulate <K> <N> <awgn | bsc> <from> <to> <step> [key=value ...]
+//                                                   BER/FER of the decoder vs Eb/N0 (dB)
+//
+// Left out of `pio test -e native` builds, which bring their own main().
+#ifndef PIO_UNIT_TESTING
+
+#include <chrono>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <vector>
+
+#include "gf2.h"
+#include "host_decoder.h"
+#include "host_encoder.h"
+#include "kernel_gen.h"
+#include "ldpc_code_store.h"
+#include "ldpc_qc_codes.h"
+#include "parity_matrix.h"
+#include "simulation.h"
+#include "store_image.h"
+
+static int usage()
+{
+  fprintf(stderr, "usage:\n"
+                  "  ldpc_host gen-kernel <H.alist | H.qc> <out.h>\n"
+                  "  ldpc_host gen-matrix <H.alist | H.qc> <out.bin> [table=4|8] [threads=N]\n"
+                  "  ldpc_host pack-store <out.bin> <bg1:<iLS>=<graph.qc> | bg2:<iLS>=<graph.qc> | gen=<G.bin>> ...\n"
+                  "  ldpc_host list-store <image.bin>\n"
+                  "  ldpc_host export-qc <K> <N> <out.qc>\n"
+                  "  ldpc_host list-codes\n"
+                  "  ldpc_host encode <K> <N> <message> <out>\n"
+                  "  ldpc_host verify <K> <N> <message> <encoded>\n"
+                  "  ldpc_host bench <K> <N>\n"
+                  "  ldpc_host simulate <K> <N> <awgn | bsc> <from> <to> <step> [key=value ...]\n"
+                  "    keys: frames errors threads iterations normalized offset scale seed isa=scalar|avx2\n");
+  return 2;
+}
+
+static int genKernel(const char *input, const char *output)
+{
+  ParityMatrix H;
+  EncodingSchedule schedule;
+  std::string error;
+
+  if (!loadParityMatrix(input, H, error) || !buildSchedule(H, schedule, error) ||
+      !writeKernelHeader(output, input, H, schedule, error))
+  {
+    fprintf(stderr, "%s: %s\n", input, error.c_str());
+    return 1;
+  }
+  return 0;
+}
+
+static int genMatrix(int argc, char **argv)
+{
+  const char *input = argv[2];
+  const char *output = argv[3];
+  uint8_t chunkBits = 0;
+  unsigned threads = 0;
+  for (int i = 4; i < argc; i++)
+  {
+    if (strncmp(argv[i], "table=", 6) == 0 && (atoi(argv[i] + 6) == 4 || atoi(argv[i] + 6) == 8))
+      chunkBits = (uint8_t)atoi(argv[i] + 6);
+    else if (strncmp(argv[i], "threads=", 8) == 0)
+      threads = (unsigned)atoi(argv[i] + 8);
+    else
+      return usage();
+  }
+
+  ParityMatrix H;
+  Gf2Generator G;
+  std::string error;
+  auto start = std::chrono::steady_clock::now();
+  if (!loadParityMatrix(input, H, error) || !gf2BuildGenerator(H, G, error, threads))
+  {
+    fprintf(stderr, "%s: %s\n", input, error.c_str());
+    return 1;
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  int64_t bad = gf2VerifyGenerator(H, G);
+  if (bad >= 0)
+  {
+    fprintf(stderr, "%s: generator row %lld violates H\n", input, (long long)bad);
+    return 1;
+  }
+  if (!gf2WriteBlob(output, G, chunkBits, error))
+  {
+    fprintf(stderr, "%s\n", error.c_str());
+    return 1;
+  }
+
+  printf("K=%u N=%u rank=%u (%u redundant checks), %s column order, %.2f s\n", G.K, G.N, G.rank, H.rows - G.rank,
+         G.identityOrder() ? "identity" : "permuted", seconds);
+  return 0;
+}
+
+static int packStore(int argc, char **argv)
+{
+  StoreImage image;
+  std::string error;
+
+  for (int i = 3; i < argc; i++)
+  {
+    const char *item = argv[i];
+    unsigned graph, liftingSet;
+    int consumed = 0;
+    bool ok;
+    if (sscanf(item, "bg%u:%u=%n", &graph, &liftingSet, &consumed) == 2 && consumed > 0 && (graph == 1 || graph == 2))
+      ok = image.addNrGraph(graph == 1 ? QC_FAMILY_NR_BG1 : QC_FAMILY_NR_BG2, (uint8_t)liftingSet, item + consumed,
+                            error);
+    else if (strncmp(item, "gen=", 4) == 0)
+      ok = image.addGenerator(item + 4, error);
+    else
+      return usage();
+
+    if (!ok)
+    {
+      fprintf(stderr, "%s\n", error.c_str());
+      return 1;
+    }
+  }
+
+  if (!image.write(argv[2], error))
+  {
+    fprintf(stderr, "%s\n", error.c_str());
+    return 1;
+  }
+  return 0;
+}
+
+// Maps an image the way the device does and prints its index
+static int listStore(const char *path)
+{
+  LdpcCodeStore store;
+  if (!store.map(path))
+  {
+    fprintf(stderr, "%s: not a valid code table store image\n", path);
+    return 1;
+  }
+
+  printf("%s: %u entries, %zu bytes\n", path, store.entryCount(), store.imageBytes());
+  for (uint16_t i = 0; i < store.entryCount(); i++)
+  {
+    const LdpcStoreEntry &e = *store.entry(i);
+    printf("%3u  %-8.8s  ", i, e.name);
+    if (e.kind == LDPC_STORE_QC_GRAPH)
+      printf("QC graph %ux%u, family %u, lifting set %u", e.rows, e.cols, e.family, e.liftingSet);
+    else if (e.kind == LDPC_STORE_GENERATOR_TABLE)
+      printf("generator table K=%u N=%u, %u-bit chunks", e.K, e.N, e.chunkBits);
+    else if (e.kind == LDPC_STORE_GENERATOR_ROWS)
+      printf("generator rows K=%u N=%u", e.K, e.N);
+    else
+      printf("unknown kind %u", e.kind);
+    printf(", %u bytes at 0x%x\n", e.bytes, e.offset);
+  }
+  printf("%u 5G NR graphs registered\n", store.registerNrGraphs());
+  return 0;
+}
+
+static int exportQc(uint16_t K, uint16_t N, const char *output)
+{
+  QcCodeMatch match;
+  std::string error;
+
+  if (!qcFindCode(K, N, match))
+  {
+    fprintf(stderr, "no built-in code with K=%u N=%u\n", K, N);
+    return 1;
+  }
+  if (match.punctured || match.graph->cols * match.Z - match.graph->rows * match.Z != K)
+  {
+    // The kernel generator works on the mother code only
+    fprintf(stderr, "K=%u N=%u is punctured or shortened; only mother codes can be exported\n", K, N);
+    return 1;
+  }
+  if (!saveQcText(output, *match.graph, match.Z, error))
+  {
+    fprintf(stderr, "%s\n", error.c_str());
+    return 1;
+  }
+  return 0;
+}
+
+static int listCodes()
+{
+  QcCodeMatch match;
+  uint16_t K, N;
+
+  for (size_t i = 0; i < qcBuiltinCount(); i++)
+  {
+    if (qcBuiltinCode(i, match, K, N))
+      printf("%-20s K=%-5u N=%-5u Z=%u\n", match.graph->name, K, N, match.Z);
+  }
+  return 0;
+}
+
+static bool readFile(const char *path, std::vector<uint8_t> &data)
+{
+  FILE *file = fopen(path, "rb");
+  if (file == NULL)
+  {
+    fprintf(stderr, "cannot open %s\n", path);
+    return false;
+  }
+
+  uint8_t chunk[65536];
+  size_t n;
+  data.clear();
+  while ((n = fread(chunk, 1, sizeof(chunk), file)) > 0)
+    data.insert(data.end(), chunk, chunk + n);
+  fclose(file);
+  return true;
+}
+
+static bool configureEncoder(HostEncoder &encoder, uint16_t K, uint16_t N)
+{
+  if (!encoder.configure(K, N))
+  {
+    fprintf(stderr, "no kernel or built-in code with K=%u N=%u\n", K, N);
+    return false;
+  }
+  return true;
+}
+
+static uint32_t blocksFor(const HostEncoder &encoder, uint32_t messageBits)
+{
+  return (messageBits + encoder.K - 1) / encoder.K;
+}
+
+static int encodeFile(uint16_t K, uint16_t N, const char *input, const char *output)
+{
+  HostEncoder encoder;
+  std::vector<uint8_t> message;
+  if (!configureEncoder(encoder, K, N) || !readFile(input, message))
+    return 1;
+
+  uint32_t messageBits = message.size() * 8;
+  uint32_t blocks = blocksFor(encoder, messageBits);
+  std::vector<uint8_t> encoded((size_t)blocks * LDPC_BYTES(N));
+  if (!encoder.encode(message.data(), messageBits, blocks, encoded.data()))
+  {
+    fprintf(stderr, "out of memory encoding %s\n", input);
+    return 1;
+  }
+
+  FILE *file = fopen(output, "wb");
+  if (file == NULL || fwrite(encoded.data(), 1, encoded.size(), file) != encoded.size())
+  {
+    fprintf(stderr, "cannot write %s\n", output);
+    return 1;
+  }
+  fclose(file);
+  return 0;
+}
+
+// Compares a captured encoded_buffer stream block by block with the reference
+static int verifyFile(uint16_t K, uint16_t N, const char *messagePath, const char *encodedPath)
+{
+  HostEncoder encoder;
+  std::vector<uint8_t> message;
+  std::vector<uint8_t> captured;
+  if (!configureEncoder(encoder, K, N) || !readFile(messagePath, message) || !readFile(encodedPath, captured))
+    return 1;
+
+  uint32_t nBytes = LDPC_BYTES(N);
+  uint32_t messageBits = message.size() * 8;
+  uint32_t blocks = blocksFor(encoder, messageBits);
+  std::vector<uint8_t> expected((size_t)blocks * nBytes);
+
+  auto start = std::chrono::steady_clock::now();
+  if (!encoder.encode(message.data(), messageBits, blocks, expected.data()))
+  {
+    fprintf(stderr, "out of memory encoding %s\n", messagePath);
+    return 1;
+  }
+  double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+  uint32_t bad = 0;
+  for (uint32_t b = 0; b < blocks; b++)
+  {
+    size_t offset = (size_t)b * nBytes;
+    if (offset + nBytes > captured.size() || memcmp(&expected[offset], &captured[offset], nBytes) != 0)
+    {
+      if (bad < 10)
+        printf("block %u differs\n", b);
+      bad++;
+    }
+  }
+  if (captured.size() != expected.size())
+    printf("captured %zu bytes, expected %zu\n", captured.size(), expected.size());
+
+  printf("%u / %u blocks match (%s, %.2f Gbit/s)\n", blocks - bad, blocks,
+         encoder.bitSliced() ? hostIsaName(encoder.activeIsa()) : "QC encoder",
+         seconds > 0 ? messageBits / seconds / 1e9 : 0.0);
+  return bad == 0 && captured.size() == expected.size() ? 0 : 1;
+}
+
+static int benchEncoder(uint16_t K, uint16_t N)
+{
+  const uint32_t blocks = 32768;
+  HostEncoder encoder;
+  if (!configureEncoder(encoder, K, N))
+    return 1;
+
+  uint32_t messageBits = blocks * K;
+  std::vector<uint8_t> message(LDPC_BYTES(messageBits));
+  std::vector<uint8_t> encoded((size_t)blocks * LDPC_BYTES(N));
+  for (size_t i = 0; i < message.size(); i++)
+    message[i] = (uint8_t)(i * 37 + 11);
+
+  HostIsa best = hostDetectIsa();
+  for (int isa = HOST_ISA_SCALAR; isa <= best; isa++)
+  {
+    encoder.configure(K, N, (HostIsa)isa);
+    uint32_t rounds = 0;
+    double seconds;
+    auto start = std::chrono::steady_clock::now();
+    do
+    {
+      if (!encoder.encode(message.data(), messageBits, blocks, encoded.data()))
+      {
+        fprintf(stderr, "out of memory\n");
+        return 1;
+      }
+      rounds++;
+      seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    } while (seconds < 1.0);
+
+    printf("%-10s %8.2f Gbit/s\n", encoder.bitSliced() ? hostIsaName((HostIsa)isa) : "QC encoder",
+           (double)rounds * messageBits / seconds / 1e9);
+    if (!encoder.bitSliced())
+      break;
+  }
+  return 0;
+}
+
+// Applies one key=value option of the simulate command
+static bool parseSimOption(const char *option, SimConfig &config)
+{
+  const char *value = strchr(option, '=');
+  if (value == NULL)
+    return false;
+  std::string key(option, value - option);
+  value++;
+
+  if (key == "frames")
+    config.maxFrames = strtoull(value, NULL, 10);
+  else if (key == "errors")
+    config.targetErrors = (uint32_t)strtoul(value, NULL, 10);
+  else if (key == "threads")
+    config.threads = (unsigned)atoi(value);
+  else if (key == "iterations")
+    config.iterations = (uint8_t)atoi(value);
+  else if (key == "normalized")
+  {
+    config.minSum = LDPC_MINSUM_NORMALIZED;
+    config.minSumParameter = (uint8_t)atoi(value);
+  }
+  else if (key == "offset")
+  {
+    config.minSum = LDPC_MINSUM_OFFSET;
+    config.minSumParameter = (uint8_t)atoi(value);
+  }
+  else if (key == "scale")
+    config.llrScale = atof(value);
+  else if (key == "seed")
+    config.seed = strtoull(value, NULL, 10);
+  else if (key == "isa" && strcmp(value, "scalar") == 0)
+    config.isa = HOST_ISA_SCALAR;
+  else if (key == "isa" && strcmp(value, "avx2") == 0)
+    config.isa = HOST_ISA_AVX2;
+  else
+    return false;
+  return true;
+}
+
+// Prints a BER/FER table for Eb/N0 = from, from + step, ... to
+static int simulate(int argc, char **argv)
+{
+  SimConfig config;
+  simDefaults(config);
+  config.K = (uint16_t)atoi(argv[2]);
+  config.N = (uint16_t)atoi(argv[3]);
+  if (strcmp(argv[4], "awgn") == 0)
+    config.channel = SIM_CHANNEL_AWGN;
+  else if (strcmp(argv[4], "bsc") == 0)
+    config.channel = SIM_CHANNEL_BSC;
+  else
+    return usage();
+
+  double from = atof(argv[5]);
+  double to = atof(argv[6]);
+  double step = atof(argv[7]);
+  if (step <= 0)
+    return usage();
+  for (int i = 8; i < argc; i++)
+  {
+    if (!parseSimOption(argv[i], config))
+    {
+      fprintf(stderr, "unknown option %s\n", argv[i]);
+      return usage();
+    }
+  }
+
+  HostDecoder probe;
+  if (!probe.configure(config.K, config.N, config.isa))
+  {
+    fprintf(stderr, "no built-in code with K=%u N=%u\n", config.K, config.N);
+    return 1;
+  }
+  printf("# %s K=%u N=%u, %s, %s min-sum %u, %u iterations, LLR scale %.2f, %s\n", probe.codeName(), config.K,
+         config.N, config.channel == SIM_CHANNEL_BSC ? "BSC" : "AWGN",
+         config.minSum == LDPC_MINSUM_OFFSET ? "offset" : "normalized", config.minSumParameter, config.iterations,
+         config.llrScale, hostIsaName(probe.activeIsa()));
+  printf("# Eb/N0(dB)      frames  frame errs          BER          FER  undetected  avg iter  Mbit/s\n");
+
+  for (double ebn0 = from; ebn0 <= to + step / 2; ebn0 += step)
+  {
+    SimPoint point;
+    std::string error;
+    if (!simulatePoint(config, ebn0, point, error))
+    {
+      fprintf(stderr, "%s\n", error.c_str());
+      return 1;
+    }
+
+    double frames = point.frames ? (double)point.frames : 1.0;
+    printf("%10.2f %11llu %11llu %12.4e %12.4e %11llu %9.2f %7.1f\n", ebn0, (unsigned long long)point.frames,
+           (unsigned long long)point.frameErrors, point.bitErrors / (frames * config.K), point.frameErrors / frames,
+           (unsigned long long)point.undetected, point.iterations / frames,
+           point.seconds > 0 ? point.frames * config.K / point.seconds / 1e6 : 0.0);
+    fflush(stdout);
+    if (point.frameErrors == 0)
+      break; // Below the measurable floor for this frame budget
+  }
+  return 0;
+}
+
+int main(int argc, char **argv)
+{
+  if (argc == 4 && strcmp(argv[1], "gen-kernel") == 0)
+    return genKernel(argv[2], argv[3]);
+  if (argc >= 4 && strcmp(argv[1], "gen-matrix") == 0)
+    return genMatrix(argc, argv);
+  if (argc >= 4 && strcmp(argv[1], "pack-store") == 0)
+    return packStore(argc, argv);
+  if (argc == 3 && strcmp(argv[1], "list-store") == 0)
+    return listStore(argv[2]);
+  if (argc == 5 && strcmp(argv[1], "export-qc") == 0)
+    return exportQc((uint16_t)atoi(argv[2]), (uint16_t)atoi(argv[3]), argv[4]);
+  if (argc == 2 && strcmp(argv[1], "list-codes") == 0)
+    return listCodes();
+  if (argc == 6 && strcmp(argv[1], "encode") == 0)
+    return encodeFile((uint16_t)atoi(argv[2]), (uint16_t)atoi(argv[3]), argv[4], argv[5]);
+  if (argc == 6 && strcmp(argv[1], "verify") == 0)
+    return verifyFile((uint16_t)atoi(argv[2]), (uint16_t)atoi(argv[3]), argv[4], argv[5]);
+  if (argc == 4 && strcmp(argv[1], "bench") == 0)
+    return benchEncoder((uint16_t)atoi(argv[2]), (uint16_t)atoi(argv[3]));
+  if (argc >= 8 && strcmp(argv[1], "simulate") == 0)
+    return simulate(argc, argv);
+  return usage();
+}
+
+#endif
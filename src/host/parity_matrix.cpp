@@ -0,0 +1,173 @@
+#include "parity_matrix.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// Next non-zero (1-based) index
+static bool readIndex(FILE *file, unsigned &index)
+{
+  do
+  {
+    if (fscanf(file, "%u", &index) != 1)
+      return false;
+  } while (index == 0);
+  return true;
+}
+
+bool loadAlist(const char *path, ParityMatrix &H, std::string &error)
+{
+  FILE *file = fopen(path, "r");
+  if (file == NULL)
+  {
+    error = std::string("cannot open ") + path;
+    return false;
+  }
+
+  unsigned n = 0;
+  unsigned m = 0;
+  unsigned maxColWeight = 0;
+  unsigned maxRowWeight = 0;
+  bool ok = fscanf(file, "%u %u %u %u", &n, &m, &maxColWeight, &maxRowWeight) == 4 && n > m && m > 0;
+
+  std::vector<unsigned> colWeights(n);
+  std::vector<unsigned> rowWeights(m);
+  for (unsigned i = 0; ok && i < n; i++)
+    ok = fscanf(file, "%u", &colWeights[i]) == 1;
+  for (unsigned i = 0; ok && i < m; i++)
+    ok = fscanf(file, "%u", &rowWeights[i]) == 1;
+
+  // Lists hold exactly `weight` indices; some writers pad them to the maximum
+  // weight with zeros, which readIndex skips. Column lists are redundant with
+  // the row lists.
+  for (unsigned i = 0; ok && i < n; i++)
+  {
+    for (unsigned j = 0; ok && j < colWeights[i]; j++)
+    {
+      unsigned skipped;
+      ok = readIndex(file, skipped);
+    }
+  }
+
+  H.rows = m;
+  H.cols = n;
+  H.rowCols.assign(m, std::vector<uint32_t>());
+  for (unsigned r = 0; ok && r < m; r++)
+  {
+    for (unsigned j = 0; ok && j < rowWeights[r]; j++)
+    {
+      unsigned col;
+      ok = readIndex(file, col) && col <= n;
+      if (ok)
+        H.rowCols[r].push_back(col - 1);
+    }
+  }
+
+  fclose(file);
+  if (!ok)
+    error = std::string("malformed alist file ") + path;
+  return ok;
+}
+
+bool readQcText(const char *path, unsigned &rows, unsigned &cols, unsigned &Z, std::vector<int> &shifts,
+                std::string &error)
+{
+  FILE *file = fopen(path, "r");
+  if (file == NULL)
+  {
+    error = std::string("cannot open ") + path;
+    return false;
+  }
+
+  rows = 0;
+  cols = 0;
+  Z = 0;
+  bool ok = fscanf(file, "%u %u %u", &rows, &cols, &Z) == 3 && cols > rows && rows > 0 && Z > 0;
+
+  shifts.assign(ok ? rows * cols : 0, -1);
+  for (size_t i = 0; ok && i < shifts.size(); i++)
+    ok = fscanf(file, "%d", &shifts[i]) == 1;
+  fclose(file);
+
+  if (!ok)
+  {
+    error = std::string("malformed QC file ") + path;
+    return false;
+  }
+  return true;
+}
+
+bool loadQcText(const char *path, ParityMatrix &H, std::string &error)
+{
+  unsigned rows;
+  unsigned cols;
+  unsigned Z;
+  std::vector<int> shifts;
+  if (!readQcText(path, rows, cols, Z, shifts, error))
+    return false;
+
+  H.rows = rows * Z;
+  H.cols = cols * Z;
+  H.rowCols.assign(H.rows, std::vector<uint32_t>());
+  for (unsigned r = 0; r < rows; r++)
+  {
+    for (unsigned c = 0; c < cols; c++)
+    {
+      int s = shifts[r * cols + c];
+      if (s < 0)
+        continue;
+      for (unsigned i = 0; i < Z; i++)
+        H.rowCols[r * Z + i].push_back(c * Z + (i + s) % Z);
+    }
+  }
+  return true;
+}
+
+bool saveQcText(const char *path, const QcBaseGraph &graph, uint16_t Z, std::string &error)
+{
+  FILE *file = fopen(path, "w");
+  if (file == NULL)
+  {
+    error = std::string("cannot create ") + path;
+    return false;
+  }
+
+  fprintf(file, "%u %u %u\n", graph.rows, graph.cols, Z);
+  for (unsigned r = 0; r < graph.rows; r++)
+  {
+    for (unsigned c = 0; c < graph.cols; c++)
+    {
+      int16_t s = graph.shifts[r * graph.cols + c];
+      fprintf(file, "%s%d", c ? " " : "", s < 0 ? -1 : (int)qcLiftShift(graph, s, Z));
+    }
+    fprintf(file, "\n");
+  }
+  fclose(file);
+  return true;
+}
+
+void expandQc(const QcBaseGraph &graph, uint16_t Z, ParityMatrix &H)
+{
+  H.rows = (uint32_t)graph.rows * Z;
+  H.cols = (uint32_t)graph.cols * Z;
+  H.rowCols.assign(H.rows, std::vector<uint32_t>());
+  for (unsigned r = 0; r < graph.rows; r++)
+  {
+    for (unsigned c = 0; c < graph.cols; c++)
+    {
+      int16_t s = graph.shifts[r * graph.cols + c];
+      if (s < 0)
+        continue;
+      uint16_t shift = qcLiftShift(graph, s, Z);
+      for (unsigned i = 0; i < Z; i++)
+        H.rowCols[r * Z + i].push_back(c * Z + (i + shift) % Z);
+    }
+  }
+}
+
+bool loadParityMatrix(const char *path, ParityMatrix &H, std::string &error)
+{
+  size_t length = strlen(path);
+  if (length > 6 && strcmp(path + length - 6, ".alist") == 0)
+    return loadAlist(path, H, error);
+  return loadQcText(path, H, error);
+}
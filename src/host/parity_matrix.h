@@ -0,0 +1,38 @@
+#ifndef PARITY_MATRIX_H
+#define PARITY_MATRIX_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "ldpc_qc.h"
+
+// Sparse parity-check matrix: column indices of the ones in every row.
+// Information bits are assumed to be columns 0..K-1 and parity the last M.
+struct ParityMatrix
+{
+  uint32_t rows = 0;
+  uint32_t cols = 0;
+  std::vector<std::vector<uint32_t>> rowCols;
+};
+
+// MacKay alist format (1-based indices, zero padding allowed)
+bool loadAlist(const char *path, ParityMatrix &H, std::string &error);
+
+// QC text format: "rows cols Z" followed by rows * cols shifts, -1 for zero
+// blocks. Shifts are taken modulo Z.
+bool loadQcText(const char *path, ParityMatrix &H, std::string &error);
+
+// The base graph of a QC text file as written, without lifting it
+bool readQcText(const char *path, unsigned &rows, unsigned &cols, unsigned &Z, std::vector<int> &shifts,
+                std::string &error);
+
+// Writes a base graph lifted to Z in the QC text format
+bool saveQcText(const char *path, const QcBaseGraph &graph, uint16_t Z, std::string &error);
+
+void expandQc(const QcBaseGraph &graph, uint16_t Z, ParityMatrix &H);
+
+// Loads alist or QC text, chosen by the file extension (.alist / anything else)
+bool loadParityMatrix(const char *path, ParityMatrix &H, std::string &error);
+
+#endif
@@ -0,0 +1,199 @@
+#include "simulation.h"
+
+#include <atomic>
+#include <chrono>
+#include <math.h>
+#include <random>
+#include <string.h>
+#include <thread>
+#include <vector>
+
+#include "host_decoder.h"
+
+#define SIM_BATCH_FRAMES 64 // Frames encoded per HostEncoder call
+
+void simDefaults(SimConfig &config)
+{
+  config.K = 0;
+  config.N = 0;
+  config.channel = SIM_CHANNEL_AWGN;
+  config.llrScale = 8.0;
+  config.iterations = LDPC_DECODER_ITERATIONS;
+  config.minSum = LDPC_MINSUM_NORMALIZED;
+  config.minSumParameter = 12;
+  config.maxFrames = 1000000;
+  config.targetErrors = 100;
+  config.threads = 0;
+  config.seed = 1;
+  config.isa = HOST_ISA_COUNT;
+}
+
+namespace
+{
+
+// Counters shared by the workers of one point
+struct SimShared
+{
+  std::atomic<uint64_t> claimed;
+  std::atomic<uint64_t> frames;
+  std::atomic<uint64_t> frameErrors;
+  std::atomic<uint64_t> bitErrors;
+  std::atomic<uint64_t> undetected;
+  std::atomic<uint64_t> iterations;
+  std::atomic<bool> failed; // An encoder could not allocate its scratch
+};
+
+int8_t quantise(double llr, double scale)
+{
+  double value = llr * scale;
+  if (value > LDPC_LLR_MAX)
+    return LDPC_LLR_MAX;
+  if (value < -LDPC_LLR_MAX)
+    return -LDPC_LLR_MAX;
+  return (int8_t)lrint(value);
+}
+
+uint32_t countBitErrors(const uint8_t *sent, const uint8_t *decoded, uint16_t bits)
+{
+  uint32_t errors = 0;
+  for (uint16_t i = 0; i < bits / 8; i++)
+    errors += __builtin_popcount(sent[i] ^ decoded[i]);
+  if (bits % 8)
+    errors += __builtin_popcount((sent[bits / 8] ^ decoded[bits / 8]) & (0xFF00 >> (bits % 8)));
+  return errors;
+}
+
+void runWorker(const SimConfig &config, double ebn0, unsigned worker, SimShared &shared)
+{
+  HostEncoder encoder;
+  HostDecoder decoder;
+  encoder.configure(config.K, config.N, config.isa);
+  decoder.configure(config.K, config.N, config.isa);
+  decoder.setIterations(config.iterations);
+  decoder.setMinSum(config.minSum, config.minSumParameter);
+
+  const uint32_t kBytes = LDPC_BYTES(config.K);
+  const uint32_t nBytes = LDPC_BYTES(config.N);
+  std::vector<uint8_t> message(SIM_BATCH_FRAMES * kBytes);
+  std::vector<uint8_t> encoded(SIM_BATCH_FRAMES * nBytes);
+  std::vector<int8_t> llr(config.N);
+  std::vector<uint8_t> decoded(kBytes);
+
+  std::seed_seq seeds{(uint32_t)config.seed, (uint32_t)(config.seed >> 32), (uint32_t)worker,
+                      (uint32_t)lrint(ebn0 * 1000)};
+  std::mt19937_64 rng(seeds);
+  std::normal_distribution<double> noise(0.0, 1.0);
+  std::uniform_real_distribution<double> uniform(0.0, 1.0);
+
+  // Eb/N0 per information bit; the K information bits ride on N channel bits
+  double rate = (double)config.K / config.N;
+  double snr = rate * pow(10.0, ebn0 / 10.0); // Es/N0
+  double sigma = sqrt(1.0 / (2.0 * snr));
+  double crossover = 0.5 * erfc(sqrt(snr));
+  int8_t hardLlr = quantise(log((1.0 - crossover) / crossover), config.llrScale);
+  if (hardLlr == 0)
+    hardLlr = 1;
+
+  while (shared.frameErrors.load() < config.targetErrors && !shared.failed.load())
+  {
+    uint64_t first = shared.claimed.fetch_add(SIM_BATCH_FRAMES);
+    if (first >= config.maxFrames)
+      break;
+    uint32_t count = config.maxFrames - first < SIM_BATCH_FRAMES ? config.maxFrames - first : SIM_BATCH_FRAMES;
+
+    for (size_t i = 0; i < message.size(); i += 8)
+    {
+      uint64_t word = rng();
+      memcpy(&message[i], &word, message.size() - i < 8 ? message.size() - i : 8);
+    }
+    if (!encoder.encode(message.data(), (uint32_t)count * kBytes * 8, count, encoded.data()))
+    {
+      shared.failed = true;
+      break;
+    }
+
+    uint64_t frameErrors = 0, bitErrors = 0, undetected = 0, iterations = 0;
+    for (uint32_t f = 0; f < count; f++)
+    {
+      const uint8_t *codeword = &encoded[(size_t)f * nBytes];
+      for (uint16_t t = 0; t < config.N; t++)
+      {
+        bool one = (codeword[t >> 3] >> (7 - (t & 7))) & 1;
+        if (config.channel == SIM_CHANNEL_BSC)
+        {
+          bool flipped = uniform(rng) < crossover;
+          llr[t] = (one != flipped) ? -hardLlr : hardLlr;
+        }
+        else
+        {
+          double y = (one ? -1.0 : 1.0) + sigma * noise(rng);
+          llr[t] = quantise(2.0 * y / (sigma * sigma), config.llrScale);
+        }
+      }
+
+      uint8_t used;
+      bool valid = decoder.decode(llr.data(), decoded.data(), used);
+      uint32_t errors = countBitErrors(&message[(size_t)f * kBytes], decoded.data(), config.K);
+      iterations += used;
+      bitErrors += errors;
+      if (errors)
+      {
+        frameErrors++;
+        undetected += valid;
+      }
+    }
+
+    shared.frames += count;
+    shared.frameErrors += frameErrors;
+    shared.bitErrors += bitErrors;
+    shared.undetected += undetected;
+    shared.iterations += iterations;
+  }
+}
+
+} // namespace
+
+bool simulatePoint(const SimConfig &config, double ebn0, SimPoint &point, std::string &error)
+{
+  HostEncoder encoder;
+  HostDecoder decoder;
+  if (!encoder.configure(config.K, config.N) || !decoder.configure(config.K, config.N))
+  {
+    error = "no built-in code with K=" + std::to_string(config.K) + " N=" + std::to_string(config.N);
+    return false;
+  }
+
+  unsigned threads = config.threads ? config.threads : std::thread::hardware_concurrency();
+  if (threads == 0)
+    threads = 1;
+
+  SimShared shared;
+  shared.claimed = 0;
+  shared.frames = 0;
+  shared.frameErrors = 0;
+  shared.bitErrors = 0;
+  shared.undetected = 0;
+  shared.iterations = 0;
+  shared.failed = false;
+
+  auto start = std::chrono::steady_clock::now();
+  std::vector<std::thread> workers;
+  for (unsigned w = 0; w < threads; w++)
+    workers.emplace_back(runWorker, std::cref(config), ebn0, w, std::ref(shared));
+  for (std::thread &worker : workers)
+    worker.join();
+  if (shared.failed)
+  {
+    error = "out of memory for the encoder";
+    return false;
+  }
+
+  point.ebn0 = ebn0;
+  point.frames = shared.frames;
+  point.frameErrors = shared.frameErrors;
+  point.bitErrors = shared.bitErrors;
+  point.undetected = shared.undetected;
+  point.iterations = shared.iterations;
+  point.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+  return true;
+}
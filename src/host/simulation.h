@@ -0,0 +1,57 @@
+#ifndef SIMULATION_H
+#define SIMULATION_H
+
+#include <stdint.h>
+#include <string>
+
+#include "host_encoder.h"
+#include "ldpc_decoder.h"
+
+// Channels the Monte Carlo simulation can model. Both carry BPSK (bit 0 as
+// +1); the BSC is the hard-decision AWGN channel at the same Eb/N0.
+enum SimChannel
+{
+  SIM_CHANNEL_AWGN = 0,
+  SIM_CHANNEL_BSC = 1
+};
+
+struct SimConfig
+{
+  uint16_t K;
+  uint16_t N;
+  uint8_t channel;       // SimChannel
+  double llrScale;       // Decoder LLR units per natural-log LLR unit
+  uint8_t iterations;    // Decoder iteration cap
+  LdpcMinSum minSum;     // Check node update
+  uint8_t minSumParameter;
+  uint64_t maxFrames;    // Stop a point after this many frames...
+  uint32_t targetErrors; // ...or as soon as this many frame errors were seen
+  unsigned threads;      // 0: one per hardware thread
+  uint64_t seed;
+  HostIsa isa;
+};
+
+// Results of one Eb/N0 point
+struct SimPoint
+{
+  double ebn0;
+  uint64_t frames;
+  uint64_t frameErrors;
+  uint64_t bitErrors;   // Information bits
+  uint64_t undetected;  // Frame errors the decoder reported as valid codewords
+  uint64_t iterations;  // Sum over all frames
+  double seconds;
+};
+
+void simDefaults(SimConfig &config);
+
+// Runs one Eb/N0 point across config.threads worker threads. Every worker
+// owns its encoder, decoder and random stream (seeded from config.seed, the
+// worker index and the point); only the counters are shared. Frames are
+// encoded with random information bits through HostEncoder and decoded with
+// HostDecoder, i.e. the codes the device negotiates through
+// receiveParameters(). Returns false with a message if (K, N) is not a
+// built-in code.
+bool simulatePoint(const SimConfig &config, double ebn0, SimPoint &point, std::string &error);
+
+#endif
@@ -0,0 +1,133 @@
+#include "store_image.h"
+
+#include <stdio.h>
+#include <string.h>
+
+#include "gf2.h"
+#include "parity_matrix.h"
+
+void StoreImage::add(LdpcStoreEntry entry, const char *name, const void *data, size_t bytes)
+{
+  memset(entry.name, 0, sizeof(entry.name));
+  memcpy(entry.name, name, strnlen(name, sizeof(entry.name)));
+  entry.bytes = bytes;
+  index.push_back(entry);
+  payloads.emplace_back((const uint8_t *)data, (const uint8_t *)data + bytes);
+}
+
+bool StoreImage::addNrGraph(uint8_t family, uint8_t liftingSet, const char *qcPath, std::string &error)
+{
+  unsigned rows, cols, Z;
+  std::vector<int> shifts;
+  if (!readQcText(qcPath, rows, cols, Z, shifts, error))
+    return false;
+
+  std::vector<int16_t> packed(shifts.begin(), shifts.end());
+  char name[16];
+  snprintf(name, sizeof(name), "BG%u i%u", family == QC_FAMILY_NR_BG1 ? 1 : 2, liftingSet);
+
+  // Same checks the device applies when the graph is registered
+  QcBaseGraph graph = {name, (uint8_t)rows, (uint8_t)cols, packed.data(), QC_LIFT_MODULO, (uint16_t)Z};
+  bool fits = rows <= 255 && cols <= 255 && qcRegisterNrGraph(family, liftingSet, &graph);
+  qcRegisterNrGraph(family, liftingSet, NULL);
+  if (!fits)
+  {
+    error = std::string(qcPath) + ": not a 5G NR base graph of that family, or the lifting set is invalid";
+    return false;
+  }
+
+  LdpcStoreEntry entry;
+  memset(&entry, 0, sizeof(entry));
+  entry.kind = LDPC_STORE_QC_GRAPH;
+  entry.family = family;
+  entry.liftingSet = liftingSet;
+  entry.rows = rows;
+  entry.cols = cols;
+  entry.lifting = QC_LIFT_MODULO;
+  entry.baseZ = Z;
+  add(entry, name, packed.data(), packed.size() * sizeof(int16_t));
+  return true;
+}
+
+bool StoreImage::addGenerator(const char *blobPath, std::string &error)
+{
+  FILE *file = fopen(blobPath, "rb");
+  if (file == NULL)
+  {
+    error = std::string("cannot open ") + blobPath;
+    return false;
+  }
+
+  Gf2BlobHeader header;
+  std::vector<uint8_t> payload;
+  bool ok = fread(&header, sizeof(header), 1, file) == 1 && header.magic == GF2_BLOB_MAGIC &&
+            header.version == GF2_BLOB_VERSION;
+  if (ok)
+  {
+    payload.resize(header.payloadBytes);
+    ok = fseek(file, header.payloadOffset, SEEK_SET) == 0 &&
+         fread(payload.data(), 1, payload.size(), file) == payload.size();
+  }
+  fclose(file);
+
+  if (!ok)
+  {
+    error = std::string("malformed generator blob ") + blobPath;
+    return false;
+  }
+  if (!(header.flags & GF2_BLOB_IDENTITY_ORDER) || header.N > LDPC_MAX_N || header.K > LDPC_MAX_K)
+  {
+    // The device layout has no column permutation
+    error = std::string(blobPath) + ": permuted column order or too large for the device";
+    return false;
+  }
+
+  LdpcStoreEntry entry;
+  memset(&entry, 0, sizeof(entry));
+  entry.kind = header.chunkBits ? LDPC_STORE_GENERATOR_TABLE : LDPC_STORE_GENERATOR_ROWS;
+  entry.chunkBits = header.chunkBits;
+  entry.K = header.K;
+  entry.N = header.N;
+
+  char name[16];
+  snprintf(name, sizeof(name), "G%u", header.N);
+  add(entry, name, payload.data(), payload.size());
+  return true;
+}
+
+bool StoreImage::write(const char *path, std::string &error) const
+{
+  LdpcStoreHeader header;
+  memset(&header, 0, sizeof(header));
+  header.magic = LDPC_STORE_MAGIC;
+  header.version = LDPC_STORE_VERSION;
+  header.entryCount = index.size();
+
+  std::vector<LdpcStoreEntry> placed = index;
+  size_t offset = sizeof(header) + placed.size() * sizeof(LdpcStoreEntry);
+  for (LdpcStoreEntry &entry : placed)
+  {
+    offset = (offset + LDPC_STORE_ALIGN - 1) / LDPC_STORE_ALIGN * LDPC_STORE_ALIGN;
+    entry.offset = offset;
+    offset += entry.bytes;
+  }
+  header.totalBytes = offset;
+
+  std::vector<uint8_t> image(offset, 0);
+  memcpy(image.data(), &header, sizeof(header));
+  if (!placed.empty())
+    memcpy(image.data() + sizeof(header), placed.data(), placed.size() * sizeof(LdpcStoreEntry));
+  for (size_t i = 0; i < placed.size(); i++)
+    memcpy(image.data() + placed[i].offset, payloads[i].data(), payloads[i].size());
+
+  FILE *out = fopen(path, "wb");
+  bool ok = out != NULL && fwrite(image.data(), 1, image.size(), out) == image.size();
+  if (out != NULL && fclose(out) != 0)
+    ok = false;
+  if (!ok)
+  {
+    error = std::string("cannot write ") + path;
+    return false;
+  }
+  return true;
+}
@@ -0,0 +1,31 @@
+#ifndef STORE_IMAGE_H
+#define STORE_IMAGE_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+#include "ldpc_code_store.h"
+
+// Builds a code table store image (ldpc_code_store.h) for flashing into the
+// ldpc_codes partition or mapping from a file on the native build
+class StoreImage
+{
+public:
+  // 5G NR base graph for one lifting set, as written in a QC text file
+  bool addNrGraph(uint8_t family, uint8_t liftingSet, const char *qcPath, std::string &error);
+
+  // Generator blob written by `ldpc_host gen-matrix` (identity column order only)
+  bool addGenerator(const char *blobPath, std::string &error);
+
+  bool write(const char *path, std::string &error) const;
+  size_t entries() const { return index.size(); }
+
+private:
+  void add(LdpcStoreEntry entry, const char *name, const void *data, size_t bytes);
+
+  std::vector<LdpcStoreEntry> index;
+  std::vector<std::vector<uint8_t>> payloads;
+};
+
+#endif
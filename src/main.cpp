@@ -1,10 +1,35 @@
 #include <Arduino.h>
+#include "bench.h"
+#include "block_verifier.h"
+#include "ldpc_bitflip.h"
+#include "ldpc_bitslice.h"
+#include "ldpc_code_store.h"
+#include "ldpc_decoder.h"
+#include "codec.h"
+#include "frame.h"
+#include "ldpc_kernel_324_648.h"
+#include "ldpc_qc_codes.h"
+#include "ldpc_syndrome.h"
+#include "ldpc_table_encoder.h"
+#include "parallel_encode.h"
+#include "phase_timing.h"
+#include "result_history.h"
 
 // UART Configuration
 #define SERIAL_BAUD 115200 // USB Serial baud rate (for user interface)
+#define SERIAL_RX_BUFFER 4096 // Room for pipelined command frames while a job runs
 #define UART2_BAUD 115200  // UART2 baud rate (matches microcontroller)
 #define UART2_RX_PIN 16    // GPIO16 for UART2 RX
 #define UART2_TX_PIN 17    // GPIO17 for UART2 TX
+#define USE_UART1_LINK      // Comment this line if no second microcontroller is attached
+#define UART1_BAUD 115200
+#define UART1_RX_PIN 26     // UART1's default pins are taken by the SPI flash
+#define UART1_TX_PIN 27
+#define LINK_QUEUE_DEPTH 1  // Blocks sent to an MCU ahead of the codeword being received
+#define LINK_BYTE_GAP_MS 10 // Pause between bytes sent to an MCU, so it is not overwhelmed
+#define LINK_TIMEOUT_MS 3000 // No traffic on a link while a codeword is due
+// #define USE_UART1_HOST   // Take command frames from a second host on UART1 (instead of USE_UART1_LINK)
+#define UART1_HOST_BAUD 115200
 
 // LDPC Protocol Constants
 #define USE_TAG // Comment this line to disable tag waiting
@@ -13,6 +38,12 @@
 #define LDPC_TAG_2 0xc0
 #define LDPC_TAG_3 0xde
 #define MAX_MESSAGE_LENGTH 1024
+#define MAX_ENCODED_LENGTH (MAX_MESSAGE_LENGTH * 2) // Codeword bytes of one job
+#define MAX_CALCULATION_BITS (MAX_MESSAGE_LENGTH * 8) // Longest announced length: fills MAX_ENCODED_LENGTH at rate 1/2
+#define PARAM_CACHE_SIZE 8 // Message lengths whose negotiated K/N are remembered for local encoding
+
+// Console input
+#define CONSOLE_LINE_LENGTH (MAX_MESSAGE_LENGTH * 3) // Room for "AB " per byte of hex input
 
 // System states
 enum SystemState
@@ -29,364 +60,2441 @@ enum InputMode
 {
   INPUT_TEXT = 1,
   INPUT_HEX = 2,
-  INPUT_HEX_MANUAL = 3
+  INPUT_HEX_MANUAL = 3,
+  INPUT_BASE64 = 4,
+  INPUT_BINARY = 5 // 2-byte big-endian byte count, then raw bytes
+};
+
+// Result output encodings
+enum OutputFormat
+{
+  OUTPUT_HEX = 1,    // Human-readable hex dump (ASCII for text input)
+  OUTPUT_BASE64 = 2, // Base64 lines of 76 characters
+  OUTPUT_BINARY = 3  // Raw frame: sync, type, length, payload, CRC-32
+};
+
+// Result frame types (frame layout in frame.h)
+#define RESULT_FRAME_MESSAGE 0x01
+#define RESULT_FRAME_ENCODED 0x02
+
+// Machine command protocol. A frame arriving on the console (FRAME_SYNC_0 as the
+// first byte) switches to command mode: no menu, no diagnostics, requests are
+// processed back-to-back. A host on UART1 (USE_UART1_HOST) speaks only the
+// command protocol, alongside the console. Every request payload starts with a
+// sequence byte that is echoed as the first byte of the response, followed by
+// a JobStatus byte; responses go back to the port the request came from.
+#define CMD_ENCODE 0x10       // seq, InputMode (| ENCODE_LATENCY), manual bits (uint16), message (raw bytes for INPUT_BINARY)
+#define CMD_STATUS 0x11       // seq
+#define CMD_LAST_RESULT 0x12  // seq
+#define CMD_RESET_TAG 0x13    // seq
+#define CMD_DECODE 0x14       // seq, K, N, N int8 LLRs (positive favours 0)
+#define CMD_GET_RESULT 0x15   // seq, job ID (uint16); any result still in the history
+#define CMD_TIMING 0x16       // seq, reset (optional, 1 clears the histograms after reporting)
+#define CMD_EXIT 0x1F         // seq; back to the interactive menu
+#define RESP_ENCODE 0x90      // seq, status, K, N, message bits, calculation bits, blocks, job ID, encoded data
+#define RESP_STATUS 0x91      // seq, status, state, K, N, message bits, tag received, output format,
+                              // decoded blocks/s, decoder iterations per block x 10
+#define RESP_ACK 0x92         // seq, status
+#define RESP_DECODE 0x93      // seq, status, iterations, K decoded information bits
+#define RESP_TIMING 0x94      // seq, status, phase count, per Phase: count, p50, p99, max (uint32, us)
+#define RESP_ERROR 0x9F       // seq (0 if unknown), status, request type
+#define ENCODE_LATENCY 0x80   // InputMode flag: latency-sensitive job, scheduled ahead of bulk ones
+#define CMD_MAX_PAYLOAD (CONSOLE_LINE_LENGTH + 4)
+#define RESP_ENCODE_HEADER 14
+
+// Outcome of an encoding job or command
+enum JobStatus
+{
+  JOB_OK = 0,
+  JOB_ERR_TAG = 1,
+  JOB_ERR_LENGTH = 2,
+  JOB_ERR_PARAMS = 3,
+  JOB_ERR_DATA = 4,
+  JOB_ERR_INPUT = 5,
+  JOB_ERR_FRAME = 6,
+  JOB_ERR_COMMAND = 7,
+  JOB_ERR_CHECK = 8,
+  JOB_ERR_DECODE = 9, // Decoder hit its iteration cap; best-effort bits are still returned
+  JOB_ERR_NO_RESULT = 10 // Job ID unknown or evicted from the result history
 };
 
 SystemState currentState = STATE_IDLE;
 InputMode inputMode = INPUT_TEXT;
+OutputFormat outputFormat = OUTPUT_HEX;
 
 // LDPC parameters
 uint16_t K = 0; // Information bits
 uint16_t N = 0; // Codeword bits
 uint16_t message_bits = 0;
 uint8_t message_buffer[MAX_MESSAGE_LENGTH];
-uint8_t encoded_buffer[MAX_MESSAGE_LENGTH * 2]; // Encoded data might be larger
-InputMode lastInputMode = INPUT_TEXT;           // Track the last input mode used
+uint8_t encoded_buffer[MAX_ENCODED_LENGTH]; // Encoded data might be larger
+// Finished results are kept in the result history (result_history.h)
+
+// Encoder MCU links. UART2 is the primary link and carries every job whose
+// code is not known yet. Once the K/N of a message length is known, the blocks
+// of a job are split across every link whose MCU has announced itself, and the
+// links run their exchanges side by side.
+struct EncoderLink
+{
+  const char *name;
+  HardwareSerial *port;
+  uint32_t baud;
+  int8_t rxPin;
+  int8_t txPin;
+  uint8_t queueDepth;
+
+  bool tagReceived; // Always set for enabled links when tags are disabled
+  uint8_t tagIndex; // Progress through the tag sequence
+  bool mismatched;  // Timed out on its share or answered another code; not striped until its tag is reset
+
+  // Share of the current job: blocks [firstBlock, firstBlock + blockCount)
+  uint16_t shareBits; // Length announced to this MCU
+  uint16_t K;
+  uint16_t N;
+  uint16_t firstBlock;
+  uint16_t blockCount;
+  uint16_t sentBlocks;
+  uint16_t sentBytes; // Of the block being sent
+  uint16_t receivedBlocks;
+  uint16_t receivedBytes; // Of the codeword being received
+  unsigned long nextByteAt;
+  unsigned long lastTraffic;
+
+  uint32_t blocks; // Statistics
+  uint32_t timeouts;
+#ifdef PHASE_TIMING
+  uint32_t blockStartedAt;         // First byte of the block being sent
+  uint32_t sentAt[LINK_QUEUE_DEPTH]; // Last byte of each block in flight, by block number
+#endif
+};
+
+#ifdef USE_UART1_LINK
+#define LINK_COUNT 2
+#else
+#define LINK_COUNT 1
+#endif
+
+EncoderLink links[LINK_COUNT]; // Set up by beginLink()
+
+EncoderLink *jobLinks[LINK_COUNT]; // Links taking part in the current job, in block order
+uint8_t jobLinkCount = 0;
+
+// Local encoding: K/N negotiated with the MCU per announced bit length, so later
+// jobs of the same length can be encoded on the ESP32 when a built-in code matches
+struct ParamCacheEntry
+{
+  uint16_t bits;
+  uint16_t K;
+  uint16_t N;
+};
+
+ParamCacheEntry paramCache[PARAM_CACHE_SIZE];
+uint8_t paramCacheNext = 0;
+bool localEncoding = false;
+QcEncoder qcEncoder;
+BitslicedEncoder<324, 648> kernel80211n648; // Generated kernel, 32 blocks per pass
+
+// Code tables read in place from the ldpc_codes flash partition
+LdpcCodeStore codeStore;
+TableEncoder flashTableEncoder;
+
+// Second instances for the worker core (see parallel_encode.h)
+QcEncoder workerQcEncoder;
+BitslicedEncoder<324, 648> workerKernel80211n648;
+
+// Parity check of every block returned by the MCU
+QcBitFlipDecoder syndromeChecker;
+uint32_t checkedBlocks = 0;
+uint32_t failedBlocks = 0;
+uint32_t flippedBlocks = 0;  // Failed blocks fixed by bit flipping
+uint32_t repairedBlocks = 0; // Failed blocks replaced by a local encoding
+uint32_t checkMicros = 0;    // Total time spent checking
+bool concurrentCheck = false; // Check on the other core while the links run
+BlockVerdict blockVerdicts[MAX_ENCODED_LENGTH]; // Per block of the current job (one byte codewords at most)
+
+// Receive side: layered min-sum decoder for built-in codes
+#define DECODER_MAX_ITERATIONS 20
+#define DECODER_HARD_LLR 32 // LLR magnitude given to hard-decision input bits
+QcLayeredDecoder ldpcDecoder;
+uint32_t decodedBlocks = 0;
+uint32_t decodeFailures = 0;    // Blocks still failing a check at the iteration cap
+uint32_t decodeIterations = 0;  // Total over decodedBlocks
+uint32_t decodeMicros = 0;
+
+// Diagnostic console output, silenced while the command protocol owns the console
+bool consoleVerbose = true;
+#define LOG_PRINTLN(msg) \
+  do                     \
+  {                      \
+    if (consoleVerbose)  \
+      Serial.println(msg); \
+  } while (0)
+#define LOG_PRINTF(...)  \
+  do                     \
+  {                      \
+    if (consoleVerbose)  \
+      Serial.printf(__VA_ARGS__); \
+  } while (0)
+
+// Encode requests of the command protocol are queued as they arrive (also
+// while a job runs) and scheduled by class: latency jobs first, then bulk ones,
+// oldest first within a class. A bulk job waiting JOB_AGING_MS counts as a
+// latency job, so bulk work is never starved.
+//
+// Jobs whose lengths map to the same cached K/N share one MCU transaction, each
+// starting on a block boundary, so the tag/length/parameter exchange is paid
+// once per batch. The MCU cannot stop a transaction part way, so while latency
+// jobs are coming in (one queued or finished in the last JOB_LATENCY_WINDOW_MS)
+// long bulk jobs run as transactions of JOB_SLICE_BLOCKS blocks, and those
+// slice boundaries are where a latency job preempts them. Otherwise bulk jobs
+// run whole, paying the exchange once.
+#define JOB_QUEUE_SIZE 16
+#define JOB_ARENA_BYTES (MAX_MESSAGE_LENGTH * 4) // Converted messages of queued jobs
+#define JOB_SLICE_BLOCKS (PARALLEL_MIN_BLOCKS * 2) // A slice still splits across both cores
+#define JOB_AGING_MS 5000
+#define JOB_LATENCY_WINDOW_MS 1000
+
+enum JobClass
+{
+  JOB_CLASS_BULK = 0,
+  JOB_CLASS_LATENCY = 1
+};
+#define JOB_CLASSES 2
+
+struct EncodeJob
+{
+  uint8_t seq;
+  InputMode mode;
+  JobClass jobClass;
+  uint16_t messageBits;
+  uint16_t calculationBits;
+  uint16_t offset;     // Message in jobArena
+  uint16_t firstBlock; // Within the batch transaction
+  uint16_t doneBlocks; // Sliced jobs: blocks already in sliceOutput
+  uint8_t producer;    // Gets the response
+  unsigned long queuedAt;
+  bool started;
+  bool done;
+};
+
+// Per-class scheduler metrics
+struct JobClassStats
+{
+  uint32_t jobs;
+  uint32_t totalWaitMs; // Queued until the first transaction started
+  uint32_t maxWaitMs;
+  uint8_t depth;        // Jobs of the class in the queue now
+  uint8_t maxDepth;
+};
+
+EncodeJob jobQueue[JOB_QUEUE_SIZE];
+uint8_t jobCount = 0;
+uint8_t jobArena[JOB_ARENA_BYTES];
+uint16_t jobArenaUsed = 0;
+uint8_t sliceOutput[MAX_ENCODED_LENGTH]; // Codewords of the sliced job in progress
+JobClassStats classStats[JOB_CLASSES];
+uint32_t jobBatches = 0;     // Transactions run for queued jobs
+uint32_t preemptions = 0;    // Sliced jobs set aside for a latency job
+bool batchRefused = false;   // The MCU answered a batch with another code; jobs run one by one
+bool sliceRefused = false;   // Same for a slice; long jobs run whole
+unsigned long lastLatencyAt = 0; // Last latency job queued or finished, 0 for none yet
+
+void ingestCommands();
+void pollCommands();
+
+// Ports that submit command frames. Each has its own receive ring (the serial
+// driver's buffer) and frame parser, so frames from several hosts are taken
+// in turn, a whole frame at a time, into the one job queue.
+#if defined(USE_UART1_HOST) && defined(USE_UART1_LINK)
+#error "UART1 is either an MCU link or a host port"
+#endif
+#ifdef USE_UART1_HOST
+#define PRODUCER_COUNT 2
+#else
+#define PRODUCER_COUNT 1
+#endif
+
+struct CommandProducer
+{
+  const char *name;
+  HardwareSerial *port;
+  FrameParser parser;
+  uint8_t payload[CMD_MAX_PAYLOAD];
+  bool pendingFrame; // Parsed frame that is not an encode request, not dispatched yet
+  uint32_t frames;
+  uint32_t badFrames;
+};
+
+CommandProducer producers[PRODUCER_COUNT]; // The console is producers[0]
+bool commandMode = false;                  // The console takes command frames instead of the menu
+uint8_t responseBuffer[RESP_ENCODE_HEADER + MAX_ENCODED_LENGTH];
+Print *responsePort = &Serial; // Where sendResponse() writes
+
+// Console line reader backed by a fixed buffer, so no heap allocation per job
+struct LineReader
+{
+  char *buffer;
+  size_t capacity; // Including room for the terminating NUL
+  size_t length;
+  bool overflow; // Characters were dropped because the line exceeded capacity
+  bool lastWasCR; // Swallow the '\n' of a "\r\n" pair
+};
+
+char consoleLine[CONSOLE_LINE_LENGTH + 1];
+LineReader consoleReader = {consoleLine, sizeof(consoleLine), 0, false, false};
+
+const char *outputFormatName(OutputFormat format)
+{
+  switch (format)
+  {
+  case OUTPUT_BASE64:
+    return "base64";
+  case OUTPUT_BINARY:
+    return "binary frame";
+  default:
+    return "hex";
+  }
+}
+
+void printMenu()
+{
+  Serial.println("LDPC Encoder Client Menu:");
+  Serial.println("1 - Encode text message");
+  Serial.println("2 - Encode hex message");
+  Serial.println("3 - Encode hex message with manual bit length");
+  Serial.println("4 - Check system status");
+  Serial.println("5 - Show encoding results (by job ID)");
+#ifdef USE_TAG
+  Serial.println("6 - Reset tag state (force tag wait on next encoding)");
+#endif
+  Serial.printf("7 - Select output format (current: %s)\n", outputFormatName(outputFormat));
+  Serial.println("8 - Encode base64 message");
+  Serial.println("9 - Encode raw binary message (length-prefixed)");
+  Serial.println("b - Run local encoder benchmark");
+  Serial.println("d - Decode last result (loopback check)");
+  Serial.printf("l - Toggle local encoding for matched codes (current: %s)\n", localEncoding ? "ON" : "OFF");
+  Serial.printf("v - Toggle concurrent block checking on the second core (current: %s)\n",
+                concurrentCheck ? "ON" : "OFF");
+  Serial.println("t - Reset phase timing histograms");
+#ifdef USE_TAG
+  Serial.println("Enter your choice (1-9, b, d, l, t, v): ");
+#else
+  Serial.println("Enter your choice (1-5, 7-9, b, d, l, t, v): ");
+#endif
+}
+
+// Dump layout: hex uses 16 bytes per line grouped in 4-byte words, base64 uses
+// 57 bytes (76 characters) per line, binary frames are written in 64-byte chunks
+#define HEX_DUMP_BYTES_PER_LINE 16
+#define BASE64_BYTES_PER_LINE 57
+#define BINARY_BYTES_PER_CHUNK 64
+#define DUMP_LINE_LENGTH (BASE64_ENCODED_LENGTH(BASE64_BYTES_PER_LINE) + 2)
+
+static const char hexDigits[] = "0123456789ABCDEF";
+
+enum DumpFormat
+{
+  DUMP_ASCII,
+  DUMP_HEX,
+  DUMP_BASE64,
+  DUMP_BINARY
+};
+
+enum DumpStage
+{
+  DUMP_STAGE_HEADER,
+  DUMP_STAGE_BODY,
+  DUMP_STAGE_TRAILER,
+  DUMP_STAGE_DONE
+};
+
+// Resumable dump state, so a large buffer can be drained a line at a time
+struct DumpWriter
+{
+  const uint8_t *data;
+  uint16_t length;
+  uint16_t offset;
+  DumpFormat format;
+  DumpStage stage;
+  uint8_t frameType; // Binary frames only
+  uint32_t crc;      // Running CRC of the binary frame
+};
+
+void beginDump(DumpWriter &writer, const uint8_t *data, uint16_t length, DumpFormat format, uint8_t frameType = 0)
+{
+  writer.data = data;
+  writer.length = length;
+  writer.offset = 0;
+  writer.format = format;
+  writer.stage = (format == DUMP_BINARY) ? DUMP_STAGE_HEADER : DUMP_STAGE_BODY;
+  writer.frameType = frameType;
+  writer.crc = 0;
+}
+
+size_t renderHexLine(DumpWriter &writer, char *line)
+{
+  size_t pos = 0;
+  uint16_t end = min((uint16_t)(writer.offset + HEX_DUMP_BYTES_PER_LINE), writer.length);
+
+  for (uint16_t i = writer.offset; i < end; i++)
+  {
+    line[pos++] = hexDigits[writer.data[i] >> 4];
+    line[pos++] = hexDigits[writer.data[i] & 0x0F];
+    if ((i + 1) % HEX_DUMP_BYTES_PER_LINE == 0)
+    {
+      line[pos++] = '\r';
+      line[pos++] = '\n';
+    }
+    else if ((i + 1) % 4 == 0)
+    {
+      line[pos++] = ' ';
+    }
+  }
+
+  writer.offset = end;
+  return pos;
+}
+
+size_t renderAsciiLine(DumpWriter &writer, char *line)
+{
+  size_t pos = 0;
+  uint16_t end = min((uint16_t)(writer.offset + HEX_DUMP_BYTES_PER_LINE), writer.length);
+
+  for (uint16_t i = writer.offset; i < end; i++)
+  {
+    line[pos++] = (writer.data[i] >= 32 && writer.data[i] <= 126) ? (char)writer.data[i] : '.';
+  }
+
+  writer.offset = end;
+  return pos;
+}
+
+size_t renderBase64Line(DumpWriter &writer, char *line)
+{
+  uint16_t count = min((uint16_t)BASE64_BYTES_PER_LINE, (uint16_t)(writer.length - writer.offset));
+  size_t pos = base64Encode(writer.data + writer.offset, count, line);
+  line[pos++] = '\r';
+  line[pos++] = '\n';
+
+  writer.offset += count;
+  return pos;
+}
+
+size_t renderBinaryChunk(DumpWriter &writer, char *line)
+{
+  uint16_t count = min((uint16_t)BINARY_BYTES_PER_CHUNK, (uint16_t)(writer.length - writer.offset));
+  memcpy(line, writer.data + writer.offset, count);
+  writer.crc = crc32Update(writer.crc, writer.data + writer.offset, count);
+
+  writer.offset += count;
+  return count;
+}
+
+// Renders the next piece of output into line and advances the writer.
+// Returns the number of bytes to emit (possibly zero).
+size_t renderDumpLine(DumpWriter &writer, char *line)
+{
+  size_t pos = 0;
+
+  switch (writer.stage)
+  {
+  case DUMP_STAGE_HEADER:
+    writer.crc = frameWriteHeader((uint8_t *)line, writer.frameType, writer.length);
+    pos = FRAME_HEADER_LENGTH;
+    writer.stage = DUMP_STAGE_BODY;
+    break;
+
+  case DUMP_STAGE_BODY:
+    if (writer.offset < writer.length)
+    {
+      switch (writer.format)
+      {
+      case DUMP_HEX:
+        pos = renderHexLine(writer, line);
+        break;
+      case DUMP_ASCII:
+        pos = renderAsciiLine(writer, line);
+        break;
+      case DUMP_BASE64:
+        pos = renderBase64Line(writer, line);
+        break;
+      case DUMP_BINARY:
+        pos = renderBinaryChunk(writer, line);
+        break;
+      }
+    }
+    if (writer.offset >= writer.length)
+      writer.stage = DUMP_STAGE_TRAILER;
+    break;
+
+  case DUMP_STAGE_TRAILER:
+    if (writer.format == DUMP_BINARY)
+    {
+      frameWriteCrc((uint8_t *)line, writer.crc);
+      pos = FRAME_CRC_LENGTH;
+    }
+    else if (writer.format == DUMP_ASCII || (writer.format == DUMP_HEX && writer.length % HEX_DUMP_BYTES_PER_LINE != 0))
+    {
+      line[pos++] = '\r';
+      line[pos++] = '\n';
+    }
+    writer.stage = DUMP_STAGE_DONE;
+    break;
+
+  case DUMP_STAGE_DONE:
+    break;
+  }
+
+  return pos;
+}
+
+// Emits as many whole lines as the output can take without blocking.
+// Returns true once the dump is complete.
+bool pumpDump(DumpWriter &writer, Print &out)
+{
+  char line[DUMP_LINE_LENGTH];
+
+  while (writer.stage != DUMP_STAGE_DONE)
+  {
+    if (out.availableForWrite() < DUMP_LINE_LENGTH)
+      return false;
+
+    size_t lineLength = renderDumpLine(writer, line);
+    if (lineLength > 0)
+      out.write((const uint8_t *)line, lineLength);
+  }
+  return true;
+}
+
+void drainDump(DumpWriter &writer)
+{
+  while (!pumpDump(writer, Serial))
+  {
+    yield();
+  }
+}
+
+void printBytes(const uint8_t *data, uint16_t length, bool asHex = true)
+{
+  PHASE_SCOPE(PHASE_PRINT);
+  DumpWriter writer;
+  beginDump(writer, data, length, asHex ? DUMP_HEX : DUMP_ASCII);
+  drainDump(writer);
+}
+
+// Prints a result buffer in the selected output format. In hex mode text input is
+// still shown as ASCII; the machine formats always carry the raw bytes.
+void printResult(const uint8_t *data, uint16_t length, uint8_t frameType, bool asText)
+{
+  PHASE_SCOPE(PHASE_PRINT);
+  DumpWriter writer;
+
+  switch (outputFormat)
+  {
+  case OUTPUT_BASE64:
+    beginDump(writer, data, length, DUMP_BASE64);
+    break;
+  case OUTPUT_BINARY:
+    beginDump(writer, data, length, DUMP_BINARY, frameType);
+    break;
+  default:
+    beginDump(writer, data, length, asText ? DUMP_ASCII : DUMP_HEX);
+    break;
+  }
+
+  drainDump(writer);
+}
+
+void resetLine(LineReader &reader)
+{
+  reader.length = 0;
+  reader.overflow = false;
+  reader.buffer[0] = '\0';
+}
+
+// Moves whatever is pending on the stream into the line buffer without blocking.
+// Returns true once a full line ('\n' or '\r' terminated) is available; the
+// terminator is not stored and the buffer is NUL-terminated.
+bool pollLine(LineReader &reader, Stream &stream)
+{
+  while (stream.available())
+  {
+    char c = (char)stream.read();
+
+    if (c == '\n' && reader.lastWasCR)
+    {
+      reader.lastWasCR = false;
+      continue;
+    }
+    reader.lastWasCR = (c == '\r');
+
+    if (c == '\n' || c == '\r')
+    {
+      reader.buffer[reader.length] = '\0';
+      return true;
+    }
+
+    if (reader.length + 1 < reader.capacity)
+      reader.buffer[reader.length++] = c;
+    else
+      reader.overflow = true;
+  }
+  return false;
+}
+
+// Blocks until a full line has been read from the console. Hosts on other
+// ports are served meanwhile.
+void readConsoleLine(LineReader &reader)
+{
+  resetLine(reader);
+  while (!pollLine(reader, Serial))
+  {
+    pollCommands();
+    delay(1);
+  }
+}
+
+// Strips leading and trailing whitespace from a (text, length) view in place
+void trimView(const char *&text, size_t &length)
+{
+  while (length > 0 && isspace((unsigned char)*text))
+  {
+    text++;
+    length--;
+  }
+  while (length > 0 && isspace((unsigned char)text[length - 1]))
+  {
+    length--;
+  }
+}
+
+void beginLink(EncoderLink &link, const char *name, HardwareSerial &port, uint32_t baud, int8_t rxPin, int8_t txPin)
+{
+  link.name = name;
+  link.port = &port;
+  link.baud = baud;
+  link.rxPin = rxPin;
+  link.txPin = txPin;
+  link.queueDepth = LINK_QUEUE_DEPTH;
+#ifndef USE_TAG
+  link.tagReceived = true;
+#endif
+  port.begin(baud, SERIAL_8N1, rxPin, txPin);
+}
+
+// Consumes whatever the link has received while looking for the tag sequence.
+// Returns true once the tag has been seen.
+bool pollTag(EncoderLink &link)
+{
+#ifdef USE_TAG
+  static const uint8_t tag[4] = {LDPC_TAG_0, LDPC_TAG_1, LDPC_TAG_2, LDPC_TAG_3};
+
+  while (!link.tagReceived && link.port->available())
+  {
+    uint8_t receivedByte = link.port->read();
+
+    if (receivedByte == tag[link.tagIndex])
+      link.tagIndex++;
+    else
+      link.tagIndex = (receivedByte == tag[0]) ? 1 : 0; // Reset if sequence breaks
+
+    if (link.tagIndex == sizeof(tag))
+    {
+      link.tagIndex = 0;
+      link.tagReceived = true;
+    }
+  }
+#endif
+  return link.tagReceived;
+}
+
+void resetLinkTags()
+{
+  for (uint8_t i = 0; i < LINK_COUNT; i++)
+  {
+#ifdef USE_TAG
+    links[i].tagReceived = false;
+#endif
+    links[i].tagIndex = 0;
+    links[i].mismatched = false;
+  }
+}
+
+bool waitForTag(EncoderLink &link)
+{
+  PHASE_SCOPE(PHASE_TAG_WAIT);
+
+#ifdef USE_TAG
+  if (link.tagReceived)
+  {
+    LOG_PRINTLN("Tag already received, skipping tag wait...");
+    return true;
+  }
+
+  LOG_PRINTLN("Waiting for microcontroller tag...");
+  unsigned long startTime = millis();
+
+  while (millis() - startTime < 5000) // 5 second timeout
+  {
+    if (pollTag(link))
+    {
+      LOG_PRINTLN("Tag received successfully!");
+      return true;
+    }
+    delay(1);
+  }
+
+  LOG_PRINTLN("Timeout waiting for tag!");
+  return false;
+#else
+  LOG_PRINTLN("Tag checking disabled, proceeding...");
+  return true;
+#endif
+}
+
+bool sendMessageLength(EncoderLink &link, uint16_t bits)
+{
+  PHASE_SCOPE(PHASE_SEND_LENGTH);
+  uint8_t len_hi = (uint8_t)(bits >> 8);
+  uint8_t len_lo = (uint8_t)(bits & 0xFF);
+
+  link.port->write(len_hi);
+  delay(10);
+  link.port->write(len_lo);
+  delay(10);
+
+  LOG_PRINTF("Sent message length: %d bits (%s)\n", bits, link.name);
+  return true;
+}
+
+bool receiveParameters(EncoderLink &link)
+{
+  PHASE_SCOPE(PHASE_RECEIVE_PARAMS);
+  LOG_PRINTLN("Waiting for K and N parameters...");
+  unsigned long startTime = millis();
+
+  while (millis() - startTime < 3000) // 3 second timeout
+  {
+    if (link.port->available() >= 4)
+    {
+      uint8_t k_hi = link.port->read();
+      uint8_t k_lo = link.port->read();
+      uint8_t n_hi = link.port->read();
+      uint8_t n_lo = link.port->read();
+
+      link.K = ((uint16_t)k_hi << 8) | (uint16_t)k_lo;
+      link.N = ((uint16_t)n_hi << 8) | (uint16_t)n_lo;
+
+      LOG_PRINTF("Received parameters: K=%d, N=%d (%s)\n", link.K, link.N, link.name);
+      return true;
+    }
+    delay(10);
+  }
+
+  LOG_PRINTF("Timeout waiting for parameters (%s)!\n", link.name);
+  return false;
+}
+
+const LdpcEncoder *selectLocalEncoder(uint16_t k, uint16_t n);
+
+// Configures the parity check for the current K/N; false if no known code matches
+bool prepareSyndromeCheck()
+{
+  if (syndromeChecker.ready() && syndromeChecker.K == K && syndromeChecker.N == N)
+    return true;
+
+  QcCodeMatch match;
+  if (qcFindCode(K, N, match) && syndromeChecker.configure(*match.graph, match.Z, K, N, match.punctured))
+    return true;
+
+  syndromeChecker.release();
+  return false;
+}
+
+// What a received block is checked against. With a parity check for the code a
+// failed block is first repaired in place by bit flipping (a few flipped bits
+// from UART noise), then replaced with a local encoding; without one, and only
+// with local encoding on, the block is compared with the local encoding. The
+// MCU protocol has no way to request a block again.
+struct BlockCheckJob
+{
+  const uint8_t *data;
+  uint16_t messageBits;
+  uint8_t *out;                // Codewords, block b at b * N bytes
+  bool syndrome;               // syndromeChecker is configured for K/N
+  const LdpcEncoder *fallback; // Local encoder for K/N, or NULL
+};
+
+// Information bytes of block `block`, as sendMessageData() sent them
+uint16_t blockInfoBits(const BlockCheckJob &job, uint16_t block, const uint8_t *&info)
+{
+  uint16_t offset = block * ((K + 7) / 8);
+  uint16_t messageBytes = (job.messageBits + 7) / 8;
+  info = job.data + offset;
+  return (offset < messageBytes) ? (messageBytes - offset) * 8 : 0;
+}
+
+// Checks one block without any output, so it can run on the verifier core.
+// flippedBits receives the repaired bit count for BLOCK_FLIPPED.
+BlockVerdict checkReceivedBlock(const BlockCheckJob &job, uint16_t block, uint16_t &flippedBits)
+{
+  static uint8_t expected[LDPC_BYTES(LDPC_MAX_N)]; // Used by one side at a time: inline or verifier core
+  uint16_t N_bytes = (N + 7) / 8;
+  uint8_t *codeword = job.out + block * N_bytes;
+  const uint8_t *info;
+  uint16_t infoBits = blockInfoBits(job, block, info);
+
+  unsigned long start = micros();
+  bool valid;
+  if (job.syndrome)
+  {
+    valid = syndromeChecker.check(codeword);
+  }
+  else
+  {
+    ldpcEncodeBlocks(*job.fallback, info, infoBits, 1, expected);
+    valid = memcmp(expected, codeword, N_bytes) == 0;
+  }
+  checkMicros += micros() - start;
+  checkedBlocks++;
+  if (valid)
+    return BLOCK_VALID;
+
+  failedBlocks++;
+  if (job.syndrome)
+  {
+    flippedBits = 0;
+    start = micros();
+    bool flipped = syndromeChecker.repair(codeword, flippedBits);
+    checkMicros += micros() - start;
+    if (flipped)
+    {
+      flippedBlocks++;
+      return BLOCK_FLIPPED;
+    }
+    if (job.fallback == NULL)
+      return BLOCK_CORRUPT;
+    ldpcEncodeBlocks(*job.fallback, info, infoBits, 1, codeword);
+  }
+  else
+  {
+    memcpy(codeword, expected, N_bytes);
+  }
+  repairedBlocks++;
+  return BLOCK_REENCODED;
+}
+
+void logBlockVerdict(uint16_t block, BlockVerdict verdict, uint16_t flippedBits)
+{
+  switch (verdict)
+  {
+  case BLOCK_FLIPPED:
+    if (flippedBits > 0)
+      LOG_PRINTF("Block %d failed the parity check, %d bits flipped\n", block + 1, flippedBits);
+    else
+      LOG_PRINTF("Block %d failed the parity check, repaired by bit flipping\n", block + 1);
+    break;
+  case BLOCK_REENCODED:
+    LOG_PRINTF("Block %d failed the check, re-encoded locally\n", block + 1);
+    break;
+  case BLOCK_CORRUPT:
+    LOG_PRINTF("Block %d failed the parity check\n", block + 1);
+    break;
+  default:
+    break;
+  }
+}
+
+// Checks a received block on this core. Returns false if the block is corrupt
+// and cannot be repaired.
+bool verifyReceivedBlock(const BlockCheckJob &job, uint16_t block)
+{
+  uint16_t flippedBits = 0;
+  BlockVerdict verdict = checkReceivedBlock(job, block, flippedBits);
+  logBlockVerdict(block, verdict, flippedBits);
+  return verdict != BLOCK_CORRUPT;
+}
+
+// Verifier core side of concurrent checking (block_verifier.h)
+BlockVerdict checkQueuedBlock(void *context, uint16_t block)
+{
+  uint16_t flippedBits;
+  return checkReceivedBlock(*(const BlockCheckJob *)context, block, flippedBits);
+}
+
+// Completes the rest of a share sendMessageData() gave up on: sends zero bytes
+// for whatever of the share is not sent yet and discards the codewords still
+// owed, so the MCU is ready for the next transaction. Returns false if the MCU
+// stops answering.
+bool finishShare(EncoderLink &link, uint16_t kBytes, uint16_t nBytes)
+{
+  LOG_PRINTF("Finishing %d blocks on %s\n", link.blockCount - link.receivedBlocks, link.name);
+  link.lastTraffic = millis();
+
+  while (link.receivedBlocks < link.blockCount)
+  {
+    unsigned long now = millis();
+    bool idle = true;
+
+    if (link.sentBlocks < link.blockCount && link.sentBlocks - link.receivedBlocks < link.queueDepth &&
+        (long)(now - link.nextByteAt) >= 0)
+    {
+      link.port->write((uint8_t)0);
+      link.nextByteAt = now + LINK_BYTE_GAP_MS;
+      link.lastTraffic = now;
+      if (++link.sentBytes == kBytes)
+      {
+        link.sentBytes = 0;
+        link.sentBlocks++;
+      }
+      idle = false;
+    }
+
+    while (link.receivedBlocks < link.sentBlocks && link.port->available())
+    {
+      link.port->read();
+      link.lastTraffic = now;
+      if (++link.receivedBytes == nBytes)
+      {
+        link.receivedBytes = 0;
+        link.receivedBlocks++;
+      }
+      idle = false;
+    }
+
+    if (link.receivedBlocks < link.sentBlocks && now - link.lastTraffic > LINK_TIMEOUT_MS)
+    {
+      link.timeouts++;
+      LOG_PRINTF("Timeout finishing %s\n", link.name);
+      return false;
+    }
+    if (idle)
+      delay(1);
+  }
+  return true;
+}
+
+// Moves the job's blocks over every link in jobLinks at once. Each link keeps
+// up to queueDepth blocks in flight, paced a byte every LINK_BYTE_GAP_MS, and
+// its codewords land at their block position in out, so the result is in
+// message order whichever link finishes first.
+JobStatus sendMessageData(const uint8_t *data, uint16_t messageBits, uint16_t calculationBits, uint8_t *out)
+{
+  uint16_t K_bytes = (K + 7) / 8;
+  uint16_t N_bytes = (N + 7) / 8;
+  uint16_t messageBytes = (messageBits + 7) / 8;
+  uint16_t bitsForCalculation = (calculationBits > 0) ? calculationBits : messageBits;
+  uint16_t C = (bitsForCalculation + K - 1) / K; // Number of blocks
+  bool corrupt = false;
+
+  BlockCheckJob check;
+  check.data = data;
+  check.messageBits = messageBits;
+  check.out = out;
+  check.syndrome = prepareSyndromeCheck();
+  // Only looked up when it can be used: selectLocalEncoder() may reconfigure
+  // qcEncoder or attach the flash table
+  check.fallback = (check.syndrome || localEncoding) ? selectLocalEncoder(K, N) : NULL;
+  bool checking = check.syndrome || check.fallback != NULL;
+
+  // Concurrent checking leaves this core to the links; blocks are checked on
+  // the other core as they complete and only the last one is waited for
+  bool concurrent = checking && concurrentCheck && verifierReady();
+  if (concurrent)
+    verifierStart(&check, blockVerdicts, C);
+
+  LOG_PRINTF("Sending %d blocks of %d bytes each over %d link(s)\n", C, K_bytes, jobLinkCount);
+  LOG_PRINTF("Using %d bits for calculation, sending %d bits of actual data\n", bitsForCalculation, messageBits);
+
+  uint8_t busyLinks = 0;
+  for (uint8_t i = 0; i < jobLinkCount; i++)
+  {
+    EncoderLink &link = *jobLinks[i];
+    link.sentBlocks = 0;
+    link.sentBytes = 0;
+    link.receivedBlocks = 0;
+    link.receivedBytes = 0;
+    link.nextByteAt = millis();
+    link.lastTraffic = millis();
+    if (link.blockCount > 0)
+      busyLinks++;
+  }
+
+  while (busyLinks > 0)
+  {
+    ingestCommands(); // Requests arriving meanwhile queue up for the scheduler
+
+    for (uint8_t i = 0; i < jobLinkCount; i++)
+    {
+      EncoderLink &link = *jobLinks[i];
+      if (link.receivedBlocks == link.blockCount)
+        continue;
+
+      unsigned long now = millis();
+
+      // Send the next byte once the pacing gap is over and the queue has room
+      if (link.sentBlocks < link.blockCount && link.sentBlocks - link.receivedBlocks < link.queueDepth &&
+          (long)(now - link.nextByteAt) >= 0)
+      {
+        uint16_t dataIndex = (link.firstBlock + link.sentBlocks) * K_bytes + link.sentBytes;
+        if (link.sentBytes == 0)
+          PHASE_STAMP(link.blockStartedAt);
+        link.port->write((dataIndex < messageBytes) ? data[dataIndex] : 0);
+        link.nextByteAt = now + LINK_BYTE_GAP_MS;
+        link.lastTraffic = now;
+        if (++link.sentBytes == K_bytes)
+        {
+          PHASE_RECORD(PHASE_BLOCK_TX, link.blockStartedAt);
+          PHASE_STAMP(link.sentAt[link.sentBlocks % LINK_QUEUE_DEPTH]);
+          link.sentBytes = 0;
+          link.sentBlocks++;
+          LOG_PRINTF("Sent block %d/%d on %s\n", link.firstBlock + link.sentBlocks, C, link.name);
+        }
+      }
+
+      // Codewords only come back for blocks that have been sent in full
+      while (link.receivedBlocks < link.sentBlocks && link.port->available())
+      {
+        uint16_t block = link.firstBlock + link.receivedBlocks;
+        out[block * N_bytes + link.receivedBytes] = link.port->read();
+        link.lastTraffic = now;
+        if (++link.receivedBytes < N_bytes)
+          continue;
+
+        PHASE_RECORD(PHASE_BLOCK_RX, link.sentAt[link.receivedBlocks % LINK_QUEUE_DEPTH]);
+        link.receivedBytes = 0;
+        link.receivedBlocks++;
+        link.blocks++;
+        LOG_PRINTF("Received %d encoded bytes for block %d (%s)\n", N_bytes, block + 1, link.name);
+
+        // Keep going after a bad block so the MCU stays in step
+        if (concurrent)
+          verifierPush(block);
+        else if (checking && !verifyReceivedBlock(check, block))
+          corrupt = true;
+      }
+
+      if (link.receivedBlocks == link.blockCount)
+      {
+        busyLinks--;
+      }
+      else if (link.receivedBlocks < link.sentBlocks && now - link.lastTraffic > LINK_TIMEOUT_MS)
+      {
+        link.timeouts++;
+        LOG_PRINTF("Timeout receiving encoded data for block %d (%s)\n", link.firstBlock + link.receivedBlocks + 1,
+                   link.name);
+        if (concurrent)
+          verifierFinish(); // check goes out of scope
+
+        // The other MCUs are part way through their shares: finish those so
+        // they stay in step, and stripe no more shares over this one
+        for (uint8_t j = 0; j < jobLinkCount; j++)
+        {
+          if (jobLinks[j] != &link && jobLinks[j]->receivedBlocks < jobLinks[j]->blockCount)
+            finishShare(*jobLinks[j], K_bytes, N_bytes);
+        }
+        if (&link != &links[0])
+          link.mismatched = true;
+        return JOB_ERR_DATA;
+      }
+    }
+    delay(1);
+  }
+
+  if (concurrent)
+  {
+    verifierFinish();
+    for (uint16_t block = 0; block < C; block++)
+    {
+      logBlockVerdict(block, blockVerdicts[block], 0); // Bit counts stay on the verifier core
+      if (blockVerdicts[block] == BLOCK_CORRUPT)
+        corrupt = true;
+    }
+  }
+
+  return corrupt ? JOB_ERR_CHECK : JOB_OK;
+}
+
+uint16_t textToBits(const char *text, size_t length, uint8_t *buffer)
+{
+  PHASE_SCOPE(PHASE_INPUT_CONVERSION);
+  uint16_t byteCount = (uint16_t)min(length, (size_t)(MAX_MESSAGE_LENGTH - 1));
+  memcpy(buffer, text, byteCount);
+  return byteCount * 8; // Convert bytes to bits
+}
+
+// Returns the value of a hex digit, or -1 for anything else
+int8_t hexNibble(char c)
+{
+  if (c >= '0' && c <= '9')
+    return c - '0';
+  if (c >= 'a' && c <= 'f')
+    return c - 'a' + 10;
+  if (c >= 'A' && c <= 'F')
+    return c - 'A' + 10;
+  return -1;
+}
+
+uint16_t hexToBits(const char *hexStr, size_t length, uint8_t *buffer)
+{
+  PHASE_SCOPE(PHASE_INPUT_CONVERSION);
+  uint16_t byteCount = 0;
+  int8_t highNibble = -1;
+
+  for (size_t i = 0; i < length && byteCount < MAX_MESSAGE_LENGTH; i++)
+  {
+    char c = hexStr[i];
+    if (c == ' ' || c == '\n' || c == '\r')
+      continue;
+
+    int8_t nibble = hexNibble(c);
+    if (nibble < 0)
+      nibble = 0; // Treat stray characters as zero, like strtol would
+
+    if (highNibble < 0)
+    {
+      highNibble = nibble;
+    }
+    else
+    {
+      buffer[byteCount++] = (uint8_t)((highNibble << 4) | nibble);
+      highNibble = -1;
+    }
+  }
+  return byteCount * 8; // Convert bytes to bits
+}
+
+// Returns 0 for malformed base64 or a message that does not fit message_buffer
+uint16_t base64ToBits(const char *text, size_t length, uint8_t *buffer)
+{
+  PHASE_SCOPE(PHASE_INPUT_CONVERSION);
+  size_t byteCount = base64Decode(text, length, buffer, MAX_MESSAGE_LENGTH);
+  if (byteCount == BASE64_INVALID)
+    return 0;
+  return byteCount * 8; // Convert bytes to bits
+}
+
+uint16_t binaryToBits(const uint8_t *data, size_t length, uint8_t *buffer)
+{
+  PHASE_SCOPE(PHASE_INPUT_CONVERSION);
+  uint16_t byteCount = (uint16_t)min(length, (size_t)MAX_MESSAGE_LENGTH);
+  memcpy(buffer, data, byteCount);
+  return byteCount * 8; // Convert bytes to bits
+}
+
+// Reader for a length-prefixed raw binary message, filled without blocking
+struct BinaryReader
+{
+  uint16_t expected; // Byte count from the 2-byte big-endian prefix
+  uint16_t received;
+  uint8_t prefixBytes;
+};
+
+void resetBinary(BinaryReader &reader)
+{
+  reader.expected = 0;
+  reader.received = 0;
+  reader.prefixBytes = 0;
+}
+
+// Reads whatever is pending straight into buffer. Bytes beyond MAX_MESSAGE_LENGTH
+// are consumed and dropped. Returns true once the whole message has arrived.
+bool pollBinary(BinaryReader &reader, Stream &stream, uint8_t *buffer)
+{
+  while (reader.prefixBytes < 2)
+  {
+    if (!stream.available())
+      return false;
+    reader.expected = (reader.expected << 8) | (uint8_t)stream.read();
+    reader.prefixBytes++;
+  }
+
+  while (reader.received < reader.expected && stream.available())
+  {
+    if (reader.received < MAX_MESSAGE_LENGTH)
+    {
+      size_t chunk = min((size_t)stream.available(), (size_t)(min(reader.expected, (uint16_t)MAX_MESSAGE_LENGTH) - reader.received));
+      reader.received += stream.readBytes(buffer + reader.received, chunk);
+    }
+    else
+    {
+      stream.read();
+      reader.received++;
+    }
+  }
+  return reader.received >= reader.expected;
+}
+
+// Blocks until a length-prefixed binary message has been read from the console.
+// Hosts on other ports are served meanwhile, so buffer must not be one their
+// jobs use.
+uint16_t readConsoleBinary(uint8_t *buffer)
+{
+  BinaryReader reader;
+  resetBinary(reader);
+  while (!pollBinary(reader, Serial, buffer))
+  {
+    pollCommands();
+    delay(1);
+  }
+  if (reader.expected > MAX_MESSAGE_LENGTH)
+  {
+    Serial.printf("Input truncated to %d bytes\n", MAX_MESSAGE_LENGTH);
+  }
+  return min(reader.expected, (uint16_t)MAX_MESSAGE_LENGTH) * 8;
+}
+
+void rememberParameters(uint16_t bits, uint16_t k, uint16_t n)
+{
+  for (uint8_t i = 0; i < PARAM_CACHE_SIZE; i++)
+  {
+    if (paramCache[i].bits == bits)
+    {
+      paramCache[i].K = k;
+      paramCache[i].N = n;
+      return;
+    }
+  }
+
+  paramCache[paramCacheNext].bits = bits;
+  paramCache[paramCacheNext].K = k;
+  paramCache[paramCacheNext].N = n;
+  paramCacheNext = (paramCacheNext + 1) % PARAM_CACHE_SIZE;
+}
+
+bool lookupParameters(uint16_t bits, uint16_t &k, uint16_t &n)
+{
+  for (uint8_t i = 0; i < PARAM_CACHE_SIZE; i++)
+  {
+    if (paramCache[i].bits == bits && paramCache[i].K > 0)
+    {
+      k = paramCache[i].K;
+      n = paramCache[i].N;
+      return true;
+    }
+  }
+  return false;
+}
+
+// Returns a local encoder for (k, n), configuring the QC encoder if needed
+const LdpcEncoder *selectLocalEncoder(uint16_t k, uint16_t n)
+{
+  if (k == kernel80211n648.K && n == kernel80211n648.N)
+    return &kernel80211n648;
+
+  if (flashTableEncoder.ready() && flashTableEncoder.K == k && flashTableEncoder.N == n)
+    return &flashTableEncoder;
+
+  // A prebuilt table beats the QC encoder; it stays in flash
+  const LdpcStoreEntry *table = codeStore.findGenerator(k, n, LDPC_STORE_GENERATOR_TABLE);
+  if (table != NULL && flashTableEncoder.attach(k, n, table->chunkBits, (const uint32_t *)codeStore.payload(*table)))
+    return &flashTableEncoder;
+
+  if (qcEncoder.ready() && qcEncoder.K == k && qcEncoder.N == n)
+    return &qcEncoder;
+
+  QcCodeMatch match;
+  if (qcFindCode(k, n, match) && qcEncoder.configure(*match.graph, match.Z, k, n, match.punctured))
+    return &qcEncoder;
+
+  return NULL;
+}
+
+const char *localEncoderName(const LdpcEncoder *encoder)
+{
+  if (encoder == NULL)
+    return "none";
+  if (encoder == &kernel80211n648)
+    return "802.11n 648 R1/2 bit-sliced kernel";
+  if (encoder == &flashTableEncoder)
+    return "generator table in flash";
+  return qcEncoder.baseGraph()->name;
+}
+
+// Name of the encoder selectLocalEncoder() would pick for (k, n), without
+// configuring or attaching anything
+const char *localCodeName(uint16_t k, uint16_t n)
+{
+  if (k == kernel80211n648.K && n == kernel80211n648.N)
+    return localEncoderName(&kernel80211n648);
+  if ((flashTableEncoder.ready() && flashTableEncoder.K == k && flashTableEncoder.N == n) ||
+      codeStore.findGenerator(k, n, LDPC_STORE_GENERATOR_TABLE) != NULL)
+    return localEncoderName(&flashTableEncoder);
+
+  QcCodeMatch match;
+  if (qcFindCode(k, n, match))
+    return match.graph->name;
+  return localEncoderName(NULL);
+}
+
+// Instance of the same code for the worker core, or NULL. The table encoder
+// only reads its table and can be shared.
+const LdpcEncoder *workerEncoder(const LdpcEncoder &encoder)
+{
+  if (&encoder == &kernel80211n648)
+    return &workerKernel80211n648;
+  if (&encoder == &flashTableEncoder)
+    return &flashTableEncoder;
+
+  if (workerQcEncoder.ready() && workerQcEncoder.K == encoder.K && workerQcEncoder.N == encoder.N)
+    return &workerQcEncoder;
+
+  QcCodeMatch match;
+  if (qcFindCode(encoder.K, encoder.N, match) &&
+      workerQcEncoder.configure(*match.graph, match.Z, encoder.K, encoder.N, match.punctured))
+    return &workerQcEncoder;
+  return NULL;
+}
+
+// Encodes a message into out without involving the MCU
+bool encodeLocally(const LdpcEncoder &encoder, const uint8_t *data, uint16_t messageBits, uint16_t calculationBits,
+                   uint8_t *out)
+{
+  uint16_t blocks = (calculationBits + encoder.K - 1) / encoder.K;
+  if ((uint32_t)blocks * LDPC_BYTES(encoder.N) > sizeof(encoded_buffer))
+  {
+    LOG_PRINTLN("Encoded data does not fit the output buffer!");
+    return false;
+  }
+
+  const LdpcEncoder *worker = (blocks >= PARALLEL_MIN_BLOCKS) ? workerEncoder(encoder) : NULL;
+  uint8_t cores = parallelEncodeBlocks(encoder, worker, data, messageBits, blocks, out);
+  LOG_PRINTF("Encoded %d blocks locally (%s, %d core%s)\n", blocks, localEncoderName(&encoder), cores,
+             cores > 1 ? "s" : "");
+  return true;
+}
+
+const char *jobStatusMessage(JobStatus status)
+{
+  switch (status)
+  {
+  case JOB_OK:
+    return "OK";
+  case JOB_ERR_TAG:
+    return "Failed to receive tag from microcontroller!";
+  case JOB_ERR_LENGTH:
+    return "Failed to send message length!";
+  case JOB_ERR_PARAMS:
+    return "Failed to receive LDPC parameters!";
+  case JOB_ERR_DATA:
+    return "Failed to send message data!";
+  case JOB_ERR_INPUT:
+    return "Invalid message input!";
+  case JOB_ERR_FRAME:
+    return "Malformed command frame!";
+  case JOB_ERR_CHECK:
+    return "Encoded data failed the parity check!";
+  case JOB_ERR_DECODE:
+    return "Decoder did not converge!";
+  default:
+    return "Unknown command!";
+  }
+}
+
+// Configures the decoder for (k, n); false if no built-in code matches
+bool prepareDecoder(uint16_t k, uint16_t n)
+{
+  if (ldpcDecoder.ready() && ldpcDecoder.K == k && ldpcDecoder.N == n)
+    return true;
+
+  QcCodeMatch match;
+  if (!qcFindCode(k, n, match) || !ldpcDecoder.configure(*match.graph, match.Z, k, n, match.punctured))
+    return false;
+  ldpcDecoder.setIterations(DECODER_MAX_ITERATIONS);
+  return true;
+}
+
+// Decodes one block from LLRs, or from hard bits when llr is NULL, and updates the statistics
+bool decodeBlock(const int8_t *llr, const uint8_t *codeword, uint8_t *info, uint8_t &iterations)
+{
+  unsigned long start = micros();
+  bool ok = (llr != NULL) ? ldpcDecoder.decode(llr, info, iterations)
+                          : ldpcDecoder.decodeHard(codeword, DECODER_HARD_LLR, info, iterations);
+  decodeMicros += micros() - start;
+  decodedBlocks++;
+  decodeIterations += iterations;
+  if (!ok)
+    decodeFailures++;
+  return ok;
+}
+
+float decodedBlocksPerSecond()
+{
+  return decodeMicros ? decodedBlocks * 1e6f / decodeMicros : 0.0f;
+}
+
+float decoderIterationsPerBlock()
+{
+  return decodedBlocks ? (float)decodeIterations / decodedBlocks : 0.0f;
+}
+
+// Loopback check: decodes the last encoded result and compares it with the message
+void runLoopbackDecode()
+{
+  const ResultRecord *result = historyAt(0);
+  if (result == NULL)
+  {
+    Serial.println("No encoding results available yet.");
+    return;
+  }
+
+  uint16_t k = result->K;
+  uint16_t n = result->N;
+  if (!prepareDecoder(k, n))
+  {
+    Serial.printf("No decoder for K=%d, N=%d\n", k, n);
+    return;
+  }
+
+  const uint8_t *message = historyMessage(*result);
+  const uint8_t *encoded = historyEncoded(*result);
+  uint16_t K_bytes = (k + 7) / 8;
+  uint16_t N_bytes = (n + 7) / 8;
+  uint16_t messageBytes = result->messageBytes;
+  uint16_t blocks = result->blocks;
+  uint16_t matching = 0;
+  uint16_t failed = 0;
+  uint32_t iterationSum = 0;
+  uint8_t info[LDPC_BYTES(LDPC_MAX_K)];
+  uint8_t expected[LDPC_BYTES(LDPC_MAX_K)];
+
+  for (uint16_t block = 0; block < blocks; block++)
+  {
+    uint8_t iterations;
+    if (!decodeBlock(NULL, encoded + block * N_bytes, info, iterations))
+      failed++;
+    iterationSum += iterations;
+
+    // Message bytes of this block, zero-padded like sendMessageData()
+    uint16_t offset = block * K_bytes;
+    uint16_t available = (offset < messageBytes) ? min((uint16_t)(messageBytes - offset), K_bytes) : 0;
+    memset(expected, 0, K_bytes);
+    memcpy(expected, message + offset, available);
+    if (k % 8)
+      expected[K_bytes - 1] &= (uint8_t)(0xFF << (8 - k % 8));
+    if (memcmp(info, expected, K_bytes) == 0)
+      matching++;
+  }
+
+  Serial.printf("Job %u: decoded %d blocks: %d match the message, %d failed to converge, %.2f iterations/block\n", result->id, blocks,
+                matching, failed, (float)iterationSum / blocks);
+}
+
+// True if the codewords of calculationBits with code (k, n) fit capacity bytes
+bool fitsOutput(uint16_t calculationBits, uint16_t k, uint16_t n, size_t capacity)
+{
+  return k > 0 && (uint32_t)(calculationBits + k - 1) / k * LDPC_BYTES(n) <= capacity;
+}
+
+// Completes a share the job will not use: sends zero blocks for the length
+// announced to the MCU and discards the codewords, so the MCU is ready for the
+// next transaction. Returns false if the MCU stops answering.
+bool drainLink(EncoderLink &link)
+{
+  uint16_t kBytes = LDPC_BYTES(link.K);
+  uint16_t nBytes = LDPC_BYTES(link.N);
+  uint16_t blocks = (link.shareBits + link.K - 1) / link.K;
+
+  LOG_PRINTF("Draining %d blocks on %s\n", blocks, link.name);
+  for (uint16_t block = 0; block < blocks; block++)
+  {
+    for (uint16_t i = 0; i < kBytes; i++)
+    {
+      link.port->write((uint8_t)0);
+      delay(LINK_BYTE_GAP_MS);
+    }
+
+    unsigned long lastTraffic = millis();
+    for (uint16_t received = 0; received < nBytes;)
+    {
+      if (link.port->available())
+      {
+        link.port->read();
+        received++;
+        lastTraffic = millis();
+      }
+      else if (millis() - lastTraffic > LINK_TIMEOUT_MS)
+      {
+        link.timeouts++;
+        LOG_PRINTF("Timeout draining %s\n", link.name);
+        return false;
+      }
+      else
+      {
+        delay(1);
+      }
+    }
+  }
+  return true;
+}
+
+// Announces every striped share, then collects the parameters of each link.
+// Shares were cut for the cached code, so every MCU has to have picked it.
+// Returns false if a link failed or answered another code; those links are
+// no longer striped, and link.K stays 0 for links that did not answer.
+bool negotiateShares(uint16_t calculationBits)
+{
+  uint16_t cachedK;
+  uint16_t cachedN;
+  lookupParameters(calculationBits, cachedK, cachedN);
+
+  // Announce every share first so the MCUs pick their codes at the same time
+  for (uint8_t i = 0; i < jobLinkCount; i++)
+  {
+    jobLinks[i]->K = 0;
+    jobLinks[i]->N = 0;
+    sendMessageLength(*jobLinks[i], jobLinks[i]->shareBits);
+  }
+
+  bool agreed = true;
+  for (uint8_t i = 0; i < jobLinkCount; i++)
+  {
+    EncoderLink &link = *jobLinks[i];
+    bool answered = receiveParameters(link);
+    if (answered && link.K == cachedK && link.N == cachedN)
+      continue;
+
+    if (answered)
+      LOG_PRINTF("%s answered K=%d, N=%d for its share, expected K=%d, N=%d\n", link.name, link.K, link.N, cachedK,
+                 cachedN);
+
+    // The MCU picks its code by length: stop giving shares to the links involved
+    for (uint8_t j = 1; j < jobLinkCount; j++)
+    {
+      if (i == 0 || i == j)
+        jobLinks[j]->mismatched = true;
+    }
+    agreed = false;
+  }
+
+  K = cachedK;
+  N = cachedN;
+  return agreed;
+}
+
+// Picks the links for a job of calculationBits and their block ranges. A length
+// whose K/N is not known yet goes to the primary link alone; otherwise the
+// blocks are split evenly over the primary and every other link whose MCU has
+// sent its tag, each announced the length of its own share. Without striped
+// the job always goes to the primary link alone.
+void planLinks(uint16_t calculationBits, bool striped)
+{
+  uint16_t k;
+  uint16_t n;
+
+  jobLinks[0] = &links[0];
+  jobLinkCount = 1;
+  links[0].firstBlock = 0;
+  links[0].shareBits = calculationBits;
+
+  if (!striped || !lookupParameters(calculationBits, k, n))
+    return;
+
+  uint16_t blocks = (calculationBits + k - 1) / k;
+  for (uint8_t i = 1; i < LINK_COUNT && jobLinkCount < blocks; i++)
+  {
+    if (pollTag(links[i]) && !links[i].mismatched)
+      jobLinks[jobLinkCount++] = &links[i];
+  }
+
+  uint16_t firstBlock = 0;
+  for (uint8_t i = 0; i < jobLinkCount; i++)
+  {
+    EncoderLink &link = *jobLinks[i];
+    link.firstBlock = firstBlock;
+    link.blockCount = blocks / jobLinkCount + (i < blocks % jobLinkCount ? 1 : 0);
+    firstBlock += link.blockCount;
+
+    // The last share ends at the message length rather than a block boundary
+    uint32_t shareEnd = min((uint32_t)firstBlock * k, (uint32_t)calculationBits);
+    link.shareBits = (uint16_t)(shareEnd - (uint32_t)link.firstBlock * k);
+  }
+}
+
+// Runs one encoding transaction with the MCU for a message, codewords into out
+// (room for capacity bytes). calculationBits is the length announced to the
+// MCU and used for the block count.
+JobStatus runEncodingJob(const uint8_t *data, uint16_t messageBits, uint16_t calculationBits, uint8_t *out,
+                         size_t capacity)
+{
+  uint16_t cachedK;
+  uint16_t cachedN;
+
+  if (localEncoding && lookupParameters(calculationBits, cachedK, cachedN))
+  {
+    const LdpcEncoder *encoder = selectLocalEncoder(cachedK, cachedN);
+    if (encoder != NULL && fitsOutput(calculationBits, cachedK, cachedN, capacity))
+    {
+      K = cachedK;
+      N = cachedN;
+      return encodeLocally(*encoder, data, messageBits, calculationBits, out) ? JOB_OK : JOB_ERR_DATA;
+    }
+  }
+
+  if (!waitForTag(links[0]))
+    return JOB_ERR_TAG;
+
+  planLinks(calculationBits, true);
+  if (jobLinkCount > 1 && !negotiateShares(calculationBits))
+  {
+    // Every MCU that answered waits for the data of its share: finish those
+    // shares with zero blocks, then give the whole job to the primary link
+    for (uint8_t i = 0; i < jobLinkCount; i++)
+    {
+      if (jobLinks[i]->K > 0)
+        drainLink(*jobLinks[i]);
+    }
+    planLinks(calculationBits, false);
+  }
+  else if (jobLinkCount > 1 && !fitsOutput(calculationBits, K, N, capacity))
+  {
+    // Every MCU agreed on a code whose codewords do not fit: finish their shares
+    LOG_PRINTF("K=%d, N=%d does not fit %d bits into %d bytes\n", K, N, calculationBits, (int)capacity);
+    for (uint8_t i = 0; i < jobLinkCount; i++)
+      drainLink(*jobLinks[i]);
+    return JOB_ERR_PARAMS;
+  }
+
+  if (jobLinkCount == 1)
+  {
+    if (!sendMessageLength(links[0], calculationBits))
+      return JOB_ERR_LENGTH;
+    if (!receiveParameters(links[0]))
+      return JOB_ERR_PARAMS;
+
+    // The MCU's code decides the output size: refuse it before sending the message
+    if (!fitsOutput(calculationBits, links[0].K, links[0].N, capacity))
+    {
+      LOG_PRINTF("K=%d, N=%d does not fit %d bits into %d bytes\n", links[0].K, links[0].N, calculationBits,
+                 (int)capacity);
+      if (links[0].K > 0 && links[0].K < links[0].N)
+        drainLink(links[0]); // The MCU still expects its blocks
+      return JOB_ERR_PARAMS;
+    }
+
+    K = links[0].K;
+    N = links[0].N;
+    rememberParameters(calculationBits, K, N);
+    links[0].blockCount = (calculationBits + K - 1) / K;
+  }
+
+  return sendMessageData(data, messageBits, calculationBits, out);
+}
+
+void handleEncoding(InputMode mode)
+{
+  uint16_t manual_message_bits;
+
+  if (mode == INPUT_HEX_MANUAL)
+  {
+    Serial.println("Enter message length: ");
+
+    readConsoleLine(consoleReader);
+    manual_message_bits = (uint16_t)strtoul(consoleReader.buffer, NULL, 10);
+    Serial.printf("Manual message length set to: %d bits\n", manual_message_bits);
+  }
+
+  Serial.println("Enter your message:");
+  if (mode == INPUT_TEXT)
+  {
+    Serial.println("(Type your text message and press Enter)");
+  }
+  else if (mode == INPUT_BASE64)
+  {
+    Serial.println("(Enter base64, e.g., 'q83vEg==' and press Enter)");
+  }
+  else if (mode == INPUT_BINARY)
+  {
+    Serial.println("(Send a 2-byte big-endian byte count followed by the raw bytes)");
+  }
+  else
+  {
+    Serial.println("(Enter hex bytes, e.g., 'AB CD EF 12' and press Enter)");
+  }
+
+  if (mode == INPUT_BINARY)
+  {
+    // Read into the console line: jobs from other hosts fill message_buffer meanwhile
+    uint16_t bytes = readConsoleBinary((uint8_t *)consoleReader.buffer) / 8;
+    message_bits = binaryToBits((const uint8_t *)consoleReader.buffer, bytes, message_buffer);
+    if (message_bits == 0)
+    {
+      Serial.println("No message entered!");
+      return;
+    }
+  }
+  else
+  {
+    readConsoleLine(consoleReader);
+
+    const char *userInput = consoleReader.buffer;
+    size_t inputLength = consoleReader.length;
+    trimView(userInput, inputLength);
+
+    if (inputLength == 0)
+    {
+      Serial.println("No message entered!");
+      return;
+    }
+
+    if (consoleReader.overflow)
+    {
+      Serial.printf("Input truncated to %d characters\n", CONSOLE_LINE_LENGTH);
+    }
+
+    Serial.print("Message entered: ");
+    Serial.write((const uint8_t *)userInput, inputLength);
+    Serial.println();
+
+    // Convert input to bits
+    if (mode == INPUT_TEXT)
+    {
+      message_bits = textToBits(userInput, inputLength, message_buffer);
+    }
+    else if (mode == INPUT_BASE64)
+    {
+      message_bits = base64ToBits(userInput, inputLength, message_buffer);
+      if (message_bits == 0)
+      {
+        Serial.println("Invalid base64 input!");
+        return;
+      }
+    }
+    else
+    {
+      message_bits = hexToBits(userInput, inputLength, message_buffer);
+    }
+  }
+
+  Serial.printf("Message converted to %d bits (%d bytes)\n", message_bits, (message_bits + 7) / 8);
+
+  // Start LDPC encoding process
+  Serial.println("\nStarting LDPC encoding process...");
+
+  uint16_t bitsUsedForCalculation = (mode == INPUT_HEX_MANUAL) ? manual_message_bits : message_bits;
+  if (bitsUsedForCalculation == 0 || bitsUsedForCalculation > MAX_CALCULATION_BITS)
+  {
+    Serial.printf("Message length must be 1 to %d bits\n", MAX_CALCULATION_BITS);
+    return;
+  }
+
+  JobStatus status = runEncodingJob(message_buffer, message_bits, bitsUsedForCalculation, encoded_buffer,
+                                     sizeof(encoded_buffer));
+  if (status != JOB_OK)
+  {
+    Serial.println(jobStatusMessage(status));
+    return;
+  }
+
+  const ResultRecord *result =
+      historyAdd(mode, K, N, message_bits, bitsUsedForCalculation, message_buffer, encoded_buffer);
+
+  Serial.println("\nEncoding completed successfully!");
+  Serial.println("=================================");
+  if (result != NULL)
+    Serial.printf("Job ID: %u\n", result->id);
+  Serial.printf("Original message (%d bits, %d bits used for calculation):\n", message_bits, bitsUsedForCalculation);
+  printResult(message_buffer, (message_bits + 7) / 8, RESULT_FRAME_MESSAGE, mode == INPUT_TEXT); // Display as ASCII for text input, display as hex for hex input
+  Serial.printf("\nEncoded data (%d bits per block, %d blocks):\n", N, (bitsUsedForCalculation + K - 1) / K);
+  uint16_t totalEncodedBytes = ((bitsUsedForCalculation + K - 1) / K) * ((N + 7) / 8);
+  printResult(encoded_buffer, totalEncodedBytes, RESULT_FRAME_ENCODED, false);
+  Serial.println();
+}
+
+// Lists the result history and shows one result in full, the last by default
+void showResults()
+{
+  if (historyCount() == 0)
+  {
+    Serial.println("No encoding results available yet.");
+    return;
+  }
+
+  Serial.println("Encoding results:");
+  for (uint8_t age = 0; age < historyCount(); age++)
+  {
+    const ResultRecord *result = historyAt(age);
+    Serial.printf("  Job %u: K=%d, N=%d, %d message bits, %d bits used for calculation, %d blocks\n", result->id,
+                  result->K, result->N, result->messageBits, result->calculationBits, result->blocks);
+  }
+
+  Serial.println("Enter job ID (or press Enter for the last one):");
+  readConsoleLine(consoleReader);
+  const ResultRecord *result = historyAt(0);
+  if (consoleReader.length > 0)
+    result = historyFind((uint16_t)strtoul(consoleReader.buffer, NULL, 10));
+  if (result == NULL)
+  {
+    Serial.println("No such job in the result history.");
+    return;
+  }
+
+  Serial.printf("Job %u: K=%d, N=%d, Message bits=%d, %d bits used for calculation\n", result->id, result->K,
+                result->N, result->messageBits, result->calculationBits);
+  Serial.println("Original message:");
+  printResult(historyMessage(*result), result->messageBytes, RESULT_FRAME_MESSAGE, result->mode == INPUT_TEXT); // Display as ASCII for text input, display as hex for hex input
+  Serial.printf("Encoded data (%d blocks):\n", result->blocks);
+  printResult(historyEncoded(*result), result->encodedBytes, RESULT_FRAME_ENCODED, false);
+}
+
+void handleOutputFormat()
+{
+  Serial.println("Select output format:");
+  Serial.println("1 - Hex dump");
+  Serial.println("2 - Base64");
+  Serial.println("3 - Binary frame (A5 5A, type, length, data, CRC-32)");
+
+  readConsoleLine(consoleReader);
+
+  switch (strtoul(consoleReader.buffer, NULL, 10))
+  {
+  case OUTPUT_HEX:
+    outputFormat = OUTPUT_HEX;
+    break;
+  case OUTPUT_BASE64:
+    outputFormat = OUTPUT_BASE64;
+    break;
+  case OUTPUT_BINARY:
+    outputFormat = OUTPUT_BINARY;
+    break;
+  default:
+    Serial.println("Invalid format, keeping current setting.");
+    return;
+  }
+
+  Serial.printf("Output format set to: %s\n", outputFormatName(outputFormat));
+}
+
+// Sends a response frame whose payload has been assembled in responseBuffer
+void sendResponse(uint8_t type, uint16_t length)
+{
+  DumpWriter writer;
+  beginDump(writer, responseBuffer, length, DUMP_BINARY, type);
+  while (!pumpDump(writer, *responsePort))
+  {
+    yield();
+  }
+}
 
-#ifdef USE_TAG
-bool tagReceived = false; // Track if tag has been received
-#endif
+void sendAck(uint8_t type, uint8_t seq, JobStatus status)
+{
+  responseBuffer[0] = seq;
+  responseBuffer[1] = (uint8_t)status;
+  sendResponse(type, 2);
+}
 
-void printMenu()
+void putUint16(uint8_t *dst, uint16_t value)
 {
-  Serial.println("LDPC Encoder Client Menu:");
-  Serial.println("1 - Encode text message");
-  Serial.println("2 - Encode hex message");
-  Serial.println("3 - Encode hex message with manual bit length");
-  Serial.println("4 - Check system status");
-  Serial.println("5 - Show last encoding results");
-#ifdef USE_TAG
-  Serial.println("6 - Reset tag state (force tag wait on next encoding)");
-  Serial.println("Enter your choice (1-6): ");
-#else
-  Serial.println("Enter your choice (1-5): ");
-#endif
+  dst[0] = (uint8_t)(value >> 8);
+  dst[1] = (uint8_t)(value & 0xFF);
 }
 
-void printBytes(const uint8_t *data, uint16_t length, bool asHex = true)
+// Appends the encode header and the encoded blocks of a result after seq/status
+uint16_t buildEncodeResponse(const ResultRecord &result)
 {
-  if (asHex)
-  {
-    for (uint16_t i = 0; i < length; i++)
-    {
-      Serial.printf("%02X", data[i]);
-      if ((i + 1) % 16 == 0)
-        Serial.println();
-      else if ((i + 1) % 4 == 0)
-        Serial.print(" ");
-    }
-    if (length % 16 != 0)
-      Serial.println();
-  }
-  else
+  putUint16(responseBuffer + 2, result.K);
+  putUint16(responseBuffer + 4, result.N);
+  putUint16(responseBuffer + 6, result.messageBits);
+  putUint16(responseBuffer + 8, result.calculationBits);
+  putUint16(responseBuffer + 10, result.blocks);
+  putUint16(responseBuffer + 12, result.id);
+  memcpy(responseBuffer + RESP_ENCODE_HEADER, historyEncoded(result), result.encodedBytes);
+  return RESP_ENCODE_HEADER + result.encodedBytes;
+}
+
+// Answers with a result from the history, or JOB_ERR_NO_RESULT
+void sendResult(uint8_t seq, const ResultRecord *result)
+{
+  if (result == NULL)
   {
-    for (uint16_t i = 0; i < length; i++)
-    {
-      if (data[i] >= 32 && data[i] <= 126)
-        Serial.write(data[i]);
-      else
-        Serial.print('.');
-    }
-    Serial.println();
+    sendAck(RESP_ERROR, seq, JOB_ERR_NO_RESULT);
+    return;
   }
+
+  responseBuffer[0] = seq;
+  responseBuffer[1] = JOB_OK;
+  sendResponse(RESP_ENCODE, buildEncodeResponse(*result));
 }
 
-bool waitForTag()
+bool jobQueueHasRoom()
 {
-#ifdef USE_TAG
-  if (tagReceived)
+  // Converted input goes straight to the arena, so keep room for a full message
+  return jobCount < JOB_QUEUE_SIZE && sizeof(jobArena) - jobArenaUsed >= MAX_MESSAGE_LENGTH;
+}
+
+// Queues an encode request (the caller makes sure there is room)
+void queueEncode(uint8_t producer, uint8_t seq, const uint8_t *payload, uint16_t length)
+{
+  responsePort = producers[producer].port;
+
+  if (length < 4)
   {
-    Serial.println("Tag already received, skipping tag wait...");
-    return true;
+    sendAck(RESP_ERROR, seq, JOB_ERR_INPUT);
+    return;
   }
 
-  Serial.println("Waiting for microcontroller tag...");
-  uint8_t tagBytes[4] = {0};
-  int tagIndex = 0;
-  unsigned long startTime = millis();
+  InputMode mode = (InputMode)(payload[1] & ~ENCODE_LATENCY);
+  JobClass jobClass = (payload[1] & ENCODE_LATENCY) ? JOB_CLASS_LATENCY : JOB_CLASS_BULK;
+  uint16_t manualBits = ((uint16_t)payload[2] << 8) | payload[3];
+  const char *message = (const char *)payload + 4;
+  size_t messageLength = length - 4;
+  uint8_t *buffer = jobArena + jobArenaUsed;
+  uint16_t messageBits;
 
-  while (millis() - startTime < 5000) // 5 second timeout
+  if (mode == INPUT_TEXT)
   {
-    if (Serial2.available())
-    {
-      uint8_t receivedByte = Serial2.read();
+    messageBits = textToBits(message, messageLength, buffer);
+  }
+  else if (mode == INPUT_HEX || mode == INPUT_HEX_MANUAL)
+  {
+    messageBits = hexToBits(message, messageLength, buffer);
+  }
+  else if (mode == INPUT_BASE64)
+  {
+    messageBits = base64ToBits(message, messageLength, buffer);
+  }
+  else if (mode == INPUT_BINARY)
+  {
+    messageBits = binaryToBits(payload + 4, messageLength, buffer);
+  }
+  else
+  {
+    sendAck(RESP_ERROR, seq, JOB_ERR_INPUT);
+    return;
+  }
 
-      if (receivedByte == LDPC_TAG_0 && tagIndex == 0)
-      {
-        tagBytes[0] = receivedByte;
-        tagIndex = 1;
-      }
-      else if (receivedByte == LDPC_TAG_1 && tagIndex == 1)
-      {
-        tagBytes[1] = receivedByte;
-        tagIndex = 2;
-      }
-      else if (receivedByte == LDPC_TAG_2 && tagIndex == 2)
-      {
-        tagBytes[2] = receivedByte;
-        tagIndex = 3;
-      }
-      else if (receivedByte == LDPC_TAG_3 && tagIndex == 3)
-      {
-        tagBytes[3] = receivedByte;
-        Serial.println("Tag received successfully!");
-        tagReceived = true;
-        return true;
-      }
-      else
-      {
-        tagIndex = 0; // Reset if sequence breaks
-      }
-    }
-    delay(1);
+  uint16_t calculationBits = (mode == INPUT_HEX_MANUAL && manualBits > 0) ? manualBits : messageBits;
+  if (messageBits == 0 || calculationBits > MAX_CALCULATION_BITS)
+  {
+    sendAck(RESP_ENCODE, seq, JOB_ERR_INPUT);
+    return;
   }
 
-  Serial.println("Timeout waiting for tag!");
-  return false;
-#else
-  Serial.println("Tag checking disabled, proceeding...");
-  return true;
-#endif
+  EncodeJob &job = jobQueue[jobCount++];
+  job.seq = seq;
+  job.producer = producer;
+  job.mode = mode;
+  job.jobClass = jobClass;
+  job.messageBits = messageBits;
+  job.calculationBits = calculationBits;
+  job.offset = jobArenaUsed;
+  job.doneBlocks = 0;
+  job.queuedAt = millis();
+  job.started = false;
+  job.done = false;
+  jobArenaUsed += (messageBits + 7) / 8;
+
+  if (jobClass == JOB_CLASS_LATENCY)
+    lastLatencyAt = millis();
+
+  JobClassStats &stats = classStats[jobClass];
+  if (++stats.depth > stats.maxDepth)
+    stats.maxDepth = stats.depth;
 }
 
-bool sendMessageLength(uint16_t bits)
+JobClass effectiveClass(const EncodeJob &job)
 {
-  uint8_t len_hi = (uint8_t)(bits >> 8);
-  uint8_t len_lo = (uint8_t)(bits & 0xFF);
+  if (job.jobClass == JOB_CLASS_LATENCY || millis() - job.queuedAt >= JOB_AGING_MS)
+    return JOB_CLASS_LATENCY;
+  return JOB_CLASS_BULK;
+}
 
-  Serial2.write(len_hi);
-  delay(10);
-  Serial2.write(len_lo);
-  delay(10);
+// Oldest pending job of the highest effective class. A sliced job in progress
+// goes ahead of the other bulk jobs.
+uint8_t nextJob()
+{
+  int16_t best = -1;
+  for (uint8_t i = 0; i < jobCount; i++)
+  {
+    if (jobQueue[i].done)
+      continue;
+    if (best < 0 || effectiveClass(jobQueue[i]) > effectiveClass(jobQueue[best]) ||
+        (effectiveClass(jobQueue[i]) == effectiveClass(jobQueue[best]) && jobQueue[i].doneBlocks > 0 &&
+         jobQueue[best].doneBlocks == 0))
+      best = i;
+  }
+  return (uint8_t)best;
+}
 
-  Serial.printf("Sent message length: %d bits\n", bits);
-  return true;
+// True while latency jobs are queued or have been recently
+bool latencyTraffic()
+{
+  return classStats[JOB_CLASS_LATENCY].depth > 0 ||
+         (lastLatencyAt != 0 && millis() - lastLatencyAt < JOB_LATENCY_WINDOW_MS);
 }
 
-bool receiveParameters()
+// Bulk jobs longer than a slice run in slices when their code is known and
+// latency jobs are about; a job already part done always continues sliced
+bool sliceable(const EncodeJob &job, uint16_t k, uint16_t n)
 {
-  Serial.println("Waiting for K and N parameters...");
-  unsigned long startTime = millis();
+  if (job.doneBlocks > 0)
+    return true;
 
-  while (millis() - startTime < 3000) // 3 second timeout
+  uint16_t blocks = (job.calculationBits + k - 1) / k;
+  return !sliceRefused && latencyTraffic() && effectiveClass(job) == JOB_CLASS_BULK && blocks > JOB_SLICE_BLOCKS &&
+         (uint32_t)blocks * LDPC_BYTES(n) <= sizeof(sliceOutput);
+}
+
+// Picks the batch for the job at head: every later pending job of the same
+// effective class whose length has the same cached K/N, while the blocks fit
+// message_buffer and encoded_buffer (and a slice, for bulk jobs while latency
+// jobs are about). A length without a cached code runs alone (and caches it).
+// Returns the batch size.
+uint8_t collectBatch(uint8_t head, uint8_t *batch, uint16_t k, uint16_t n)
+{
+  uint8_t count = 0;
+  batch[count++] = head;
+  jobQueue[head].firstBlock = 0;
+  if (batchRefused || k == 0)
+    return count;
+
+  JobClass jobClass = effectiveClass(jobQueue[head]);
+  uint16_t maxBlocks = 0xFFFF;
+  if (jobClass == JOB_CLASS_BULK && latencyTraffic())
+    maxBlocks = max((uint16_t)JOB_SLICE_BLOCKS, (uint16_t)((jobQueue[head].calculationBits + k - 1) / k));
+
+  uint16_t totalBlocks = 0;
+  for (uint8_t i = head; i < jobCount; i++)
   {
-    if (Serial2.available() >= 4)
+    EncodeJob &job = jobQueue[i];
+    uint16_t jobK;
+    uint16_t jobN;
+    if (job.done || job.doneBlocks > 0 || effectiveClass(job) != jobClass ||
+        !lookupParameters(job.calculationBits, jobK, jobN) || jobK != k || jobN != n)
+      continue;
+
+    uint16_t blocks = (job.calculationBits + k - 1) / k;
+    if ((uint32_t)(totalBlocks + blocks) * LDPC_BYTES(k) > sizeof(message_buffer) ||
+        (uint32_t)(totalBlocks + blocks) * LDPC_BYTES(n) > sizeof(encoded_buffer) || totalBlocks + blocks > maxBlocks)
     {
-      uint8_t k_hi = Serial2.read();
-      uint8_t k_lo = Serial2.read();
-      uint8_t n_hi = Serial2.read();
-      uint8_t n_lo = Serial2.read();
-
-      K = ((uint16_t)k_hi << 8) | (uint16_t)k_lo;
-      N = ((uint16_t)n_hi << 8) | (uint16_t)n_lo;
-
-      Serial.printf("Received parameters: K=%d, N=%d\n", K, N);
-      return true;
+      if (i == head)
+        break; // Too long to share a transaction
+      continue;
     }
-    delay(10);
-  }
 
-  Serial.println("Timeout waiting for parameters!");
-  return false;
+    if (i != head)
+      batch[count++] = i;
+    job.firstBlock = totalBlocks;
+    totalBlocks += blocks;
+  }
+  return count;
 }
 
-bool sendMessageData(const uint8_t *data, uint16_t messageBits, uint16_t calculationBits = 0)
+// Records the wait of a job whose first transaction starts now
+void startJob(EncodeJob &job)
 {
-  uint16_t K_bytes = (K + 7) / 8;
-  uint16_t bitsForCalculation = (calculationBits > 0) ? calculationBits : messageBits;
-  uint16_t C = (bitsForCalculation + K - 1) / K; // Number of blocks
+  if (job.started)
+    return;
+  job.started = true;
 
-  Serial.printf("Sending %d blocks of %d bytes each\n", C, K_bytes);
-  Serial.printf("Using %d bits for calculation, sending %d bits of actual data\n", bitsForCalculation, messageBits);
+  JobClassStats &stats = classStats[job.jobClass];
+  uint32_t waitMs = millis() - job.queuedAt;
+  stats.jobs++;
+  stats.totalWaitMs += waitMs;
+  stats.maxWaitMs = max(stats.maxWaitMs, waitMs);
+}
 
-  for (uint16_t block = 0; block < C; block++)
+void finishJob(EncodeJob &job, JobStatus status, const uint8_t *encoded)
+{
+  job.done = true;
+  classStats[job.jobClass].depth--;
+  if (job.jobClass == JOB_CLASS_LATENCY)
+    lastLatencyAt = millis();
+  responsePort = producers[job.producer].port;
+  if (status != JOB_OK)
   {
-    Serial.printf("Sending block %d/%d...\n", block + 1, C);
+    sendAck(RESP_ENCODE, job.seq, status);
+    return;
+  }
 
-    // Send K_bytes for this block
-    for (uint16_t i = 0; i < K_bytes; i++)
-    {
-      uint16_t dataIndex = block * K_bytes + i;
-      uint8_t byteToSend = (dataIndex < (messageBits + 7) / 8) ? data[dataIndex] : 0;
-      Serial2.write(byteToSend);
-      delay(10); // Delay to not overwhelm the MCU
-    }
+  sendResult(job.seq, historyAdd(job.mode, K, N, job.messageBits, job.calculationBits, jobArena + job.offset, encoded));
+}
 
-    // Wait for encoded data
-    uint16_t N_bytes = (N + 7) / 8;
-    Serial.printf("Waiting for %d encoded bytes...\n", N_bytes);
+// Runs one link transaction for the jobs in batch and answers each of them
+void runBatch(const uint8_t *batch, uint8_t count, uint16_t k, uint16_t n)
+{
+  uint16_t calculationBits;
 
-    unsigned long startTime = millis();
-    uint16_t receivedBytes = 0;
+  for (uint8_t i = 0; i < count; i++)
+    startJob(jobQueue[batch[i]]);
 
-    while (receivedBytes < N_bytes && (millis() - startTime < 3000))
+  if (count == 1)
+  {
+    EncodeJob &job = jobQueue[batch[0]];
+    memcpy(message_buffer, jobArena + job.offset, (job.messageBits + 7) / 8);
+    message_bits = job.messageBits;
+    calculationBits = job.calculationBits;
+  }
+  else
+  {
+    // Each job starts on a block boundary, zero-padded to its last block
+    uint16_t kBytes = LDPC_BYTES(k);
+    uint16_t totalBlocks = 0;
+    for (uint8_t i = 0; i < count; i++)
     {
-      if (Serial2.available())
-      {
-        encoded_buffer[block * N_bytes + receivedBytes] = Serial2.read();
-        receivedBytes++;
-      }
-      delay(1);
+      EncodeJob &job = jobQueue[batch[i]];
+      uint16_t blocks = (job.calculationBits + k - 1) / k;
+      uint16_t bytes = min((uint16_t)((job.messageBits + 7) / 8), (uint16_t)(blocks * kBytes));
+      uint8_t *start = message_buffer + job.firstBlock * kBytes;
+      memcpy(start, jobArena + job.offset, bytes);
+      memset(start + bytes, 0, blocks * kBytes - bytes);
+      totalBlocks = job.firstBlock + blocks;
     }
+    message_bits = totalBlocks * kBytes * 8;
+    calculationBits = totalBlocks * k;
+    LOG_PRINTF("Batching %d jobs into %d blocks\n", count, totalBlocks);
+  }
+
+  JobStatus status =
+      runEncodingJob(message_buffer, message_bits, calculationBits, encoded_buffer, sizeof(encoded_buffer));
+  jobBatches++;
 
-    if (receivedBytes < N_bytes)
+  if (count > 1 && status == JOB_OK && (K != k || N != n))
+  {
+    // The MCU picks its code by length: no more batches, run the jobs one by one
+    LOG_PRINTF("Batch answered with K=%d, N=%d instead of K=%d, N=%d\n", K, N, k, n);
+    batchRefused = true;
+    for (uint8_t i = 0; i < count; i++)
     {
-      Serial.printf("Timeout receiving encoded data for block %d\n", block + 1);
-      return false;
+      jobQueue[batch[i]].firstBlock = 0;
+      runBatch(batch + i, 1, 0, 0);
     }
-
-    Serial.printf("Received %d encoded bytes for block %d\n", receivedBytes, block + 1);
+    return;
   }
 
-  return true;
+  uint16_t nBytes = (N + 7) / 8;
+  for (uint8_t i = 0; i < count; i++)
+    finishJob(jobQueue[batch[i]], status, encoded_buffer + jobQueue[batch[i]].firstBlock * nBytes);
 }
 
-uint16_t textToBits(const String &text, uint8_t *buffer)
+// Runs the next slice of a long bulk job straight from the arena into sliceOutput
+void runSlice(EncodeJob &job, uint16_t k, uint16_t n)
 {
-  uint16_t byteCount = min((uint16_t)text.length(), (uint16_t)(MAX_MESSAGE_LENGTH - 1));
-  for (uint16_t i = 0; i < byteCount; i++)
+  uint16_t kBytes = LDPC_BYTES(k);
+  uint16_t blocks = (job.calculationBits + k - 1) / k;
+  uint16_t count = min((uint16_t)(blocks - job.doneBlocks), (uint16_t)JOB_SLICE_BLOCKS);
+  if (effectiveClass(job) == JOB_CLASS_LATENCY || !latencyTraffic())
+    count = blocks - job.doneBlocks; // Aged, or nothing to make way for: finish in one go
+
+  // The slice starts on a block boundary; the last one ends at the job's length
+  uint32_t skippedBytes = (uint32_t)job.doneBlocks * kBytes;
+  uint32_t messageBytes = (job.messageBits + 7) / 8;
+  uint16_t messageBits = (messageBytes > skippedBytes) ? (uint16_t)(job.messageBits - skippedBytes * 8) : 0;
+  uint16_t sliceBits = (job.doneBlocks + count == blocks) ? job.calculationBits - job.doneBlocks * k : count * k;
+
+  startJob(job);
+  LOG_PRINTF("Job %d: blocks %d-%d of %d\n", job.seq, job.doneBlocks + 1, job.doneBlocks + count, blocks);
+  uint32_t outputOffset = (uint32_t)job.doneBlocks * LDPC_BYTES(n);
+  JobStatus status = runEncodingJob(jobArena + job.offset + (messageBits > 0 ? skippedBytes : 0), messageBits,
+                                    sliceBits, sliceOutput + outputOffset, sizeof(sliceOutput) - outputOffset);
+  jobBatches++;
+
+  if (status == JOB_OK && (K != k || N != n))
   {
-    buffer[i] = (uint8_t)text.charAt(i);
+    // The MCU picks its code by length: start over with the job in one piece
+    LOG_PRINTF("Slice answered with K=%d, N=%d instead of K=%d, N=%d\n", K, N, k, n);
+    sliceRefused = true;
+    job.doneBlocks = 0;
+    return;
   }
-  return byteCount * 8; // Convert bytes to bits
+
+  if (status != JOB_OK)
+  {
+    finishJob(job, status, NULL);
+    return;
+  }
+
+  job.doneBlocks += count;
+  if (job.doneBlocks == blocks)
+    finishJob(job, JOB_OK, sliceOutput);
 }
 
-uint16_t hexToBits(const String &hexStr, uint8_t *buffer)
+// Drops finished jobs and compacts the arena behind the remaining ones
+void compactJobQueue()
 {
-  String cleanHex = hexStr;
-  cleanHex.replace(" ", "");
-  cleanHex.replace("\n", "");
-  cleanHex.replace("\r", "");
-  cleanHex.toUpperCase();
+  uint8_t kept = 0;
+  uint16_t used = 0;
 
-  uint16_t byteCount = 0;
-  for (uint16_t i = 0; i < cleanHex.length() && i + 1 < cleanHex.length() && byteCount < MAX_MESSAGE_LENGTH; i += 2)
+  for (uint8_t i = 0; i < jobCount; i++)
   {
-    String hexByte = cleanHex.substring(i, i + 2);
-    buffer[byteCount] = (uint8_t)strtol(hexByte.c_str(), NULL, 16);
-    byteCount++;
+    EncodeJob &job = jobQueue[i];
+    if (job.done)
+      continue;
+
+    uint16_t bytes = (job.messageBits + 7) / 8;
+    memmove(jobArena + used, jobArena + job.offset, bytes);
+    job.offset = used;
+    used += bytes;
+    jobQueue[kept++] = job;
   }
-  return byteCount * 8; // Convert bytes to bits
+  jobCount = kept;
+  jobArenaUsed = used;
 }
 
-void handleEncoding(InputMode mode)
+// Runs queued encode requests until the queue is empty, one transaction at a
+// time, taking in new requests between (and during) transactions
+void runJobQueue()
 {
-  uint16_t manual_message_bits;
+  uint8_t batch[JOB_QUEUE_SIZE];
+  bool slicing = false; // The last transaction left a sliced job part done
 
-  lastInputMode = mode; // Store the input mode for later reference
-
-  if (mode == INPUT_HEX_MANUAL)
+  while (jobCount > 0)
   {
-    Serial.println("Enter message length: ");
+    uint8_t head = nextJob();
+    EncodeJob &job = jobQueue[head];
+    uint16_t k = 0;
+    uint16_t n = 0;
+    bool cached = lookupParameters(job.calculationBits, k, n);
+
+    if (slicing && job.doneBlocks == 0)
+      preemptions++;
 
-    // Wait for user input
-    while (!Serial.available())
+    if (cached && sliceable(job, k, n))
+    {
+      runSlice(job, k, n);
+      slicing = !job.done && job.doneBlocks > 0;
+    }
+    else
     {
-      delay(100);
+      uint8_t count = collectBatch(head, batch, cached ? k : 0, cached ? n : 0);
+      runBatch(batch, count, k, n);
+      slicing = false;
     }
 
-    String lengthInput = Serial.readStringUntil('\n');
-    lengthInput.trim();
-    manual_message_bits = lengthInput.toInt();
-    Serial.printf("Manual message length set to: %d bits\n", manual_message_bits);
+    compactJobQueue();
+    ingestCommands();
   }
+}
 
-  Serial.println("Enter your message:");
-  if (mode == INPUT_TEXT)
-  {
-    Serial.println("(Type your text message and press Enter)");
-  }
-  else
-  {
-    Serial.println("(Enter hex bytes, e.g., 'AB CD EF 12' and press Enter)");
-  }
+void commandStatus(uint8_t seq)
+{
+  responseBuffer[0] = seq;
+  responseBuffer[1] = JOB_OK;
+  responseBuffer[2] = (uint8_t)currentState;
+  putUint16(responseBuffer + 3, K);
+  putUint16(responseBuffer + 5, N);
+  putUint16(responseBuffer + 7, historyCount() ? historyAt(0)->messageBits : 0);
+#ifdef USE_TAG
+  responseBuffer[9] = links[0].tagReceived ? 1 : 0;
+#else
+  responseBuffer[9] = 0xFF; // Tag mode disabled
+#endif
+  responseBuffer[10] = (uint8_t)outputFormat;
+  putUint16(responseBuffer + 11, (uint16_t)min(decodedBlocksPerSecond(), 65535.0f));
+  putUint16(responseBuffer + 13, (uint16_t)min(decoderIterationsPerBlock() * 10, 65535.0f));
+  sendResponse(RESP_STATUS, 15);
+}
+
+void putUint32(uint8_t *dst, uint32_t value)
+{
+  putUint16(dst, (uint16_t)(value >> 16));
+  putUint16(dst + 2, (uint16_t)(value & 0xFFFF));
+}
+
+// Phase latency summaries; no phases when the instrumentation is compiled out
+void commandTiming(uint8_t seq, bool reset)
+{
+  uint8_t phases = 0;
+#ifdef PHASE_TIMING
+  phases = PHASE_COUNT;
+#endif
 
-  // Wait for user input
-  while (!Serial.available())
+  responseBuffer[0] = seq;
+  responseBuffer[1] = JOB_OK;
+  responseBuffer[2] = phases;
+  for (uint8_t i = 0; i < phases; i++)
   {
-    delay(100);
+    PhaseSummary summary;
+    phaseSummary((Phase)i, summary);
+    uint8_t *dst = responseBuffer + 3 + i * 16;
+    putUint32(dst, summary.count);
+    putUint32(dst + 4, summary.p50);
+    putUint32(dst + 8, summary.p99);
+    putUint32(dst + 12, summary.max);
   }
+  sendResponse(RESP_TIMING, 3 + phases * 16);
 
-  String userInput = Serial.readStringUntil('\n');
-  userInput.trim();
+  if (reset)
+    phaseReset();
+}
 
-  if (userInput.length() == 0)
+void commandDecode(uint8_t seq, const uint8_t *payload, uint16_t length)
+{
+  uint16_t k = (length >= 5) ? ((uint16_t)payload[1] << 8) | payload[2] : 0;
+  uint16_t n = (length >= 5) ? ((uint16_t)payload[3] << 8) | payload[4] : 0;
+  if (length < 5 || length - 5 != n || !prepareDecoder(k, n))
   {
-    Serial.println("No message entered!");
+    sendAck(RESP_ERROR, seq, JOB_ERR_INPUT);
     return;
   }
 
-  Serial.println("Message entered: " + userInput);
+  uint8_t iterations;
+  bool ok = decodeBlock((const int8_t *)payload + 5, NULL, responseBuffer + 3, iterations);
+  responseBuffer[0] = seq;
+  responseBuffer[1] = ok ? JOB_OK : JOB_ERR_DECODE;
+  responseBuffer[2] = iterations;
+  sendResponse(RESP_DECODE, 3 + LDPC_BYTES(k));
+}
 
-  // Convert input to bits
-  if (mode == INPUT_TEXT)
-  {
-    message_bits = textToBits(userInput, message_buffer);
-  }
-  else
+void dispatchCommand(CommandProducer &producer)
+{
+  uint8_t type = producer.parser.type;
+  uint16_t length = producer.parser.length;
+  const uint8_t *payload = producer.payload;
+  uint8_t seq = (length > 0) ? payload[0] : 0;
+
+  responsePort = producer.port;
+
+  switch (type)
   {
-    message_bits = hexToBits(userInput, message_buffer);
+  case CMD_STATUS:
+    commandStatus(seq);
+    break;
+  case CMD_DECODE:
+    commandDecode(seq, payload, length);
+    break;
+  case CMD_TIMING:
+    commandTiming(seq, length >= 2 && payload[1] == 1);
+    break;
+  case CMD_LAST_RESULT:
+    sendResult(seq, historyAt(0));
+    break;
+  case CMD_GET_RESULT:
+    if (length >= 3)
+      sendResult(seq, historyFind(((uint16_t)payload[1] << 8) | payload[2]));
+    else
+      sendAck(RESP_ERROR, seq, JOB_ERR_INPUT);
+    break;
+  case CMD_RESET_TAG:
+    resetLinkTags();
+    sendAck(RESP_ACK, seq, JOB_OK);
+    break;
+  case CMD_EXIT:
+    sendAck(RESP_ACK, seq, JOB_OK);
+    if (&producer != &producers[0])
+      break; // Only the console has a menu to go back to
+    commandMode = false;
+    consoleVerbose = true;
+    Serial.println();
+    printMenu();
+    break;
+  default:
+    responseBuffer[0] = seq;
+    responseBuffer[1] = JOB_ERR_COMMAND;
+    responseBuffer[2] = type;
+    sendResponse(RESP_ERROR, 3);
+    break;
   }
+}
 
-  Serial.printf("Message converted to %d bits (%d bytes)\n", message_bits, (message_bits + 7) / 8);
+// Command frames are taken from the console only in command mode
+bool producerActive(const CommandProducer &producer)
+{
+  return &producer != &producers[0] || commandMode;
+}
 
-  // Start LDPC encoding process
-  Serial.println("\nStarting LDPC encoding process...");
+// Reads a producer's buffered bytes, without blocking, up to the end of the
+// next frame. Encode requests are queued right away; reading stops at any
+// other frame (left pending until the queue ahead of it has run) or when the
+// queue has no room. Returns true if a frame was completed.
+bool ingestFrame(uint8_t index)
+{
+  CommandProducer &producer = producers[index];
 
-  if (!waitForTag())
+  while (producerActive(producer) && !producer.pendingFrame && jobQueueHasRoom() && producer.port->available())
   {
-    Serial.println("Failed to receive tag from microcontroller!");
-    return;
-  }
+    FrameEvent event = frameParserPush(producer.parser, (uint8_t)producer.port->read());
 
-  if (mode == INPUT_HEX_MANUAL)
-  {
-    if (!sendMessageLength(manual_message_bits))
+    if (event == FRAME_READY)
     {
-      Serial.println("Failed to send message length!");
-      return;
+      producer.frames++;
+      if (producer.parser.type == CMD_ENCODE)
+        queueEncode(index, (producer.parser.length > 0) ? producer.payload[0] : 0, producer.payload,
+                    producer.parser.length);
+      else
+        producer.pendingFrame = true;
+      return true;
     }
-  }
-  else
-  {
-    if (!sendMessageLength(message_bits))
+    else if (event != FRAME_NONE)
     {
-      Serial.println("Failed to send message length!");
-      return;
+      producer.badFrames++;
+      responsePort = producer.port;
+      responseBuffer[0] = 0;
+      responseBuffer[1] = JOB_ERR_FRAME;
+      responseBuffer[2] = producer.parser.type;
+      sendResponse(RESP_ERROR, 3);
     }
   }
+  return false;
+}
 
-  if (!receiveParameters())
+// Takes frames from every producer in turn, one frame each per round
+void ingestCommands()
+{
+  bool progress = true;
+  while (progress)
   {
-    Serial.println("Failed to receive LDPC parameters!");
-    return;
+    progress = false;
+    for (uint8_t i = 0; i < PRODUCER_COUNT; i++)
+    {
+      if (ingestFrame(i))
+        progress = true;
+    }
   }
+}
 
-  uint16_t bitsUsedForCalculation = (mode == INPUT_HEX_MANUAL) ? manual_message_bits : message_bits;
-
-  if (!sendMessageData(message_buffer, message_bits, (mode == INPUT_HEX_MANUAL) ? manual_message_bits : 0))
+// Processes every command frame buffered on the producers. Other commands see
+// the results of the encode requests queued before them.
+void pollCommands()
+{
+  while (true)
   {
-    Serial.println("Failed to send message data!");
-    return;
+    ingestCommands();
+    if (jobCount > 0)
+      runJobQueue();
+
+    bool busy = false;
+    for (uint8_t i = 0; i < PRODUCER_COUNT; i++)
+    {
+      CommandProducer &producer = producers[i];
+      if (producer.pendingFrame)
+      {
+        producer.pendingFrame = false;
+        dispatchCommand(producer);
+        busy = true;
+      }
+      else if (producerActive(producer) && producer.port->available())
+      {
+        busy = true;
+      }
+    }
+    if (!busy)
+      return;
   }
+}
 
-  Serial.println("\nEncoding completed successfully!");
-  Serial.println("=================================");
-  Serial.printf("Original message (%d bits, %d bits used for calculation):\n", message_bits, bitsUsedForCalculation);
-  printBytes(message_buffer, (message_bits + 7) / 8, mode != INPUT_TEXT); // Display as ASCII for text input, display as hex for hex input
-  Serial.printf("\nEncoded data (%d bits per block, %d blocks):\n", N, (bitsUsedForCalculation + K - 1) / K);
-  uint16_t totalEncodedBytes = ((bitsUsedForCalculation + K - 1) / K) * ((N + 7) / 8);
-  printBytes(encoded_buffer, totalEncodedBytes, true);
-  Serial.println();
+void beginProducer(CommandProducer &producer, const char *name, HardwareSerial &port)
+{
+  producer.name = name;
+  producer.port = &port;
+  frameParserInit(producer.parser, producer.payload, sizeof(producer.payload));
 }
 
 void setup()
 {
   // Initialize USB Serial (for user interface)
+  Serial.setRxBufferSize(SERIAL_RX_BUFFER);
   Serial.begin(SERIAL_BAUD);
 
-  // Initialize UART2 for microcontroller communication
-  Serial2.begin(UART2_BAUD, SERIAL_8N1, UART2_RX_PIN, UART2_TX_PIN);
+  // Initialize UART2 (and UART1) for microcontroller communication
+  beginLink(links[0], "UART2", Serial2, UART2_BAUD, UART2_RX_PIN, UART2_TX_PIN);
+#ifdef USE_UART1_LINK
+  beginLink(links[1], "UART1", Serial1, UART1_BAUD, UART1_RX_PIN, UART1_TX_PIN);
+#endif
+#ifdef USE_UART1_HOST
+  Serial1.setRxBufferSize(SERIAL_RX_BUFFER);
+  Serial1.begin(UART1_HOST_BAUD, SERIAL_8N1, UART1_RX_PIN, UART1_TX_PIN);
+#endif
 
   // Wait for USB Serial to be ready
   while (!Serial)
@@ -398,23 +2506,57 @@ void setup()
   Serial.println("==================================");
   Serial.println("Configuration:");
   Serial.printf("USB Serial: %d baud\n", SERIAL_BAUD);
-  Serial.printf("UART2: %d baud, RX=GPIO%d, TX=GPIO%d\n", UART2_BAUD, UART2_RX_PIN, UART2_TX_PIN);
+  for (uint8_t i = 0; i < LINK_COUNT; i++)
+    Serial.printf("%s: %lu baud, RX=GPIO%d, TX=GPIO%d\n", links[i].name, (unsigned long)links[i].baud, links[i].rxPin,
+                  links[i].txPin);
+#ifdef USE_UART1_HOST
+  Serial.printf("UART1 host: %d baud, RX=GPIO%d, TX=GPIO%d\n", UART1_HOST_BAUD, UART1_RX_PIN, UART1_TX_PIN);
+#endif
 #ifdef USE_TAG
   Serial.println("Tag mode: ENABLED (will wait for 0xdeadc0de tag once)");
 #else
   Serial.println("Tag mode: DISABLED (no tag required)");
 #endif
+
+  if (codeStore.map(LDPC_STORE_PARTITION))
+    Serial.printf("Code tables: %u entries in flash, %u 5G NR base graphs\n", codeStore.entryCount(),
+                  codeStore.registerNrGraphs());
+  else
+    Serial.println("Code tables: no " LDPC_STORE_PARTITION " partition image");
   Serial.println();
 
+  if (!parallelEncodeBegin())
+    Serial.println("Local encoding: single core");
+  verifierBegin(checkQueuedBlock);
+
+  beginProducer(producers[0], "USB", Serial);
+#ifdef USE_UART1_HOST
+  beginProducer(producers[1], "UART1", Serial1);
+#endif
   printMenu();
 }
 
 void loop()
 {
+  // Hosts on other ports are served while the console shows the menu
+  pollCommands();
+  if (commandMode)
+    return;
+
   if (Serial.available())
   {
     char choice = Serial.read();
 
+    if ((uint8_t)choice == FRAME_SYNC_0)
+    {
+      // Start of a command frame: switch to command mode and keep the rest of the input
+      commandMode = true;
+      consoleVerbose = false;
+      frameParserReset(producers[0].parser);
+      frameParserPush(producers[0].parser, FRAME_SYNC_0);
+      return;
+    }
+
     // Clear any remaining characters in buffer
     while (Serial.available())
     {
@@ -441,35 +2583,98 @@ void loop()
       Serial.println("System Status:");
       Serial.printf("Current state: %d\n", currentState);
       Serial.printf("Last K: %d, Last N: %d\n", K, N);
-      Serial.printf("Last message bits: %d\n", message_bits);
-#ifdef USE_TAG
-      Serial.printf("Tag received: %s\n", tagReceived ? "YES" : "NO");
-#else
-      Serial.println("Tag mode: DISABLED");
-#endif
-      break;
-    case '5':
-      if (K > 0 && N > 0 && message_bits > 0)
+      Serial.printf("Last message bits: %d\n", historyCount() ? historyAt(0)->messageBits : 0);
+      Serial.printf("Result history: %u results kept, %lu evicted\n", historyCount(),
+                    (unsigned long)historyEvictions());
+      Serial.printf("Local encoding: %s, local code for last K/N: %s\n", localEncoding ? "ON" : "OFF",
+                    localCodeName(K, N));
+      Serial.printf("Parity check: %lu blocks, %lu failed, %lu bit-flipped, %lu re-encoded, %lu us per block\n",
+                    (unsigned long)checkedBlocks, (unsigned long)failedBlocks, (unsigned long)flippedBlocks,
+                    (unsigned long)repairedBlocks,
+                    checkedBlocks ? (unsigned long)(checkMicros / checkedBlocks) : 0UL);
+      Serial.printf("Job queue: %lu transactions, %lu preemptions%s%s\n", (unsigned long)jobBatches,
+                    (unsigned long)preemptions, batchRefused ? ", batching refused by the MCU" : "",
+                    sliceRefused ? ", slicing refused by the MCU" : "");
+      for (uint8_t i = 0; i < JOB_CLASSES; i++)
       {
-        Serial.println("Last encoding results:");
-        Serial.printf("K=%d, N=%d, Message bits=%d\n", K, N, message_bits);
-        Serial.println("Original message:");
-        printBytes(message_buffer, (message_bits + 7) / 8, lastInputMode == INPUT_HEX); // Display as ASCII for text input, display as hex for hex input
-        Serial.println("Encoded data:");
-        uint16_t totalEncodedBytes = ((message_bits + K - 1) / K) * ((N + 7) / 8);
-        printBytes(encoded_buffer, totalEncodedBytes, true);
+        const JobClassStats &stats = classStats[i];
+        Serial.printf("  %s jobs: %lu, %u queued (max %u), wait avg %lu ms, max %lu ms\n",
+                      i == JOB_CLASS_LATENCY ? "Latency" : "Bulk", (unsigned long)stats.jobs, stats.depth,
+                      stats.maxDepth, stats.jobs ? (unsigned long)(stats.totalWaitMs / stats.jobs) : 0UL,
+                      (unsigned long)stats.maxWaitMs);
       }
-      else
+      Serial.printf("Block checking: %s, most blocks queued %u\n",
+                    concurrentCheck ? "concurrent on the second core" : "inline", verifierMaxDepth());
+      Serial.printf("Decoder: %lu blocks, %lu failed, %.2f iterations/block, %.1f blocks/s\n",
+                    (unsigned long)decodedBlocks, (unsigned long)decodeFailures, decoderIterationsPerBlock(),
+                    decodedBlocksPerSecond());
+#ifdef PHASE_TIMING
+      for (uint8_t i = 0; i < PHASE_COUNT; i++)
+      {
+        PhaseSummary summary;
+        phaseSummary((Phase)i, summary);
+        Serial.printf("%s: %lu times, p50 %lu us, p99 %lu us, max %lu us\n", phaseName((Phase)i),
+                      (unsigned long)summary.count, (unsigned long)summary.p50, (unsigned long)summary.p99,
+                      (unsigned long)summary.max);
+      }
+#endif
+#ifndef USE_TAG
+      Serial.println("Tag mode: DISABLED");
+#endif
+      for (uint8_t i = 0; i < LINK_COUNT; i++)
       {
-        Serial.println("No encoding results available yet.");
+        pollTag(links[i]);
+        Serial.printf("%s link: tag %s%s, queue depth %d, %lu blocks, %lu timeouts\n", links[i].name,
+                      links[i].tagReceived ? "YES" : "NO", links[i].mismatched ? " (not striped)" : "",
+                      links[i].queueDepth, (unsigned long)links[i].blocks, (unsigned long)links[i].timeouts);
       }
+      for (uint8_t i = 0; i < PRODUCER_COUNT; i++)
+        Serial.printf("%s commands: %lu frames, %lu bad\n", producers[i].name, (unsigned long)producers[i].frames,
+                      (unsigned long)producers[i].badFrames);
+      break;
+    case '5':
+      showResults();
       break;
 #ifdef USE_TAG
     case '6':
-      tagReceived = false;
+      resetLinkTags();
       Serial.println("Tag state reset. Next encoding will wait for tag.");
       break;
 #endif
+    case '7':
+      handleOutputFormat();
+      break;
+    case '8':
+      Serial.println("Base64 encoding mode selected");
+      handleEncoding(INPUT_BASE64);
+      break;
+    case '9':
+      Serial.println("Raw binary encoding mode selected");
+      handleEncoding(INPUT_BINARY);
+      break;
+    case 'b':
+      runEncoderBenchmark(Serial);
+      break;
+    case 'd':
+      runLoopbackDecode();
+      break;
+    case 'l':
+      localEncoding = !localEncoding;
+      Serial.printf("Local encoding %s\n", localEncoding ? "enabled" : "disabled");
+      break;
+    case 't':
+      phaseReset();
+      Serial.println("Phase timing reset");
+      break;
+    case 'v':
+      if (!verifierReady())
+      {
+        Serial.println("Concurrent checking needs a second core");
+        break;
+      }
+      concurrentCheck = !concurrentCheck;
+      Serial.printf("Concurrent block checking %s\n", concurrentCheck ? "enabled" : "disabled");
+      break;
     default:
       Serial.println("Invalid choice!");
       break;
@@ -0,0 +1,87 @@
+#include "parallel_encode.h"
+
+#include <Arduino.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/semphr.h>
+#include <freertos/task.h>
+
+// The worker's share of the current call, written by the caller before the
+// start notification and read by the worker after it
+struct ParallelShare
+{
+  const LdpcEncoder *encoder;
+  const uint8_t *message;
+  uint16_t messageBits;
+  uint16_t blocks;
+  uint8_t *out;
+};
+
+static TaskHandle_t workerTask = NULL;
+static SemaphoreHandle_t workerDone = NULL;
+static ParallelShare share;
+
+static void encodeWorker(void *)
+{
+  for (;;)
+  {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    ldpcEncodeBlocks(*share.encoder, share.message, share.messageBits, share.blocks, share.out);
+    xSemaphoreGive(workerDone);
+  }
+}
+
+bool parallelEncodeBegin()
+{
+#if portNUM_PROCESSORS > 1
+  if (workerTask != NULL)
+    return true;
+
+  workerDone = xSemaphoreCreateBinary();
+  if (workerDone == NULL)
+    return false;
+
+  BaseType_t otherCore = (xPortGetCoreID() == 0) ? 1 : 0;
+  if (xTaskCreatePinnedToCore(encodeWorker, "ldpc_encode", PARALLEL_TASK_STACK, NULL, uxTaskPriorityGet(NULL),
+                              &workerTask, otherCore) != pdPASS)
+  {
+    vSemaphoreDelete(workerDone);
+    workerDone = NULL;
+    workerTask = NULL;
+    return false;
+  }
+  return true;
+#else
+  return false;
+#endif
+}
+
+uint8_t parallelEncodeBlocks(const LdpcEncoder &encoder, const LdpcEncoder *worker, const uint8_t *message,
+                             uint16_t messageBits, uint16_t blocks, uint8_t *out)
+{
+  uint8_t lanes = encoder.batchLanes();
+
+  // Half the blocks each, rounded up to whole batches for the worker
+  uint16_t workerBlocks = (blocks / 2 + lanes - 1) / lanes * lanes;
+  if (workerTask == NULL || worker == NULL || blocks < PARALLEL_MIN_BLOCKS || workerBlocks >= blocks)
+  {
+    ldpcEncodeBlocks(encoder, message, messageBits, blocks, out);
+    return 1;
+  }
+
+  share.encoder = worker;
+  share.message = message;
+  share.messageBits = messageBits;
+  share.blocks = workerBlocks;
+  share.out = out;
+  xTaskNotifyGive(workerTask);
+
+  // The rest starts at a block boundary of the message and the output
+  uint32_t skippedBytes = (uint32_t)workerBlocks * LDPC_BYTES(encoder.K);
+  uint32_t messageBytes = LDPC_BYTES(messageBits);
+  uint16_t restBits = (messageBytes > skippedBytes) ? (uint16_t)(messageBits - skippedBytes * 8) : 0;
+  ldpcEncodeBlocks(encoder, (messageBytes > skippedBytes) ? message + skippedBytes : message, restBits,
+                   blocks - workerBlocks, out + (uint32_t)workerBlocks * LDPC_BYTES(encoder.N));
+
+  xSemaphoreTake(workerDone, portMAX_DELAY);
+  return 2;
+}
@@ -0,0 +1,109 @@
+#include "phase_timing.h"
+
+#include <string.h>
+
+#ifdef PHASE_TIMING
+#include <esp_timer.h>
+#endif
+
+static const char *const phaseNames[PHASE_COUNT] = {"Tag wait",  "Send length", "Receive K/N", "Block TX",
+                                                     "Block RX", "Input conversion", "Print"};
+
+const char *phaseName(Phase phase)
+{
+  return phaseNames[phase];
+}
+
+#ifdef PHASE_TIMING
+
+struct PhaseHistogram
+{
+  uint32_t buckets[PHASE_BUCKETS];
+  uint32_t count;
+  uint32_t max;
+};
+
+static PhaseHistogram histograms[PHASE_COUNT];
+
+uint32_t phaseNow()
+{
+  return (uint32_t)esp_timer_get_time(); // Differences stay right across the wrap
+}
+
+// Values below 1 << PHASE_SUB_BITS get a bucket each; above that the top
+// PHASE_SUB_BITS bits after the leading one pick one of the buckets of its
+// power of two
+static uint16_t bucketOf(uint32_t micros)
+{
+  if (micros < (1U << PHASE_SUB_BITS))
+    return micros;
+
+  uint8_t exponent = 31 - __builtin_clz(micros);
+  if (exponent >= PHASE_MAX_EXPONENT)
+    return PHASE_BUCKETS - 1;
+
+  uint8_t sub = (micros >> (exponent - PHASE_SUB_BITS)) & ((1U << PHASE_SUB_BITS) - 1);
+  return ((exponent - PHASE_SUB_BITS + 1) << PHASE_SUB_BITS) | sub;
+}
+
+// Largest value that falls in a bucket
+static uint32_t bucketLimit(uint16_t bucket)
+{
+  if (bucket < (1U << PHASE_SUB_BITS))
+    return bucket;
+
+  uint8_t exponent = (bucket >> PHASE_SUB_BITS) + PHASE_SUB_BITS - 1;
+  uint32_t sub = bucket & ((1U << PHASE_SUB_BITS) - 1);
+  uint32_t width = 1UL << (exponent - PHASE_SUB_BITS);
+  return (((1UL << PHASE_SUB_BITS) + sub) << (exponent - PHASE_SUB_BITS)) + width - 1;
+}
+
+void phaseRecord(Phase phase, uint32_t micros)
+{
+  PhaseHistogram &histogram = histograms[phase];
+  histogram.buckets[bucketOf(micros)]++;
+  histogram.count++;
+  if (micros > histogram.max)
+    histogram.max = micros;
+}
+
+// Smallest bucket limit with at least permille of the samples at or below it
+static uint32_t percentile(const PhaseHistogram &histogram, uint16_t permille)
+{
+  uint32_t rank = ((uint64_t)histogram.count * permille + 999) / 1000;
+  uint32_t seen = 0;
+  for (uint16_t bucket = 0; bucket < PHASE_BUCKETS; bucket++)
+  {
+    seen += histogram.buckets[bucket];
+    if (seen >= rank && bucket < PHASE_BUCKETS - 1) // The last bucket has no upper edge
+      return bucketLimit(bucket) < histogram.max ? bucketLimit(bucket) : histogram.max;
+  }
+  return histogram.max;
+}
+
+void phaseSummary(Phase phase, PhaseSummary &summary)
+{
+  const PhaseHistogram &histogram = histograms[phase];
+  summary.count = histogram.count;
+  summary.p50 = histogram.count ? percentile(histogram, 500) : 0;
+  summary.p99 = histogram.count ? percentile(histogram, 990) : 0;
+  summary.max = histogram.max;
+}
+
+void phaseReset()
+{
+  memset(histograms, 0, sizeof(histograms));
+}
+
+#else
+
+void phaseSummary(Phase, PhaseSummary &summary)
+{
+  memset(&summary, 0, sizeof(summary));
+}
+
+void phaseReset()
+{
+}
+
+#endif
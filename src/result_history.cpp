@@ -0,0 +1,113 @@
+#include "result_history.h"
+
+#include <string.h>
+
+static ResultRecord records[RESULT_HISTORY_SIZE];
+static uint8_t first = 0; // Oldest record
+static uint8_t count = 0;
+static uint16_t nextId = 1;
+static uint32_t evictions = 0;
+
+static uint8_t arena[RESULT_ARENA_BYTES];
+
+static ResultRecord &record(uint8_t index)
+{
+  return records[(first + index) % RESULT_HISTORY_SIZE];
+}
+
+static void evictOldest()
+{
+  first = (first + 1) % RESULT_HISTORY_SIZE;
+  count--;
+  evictions++;
+}
+
+// Arena offset for bytes after the newest record, or -1 while the oldest one is
+// in the way
+static int32_t place(uint16_t bytes)
+{
+  if (count == 0)
+    return 0;
+
+  const ResultRecord &oldest = record(0);
+  const ResultRecord &newest = record(count - 1);
+  uint32_t end = (uint32_t)newest.offset + newest.messageBytes + newest.encodedBytes;
+
+  if (newest.offset >= oldest.offset)
+  {
+    // Live bytes run from the oldest to the newest: free space is behind them
+    // and before the oldest
+    if (end + bytes <= sizeof(arena))
+      return end;
+    return (bytes <= oldest.offset) ? 0 : -1;
+  }
+
+  // Wrapped: the only gap is between the newest and the oldest
+  return (end + bytes <= oldest.offset) ? (int32_t)end : -1;
+}
+
+const ResultRecord *historyAdd(uint8_t mode, uint16_t K, uint16_t N, uint16_t messageBits, uint16_t calculationBits,
+                               const uint8_t *message, const uint8_t *encoded)
+{
+  uint16_t blocks = (K > 0) ? (calculationBits + K - 1) / K : 0;
+  uint16_t messageBytes = (messageBits + 7) / 8;
+  uint32_t encodedBytes = (uint32_t)blocks * ((N + 7) / 8);
+  if (messageBytes + encodedBytes > sizeof(arena))
+    return NULL;
+
+  if (count == RESULT_HISTORY_SIZE)
+    evictOldest();
+
+  int32_t offset;
+  while ((offset = place(messageBytes + encodedBytes)) < 0)
+    evictOldest();
+
+  ResultRecord &added = record(count++);
+  added.id = nextId++;
+  added.mode = mode;
+  added.K = K;
+  added.N = N;
+  added.messageBits = messageBits;
+  added.calculationBits = calculationBits;
+  added.blocks = blocks;
+  added.offset = (uint16_t)offset;
+  added.messageBytes = messageBytes;
+  added.encodedBytes = (uint16_t)encodedBytes;
+  memcpy(arena + offset, message, messageBytes);
+  memcpy(arena + offset + messageBytes, encoded, encodedBytes);
+  return &added;
+}
+
+const ResultRecord *historyFind(uint16_t id)
+{
+  if (count == 0)
+    return NULL;
+
+  uint16_t index = (uint16_t)(id - record(0).id); // IDs wrap along with the ring
+  return (index < count) ? &record(index) : NULL;
+}
+
+const ResultRecord *historyAt(uint8_t age)
+{
+  return (age < count) ? &record(count - 1 - age) : NULL;
+}
+
+uint8_t historyCount()
+{
+  return count;
+}
+
+uint32_t historyEvictions()
+{
+  return evictions;
+}
+
+const uint8_t *historyMessage(const ResultRecord &record)
+{
+  return arena + record.offset;
+}
+
+const uint8_t *historyEncoded(const ResultRecord &record)
+{
+  return arena + record.offset + record.messageBytes;
+}
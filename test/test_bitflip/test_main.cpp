@@ -0,0 +1,95 @@
+#include <string.h>
+#include <unity.h>
+
+#include "ldpc_bitflip.h"
+#include "ldpc_qc_codes.h"
+
+void setUp() {}
+void tearDown() {}
+
+static uint8_t info[LDPC_BYTES(LDPC_MAX_K)];
+static uint8_t codeword[LDPC_BYTES(LDPC_MAX_N)];
+static uint8_t sent[LDPC_BYTES(LDPC_MAX_N)];
+static uint32_t seed = 1;
+
+static void randomInfo(uint16_t K)
+{
+  memset(info, 0, sizeof(info));
+  for (uint16_t i = 0; i < LDPC_BYTES(K); i++)
+  {
+    seed = seed * 1103515245UL + 12345UL;
+    info[i] = (uint8_t)(seed >> 16);
+  }
+  if (K % 8)
+    info[K / 8] &= (uint8_t)(0xFF << (8 - K % 8));
+}
+
+// Built-in graph of a 5G NR family for the lifting set of Z
+static const QcBaseGraph *nrGraph(uint8_t family, uint16_t Z)
+{
+  for (size_t i = 0; i < qcBuiltinCount(); i++)
+  {
+    QcCodeMatch match;
+    uint16_t K, N;
+    if (qcBuiltinCode(i, match, K, N) && match.family == family && nrLiftingSet(match.Z) == nrLiftingSet(Z))
+      return match.graph;
+  }
+  return NULL;
+}
+
+// Encodes a block, flips each of the given transmitted bits in turn and repairs it
+static void checkRepair(const QcBaseGraph &graph, uint16_t Z, uint16_t K, uint16_t N, uint8_t punctured,
+                        const uint16_t *errors, size_t count)
+{
+  QcEncoder encoder;
+  QcBitFlipDecoder decoder;
+  TEST_ASSERT_TRUE(encoder.configure(graph, Z, K, N, punctured));
+  TEST_ASSERT_TRUE(decoder.configure(graph, Z, K, N, punctured));
+
+  randomInfo(K);
+  encoder.encodeBlock(info, sent);
+  TEST_ASSERT_TRUE(decoder.check(sent));
+
+  uint16_t flipped;
+  memcpy(codeword, sent, LDPC_BYTES(N));
+  TEST_ASSERT_TRUE(decoder.repair(codeword, flipped));
+  TEST_ASSERT_EQUAL(0, flipped);
+
+  for (size_t i = 0; i < count; i++)
+  {
+    memcpy(codeword, sent, LDPC_BYTES(N));
+    codeword[errors[i] / 8] ^= (uint8_t)(0x80 >> (errors[i] % 8));
+    TEST_ASSERT_FALSE(decoder.check(codeword));
+    TEST_ASSERT_TRUE(decoder.repair(codeword, flipped));
+    TEST_ASSERT_EQUAL(1, flipped);
+    TEST_ASSERT_EQUAL_MEMORY(sent, codeword, LDPC_BYTES(N));
+  }
+}
+
+void test_repair_80211n()
+{
+  QcCodeMatch match;
+  static const uint16_t errors[] = {0, 323, 324, 647};
+  TEST_ASSERT_TRUE(qcFindCode(324, 648, match));
+  checkRepair(*match.graph, match.Z, 324, 648, 0, errors, 4);
+}
+
+// BG2 at K = 192, Z = 32: information columns 6 to 9 are entirely filler, and
+// 7 and 9 take part in the checks left after puncturing (rows 26, 30, 33, 37
+// and 40). The errors sit in columns 2 and 10 (the first parity block), which
+// are in several of them.
+void test_repair_nr_whole_filler_columns()
+{
+  static const uint16_t errors[] = {0, 31, 128 + 5};
+  const QcBaseGraph *graph = nrGraph(QC_FAMILY_NR_BG2, 32);
+  TEST_ASSERT_NOT_NULL(graph);
+  checkRepair(*graph, 32, 192, 1472, 2, errors, 3);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_repair_80211n);
+  RUN_TEST(test_repair_nr_whole_filler_columns);
+  return UNITY_END();
+}
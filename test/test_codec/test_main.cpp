@@ -0,0 +1,83 @@
+#include <string.h>
+#include <unity.h>
+
+#include "codec.h"
+
+void setUp() {}
+void tearDown() {}
+
+static void checkEncode(const char *input, const char *expected)
+{
+  char out[64];
+  size_t length = base64Encode((const uint8_t *)input, strlen(input), out);
+  TEST_ASSERT_EQUAL(strlen(expected), length);
+  TEST_ASSERT_EQUAL(BASE64_ENCODED_LENGTH(strlen(input)), length);
+  TEST_ASSERT_EQUAL_MEMORY(expected, out, length);
+}
+
+static void checkDecode(const char *input, const char *expected)
+{
+  uint8_t out[64];
+  size_t length = base64Decode(input, strlen(input), out, sizeof(out));
+  TEST_ASSERT_EQUAL(strlen(expected), length);
+  TEST_ASSERT_EQUAL_MEMORY(expected, out, length);
+}
+
+// RFC 4648 section 10 test vectors
+void test_base64_encode_vectors()
+{
+  checkEncode("", "");
+  checkEncode("f", "Zg==");
+  checkEncode("fo", "Zm8=");
+  checkEncode("foo", "Zm9v");
+  checkEncode("foob", "Zm9vYg==");
+  checkEncode("fooba", "Zm9vYmE=");
+  checkEncode("foobar", "Zm9vYmFy");
+}
+
+void test_base64_decode_vectors()
+{
+  checkDecode("", "");
+  checkDecode("Zg==", "f");
+  checkDecode("Zm8=", "fo");
+  checkDecode("Zm9v", "foo");
+  checkDecode("Zm9vYg==", "foob");
+  checkDecode("Zm9vYmE=", "fooba");
+  checkDecode("Zm9vYmFy", "foobar");
+}
+
+void test_base64_round_trip_all_bytes()
+{
+  uint8_t input[256];
+  char encoded[BASE64_ENCODED_LENGTH(sizeof(input))];
+  uint8_t decoded[sizeof(input)];
+  for (size_t i = 0; i < sizeof(input); i++)
+    input[i] = (uint8_t)i;
+
+  for (size_t length = 0; length <= sizeof(input); length += 37)
+  {
+    size_t chars = base64Encode(input, length, encoded);
+    TEST_ASSERT_EQUAL(length, base64Decode(encoded, chars, decoded, sizeof(decoded)));
+    TEST_ASSERT_EQUAL_MEMORY(input, decoded, length);
+  }
+}
+
+void test_base64_rejects_malformed_input()
+{
+  uint8_t out[16];
+  TEST_ASSERT_EQUAL(BASE64_INVALID, base64Decode("Zm9", 3, out, sizeof(out)));       // Not a whole quad
+  TEST_ASSERT_EQUAL(BASE64_INVALID, base64Decode("Zm9v!A==", 8, out, sizeof(out)));  // Outside the alphabet
+  TEST_ASSERT_EQUAL(BASE64_INVALID, base64Decode("Zm 9v", 5, out, sizeof(out)));     // Whitespace
+  TEST_ASSERT_EQUAL(BASE64_INVALID, base64Decode("Zm9vYmFy", 8, out, 5));            // Does not fit
+  TEST_ASSERT_EQUAL(6, base64Decode("Zm9vYmFy", 8, out, 6));
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_base64_encode_vectors);
+  RUN_TEST(test_base64_decode_vectors);
+  RUN_TEST(test_base64_round_trip_all_bytes);
+  RUN_TEST(test_base64_rejects_malformed_input);
+  return UNITY_END();
+}
@@ -0,0 +1,164 @@
+#include <string.h>
+#include <unity.h>
+
+#include "codec.h"
+#include "frame.h"
+
+void setUp() {}
+void tearDown() {}
+
+static uint8_t payload[64];
+static FrameParser parser;
+
+// Builds a complete frame into dst and returns its length
+static size_t buildFrame(uint8_t *dst, uint8_t type, const uint8_t *data, uint16_t length)
+{
+  uint32_t crc = frameWriteHeader(dst, type, length);
+  memcpy(dst + FRAME_HEADER_LENGTH, data, length);
+  crc = crc32Update(crc, data, length);
+  frameWriteCrc(dst + FRAME_HEADER_LENGTH + length, crc);
+  return FRAME_HEADER_LENGTH + length + FRAME_CRC_LENGTH;
+}
+
+// Feeds bytes and returns the first event other than FRAME_NONE, or FRAME_NONE
+static FrameEvent pushAll(const uint8_t *bytes, size_t length, size_t &consumed)
+{
+  for (consumed = 0; consumed < length; consumed++)
+  {
+    FrameEvent event = frameParserPush(parser, bytes[consumed]);
+    if (event != FRAME_NONE)
+    {
+      consumed++;
+      return event;
+    }
+  }
+  return FRAME_NONE;
+}
+
+void test_crc32_check_value()
+{
+  const uint8_t text[] = "123456789";
+  TEST_ASSERT_EQUAL_HEX32(0xCBF43926UL, crc32Update(0, text, 9));
+  TEST_ASSERT_EQUAL_HEX32(0, crc32Update(0, text, 0));
+}
+
+void test_crc32_continues_across_buffers()
+{
+  const uint8_t text[] = "The quick brown fox jumps over the lazy dog";
+  size_t length = sizeof(text) - 1;
+  TEST_ASSERT_EQUAL_HEX32(0x414FA339UL, crc32Update(0, text, length));
+
+  for (size_t split = 0; split <= length; split++)
+    TEST_ASSERT_EQUAL_HEX32(0x414FA339UL, crc32Update(crc32Update(0, text, split), text + split, length - split));
+}
+
+void test_frame_round_trip()
+{
+  const uint8_t data[] = {0x01, 0xA5, 0x5A, 0xFF, 0x00, 0x42};
+  uint8_t frame[FRAME_HEADER_LENGTH + sizeof(data) + FRAME_CRC_LENGTH];
+  size_t length = buildFrame(frame, 0x12, data, sizeof(data));
+  TEST_ASSERT_EQUAL(sizeof(frame), length);
+  TEST_ASSERT_EQUAL_HEX8(FRAME_SYNC_0, frame[0]);
+  TEST_ASSERT_EQUAL_HEX8(FRAME_SYNC_1, frame[1]);
+
+  frameParserInit(parser, payload, sizeof(payload));
+  size_t consumed;
+  TEST_ASSERT_EQUAL(FRAME_READY, pushAll(frame, length, consumed));
+  TEST_ASSERT_EQUAL(length, consumed);
+  TEST_ASSERT_EQUAL_HEX8(0x12, parser.type);
+  TEST_ASSERT_EQUAL(sizeof(data), parser.length);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(data, parser.payload, sizeof(data));
+}
+
+void test_frame_empty_payload()
+{
+  uint8_t frame[FRAME_HEADER_LENGTH + FRAME_CRC_LENGTH];
+  size_t length = buildFrame(frame, 0x15, payload, 0);
+
+  frameParserInit(parser, payload, sizeof(payload));
+  size_t consumed;
+  TEST_ASSERT_EQUAL(FRAME_READY, pushAll(frame, length, consumed));
+  TEST_ASSERT_EQUAL(0, parser.length);
+}
+
+void test_frame_resyncs_after_noise()
+{
+  const uint8_t data[] = {'h', 'i'};
+  uint8_t stream[32];
+  size_t noise = 0;
+  stream[noise++] = 0x00;
+  stream[noise++] = FRAME_SYNC_0;
+  stream[noise++] = 0x33; // Broken sync
+  stream[noise++] = FRAME_SYNC_0;
+  stream[noise++] = FRAME_SYNC_0; // Repeated first sync byte still leads into a frame
+  size_t length = noise - 1 + buildFrame(stream + noise - 1, 0x20, data, sizeof(data));
+
+  frameParserInit(parser, payload, sizeof(payload));
+  size_t consumed;
+  TEST_ASSERT_EQUAL(FRAME_READY, pushAll(stream, length, consumed));
+  TEST_ASSERT_EQUAL(length, consumed);
+  TEST_ASSERT_EQUAL_HEX8(0x20, parser.type);
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(data, parser.payload, sizeof(data));
+}
+
+void test_frame_crc_error()
+{
+  const uint8_t data[] = {1, 2, 3, 4};
+  uint8_t frame[FRAME_HEADER_LENGTH + sizeof(data) + FRAME_CRC_LENGTH];
+  size_t length = buildFrame(frame, 0x11, data, sizeof(data));
+  frame[FRAME_HEADER_LENGTH + 2] ^= 0x10;
+
+  frameParserInit(parser, payload, sizeof(payload));
+  size_t consumed;
+  TEST_ASSERT_EQUAL(FRAME_ERROR_CRC, pushAll(frame, length, consumed));
+  TEST_ASSERT_EQUAL(length, consumed);
+
+  // The parser is ready for the next frame
+  frame[FRAME_HEADER_LENGTH + 2] ^= 0x10;
+  TEST_ASSERT_EQUAL(FRAME_READY, pushAll(frame, length, consumed));
+}
+
+void test_frame_length_over_capacity()
+{
+  uint8_t small[4];
+  const uint8_t data[] = {1, 2, 3, 4, 5};
+  uint8_t frame[FRAME_HEADER_LENGTH + sizeof(data) + FRAME_CRC_LENGTH];
+  size_t length = buildFrame(frame, 0x11, data, sizeof(data));
+
+  frameParserInit(parser, small, sizeof(small));
+  size_t consumed;
+  TEST_ASSERT_EQUAL(FRAME_ERROR_LENGTH, pushAll(frame, length, consumed));
+  TEST_ASSERT_EQUAL(FRAME_HEADER_LENGTH, consumed);
+
+  // The skipped payload is hunted through for sync, not written anywhere
+  TEST_ASSERT_EQUAL(FRAME_NONE, pushAll(frame + consumed, length - consumed, consumed));
+
+  const uint8_t fits[] = {9, 8, 7, 6};
+  length = buildFrame(frame, 0x13, fits, sizeof(fits));
+  TEST_ASSERT_EQUAL(FRAME_READY, pushAll(frame, length, consumed));
+  TEST_ASSERT_EQUAL_HEX8_ARRAY(fits, small, sizeof(fits));
+}
+
+void test_frame_write_crc_big_endian()
+{
+  uint8_t bytes[4];
+  frameWriteCrc(bytes, 0x01234567UL);
+  TEST_ASSERT_EQUAL_HEX8(0x01, bytes[0]);
+  TEST_ASSERT_EQUAL_HEX8(0x23, bytes[1]);
+  TEST_ASSERT_EQUAL_HEX8(0x45, bytes[2]);
+  TEST_ASSERT_EQUAL_HEX8(0x67, bytes[3]);
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_crc32_check_value);
+  RUN_TEST(test_crc32_continues_across_buffers);
+  RUN_TEST(test_frame_round_trip);
+  RUN_TEST(test_frame_empty_payload);
+  RUN_TEST(test_frame_resyncs_after_noise);
+  RUN_TEST(test_frame_crc_error);
+  RUN_TEST(test_frame_length_over_capacity);
+  RUN_TEST(test_frame_write_crc_big_endian);
+  return UNITY_END();
+}
@@ -0,0 +1,233 @@
+#include <stdio.h>
+#include <string.h>
+#include <unity.h>
+
+#include "ldpc_qc_codes.h"
+
+void setUp() {}
+void tearDown() {}
+
+static uint8_t info[LDPC_BYTES(LDPC_MAX_K)];
+static uint8_t codeword[LDPC_BYTES(LDPC_MAX_N)];
+static uint8_t mother[LDPC_BYTES(LDPC_MAX_N)];
+static uint32_t seed = 1;
+
+static void randomInfo(uint16_t K)
+{
+  memset(info, 0, sizeof(info));
+  for (uint16_t i = 0; i < LDPC_BYTES(K); i++)
+  {
+    seed = seed * 1103515245UL + 12345UL;
+    info[i] = (uint8_t)(seed >> 16);
+  }
+  if (K % 8)
+    info[K / 8] &= (uint8_t)(0xFF << (8 - K % 8));
+}
+
+static uint8_t bitAt(const uint8_t *bytes, uint32_t i)
+{
+  return (bytes[i >> 3] >> (7 - (i & 7))) & 1;
+}
+
+// Evaluates H * c bit by bit from the base graph, independently of the word-level
+// encoder and syndrome code, over every row whose columns all lie within the
+// first N bits of a full (unpunctured) codeword. Returns the rows checked, or -1
+// on a failed check.
+static int checkSyndrome(const QcBaseGraph &graph, uint16_t Z, uint32_t N, const uint8_t *bits)
+{
+  int rows = 0;
+  for (uint8_t r = 0; r < graph.rows; r++)
+  {
+    bool inside = true;
+    for (uint8_t c = 0; c < graph.cols && inside; c++)
+      inside = graph.shifts[r * graph.cols + c] < 0 || (uint32_t)(c + 1) * Z <= N;
+    if (!inside)
+      continue;
+
+    for (uint16_t z = 0; z < Z; z++)
+    {
+      uint8_t sum = 0;
+      for (uint8_t c = 0; c < graph.cols; c++)
+      {
+        int16_t s = graph.shifts[r * graph.cols + c];
+        if (s >= 0)
+          sum ^= bitAt(bits, (uint32_t)c * Z + (z + qcLiftShift(graph, s, Z)) % Z);
+      }
+      if (sum)
+        return -1;
+    }
+    rows++;
+  }
+  return rows;
+}
+
+// Encodes random blocks of the mother code at lifting size Z (all information
+// columns, no puncturing, as many parity columns as fit) and checks them
+static void checkLifting(const QcBaseGraph &graph, uint16_t Z)
+{
+  char message[64];
+  uint16_t K = (graph.cols - graph.rows) * Z;
+  uint32_t fullN = (uint32_t)graph.cols * Z;
+  uint16_t N = (fullN < LDPC_MAX_N) ? (uint16_t)fullN : LDPC_MAX_N;
+  snprintf(message, sizeof(message), "%s Z=%u", graph.name, Z);
+
+  QcEncoder encoder;
+  TEST_ASSERT_TRUE_MESSAGE(encoder.configure(graph, Z, K, N), message);
+
+  for (int block = 0; block < 2; block++)
+  {
+    randomInfo(K);
+    encoder.encodeBlock(info, codeword);
+    TEST_ASSERT_TRUE_MESSAGE(memcmp(info, codeword, K / 8) == 0, message);
+    int rows = checkSyndrome(graph, Z, N, codeword);
+    TEST_ASSERT_TRUE_MESSAGE(rows >= 4, message);
+
+    // A flipped bit must show
+    codeword[(K + Z) / 8] ^= 0x10;
+    TEST_ASSERT_TRUE_MESSAGE(checkSyndrome(graph, Z, N, codeword) < 0, message);
+  }
+}
+
+static void checkTable(size_t index, uint8_t family)
+{
+  QcCodeMatch match;
+  uint16_t K, N;
+  TEST_ASSERT_TRUE(qcBuiltinCode(index, match, K, N));
+  TEST_ASSERT_EQUAL(family, match.family);
+
+  if (family == QC_FAMILY_80211N)
+  {
+    checkLifting(*match.graph, match.Z);
+  }
+  else if (family == QC_FAMILY_80216E)
+  {
+    for (uint16_t Z = 24; Z <= 96; Z += 4)
+      checkLifting(*match.graph, Z);
+  }
+  else
+  {
+    int8_t liftingSet = nrLiftingSet(match.Z);
+    for (uint16_t Z = 2; Z <= NR_MAX_Z; Z++)
+    {
+      if (nrLiftingSet(Z) == liftingSet)
+        checkLifting(*match.graph, Z);
+    }
+  }
+}
+
+// Zero syndrome for every built-in table at every lifting size it is used at
+void test_builtin_tables_zero_syndrome()
+{
+  size_t counts[QC_FAMILY_COUNT] = {0};
+  for (size_t i = 0; i < qcBuiltinCount(); i++)
+  {
+    QcCodeMatch match;
+    uint16_t K, N;
+    TEST_ASSERT_TRUE(qcBuiltinCode(i, match, K, N));
+    counts[match.family]++;
+    checkTable(i, match.family);
+  }
+
+  TEST_ASSERT_EQUAL(12, counts[QC_FAMILY_80211N]); // 4 rates x 3 lengths
+  TEST_ASSERT_EQUAL(6, counts[QC_FAMILY_80216E]);  // 1/2, 2/3A, 2/3B, 3/4A, 3/4B, 5/6
+  TEST_ASSERT_EQUAL(NR_LIFTING_SETS, counts[QC_FAMILY_NR_BG1]);
+  TEST_ASSERT_EQUAL(NR_LIFTING_SETS, counts[QC_FAMILY_NR_BG2]);
+}
+
+// qcFindCode() reaches the new rates and families from the reported K/N
+void test_find_code()
+{
+  QcCodeMatch match;
+  TEST_ASSERT_TRUE(qcFindCode(540, 648, match));
+  TEST_ASSERT_EQUAL(QC_FAMILY_80211N, match.family);
+  TEST_ASSERT_EQUAL(4, match.graph->rows);
+
+  TEST_ASSERT_TRUE(qcFindCode(864, 1296, match));
+  TEST_ASSERT_EQUAL(8, match.graph->rows);
+
+  TEST_ASSERT_TRUE(qcFindCode(48 * 18, 48 * 24, match));
+  TEST_ASSERT_EQUAL(QC_FAMILY_80216E, match.family);
+  TEST_ASSERT_EQUAL(48, match.Z);
+  TEST_ASSERT_EQUAL(6, match.graph->rows);
+
+  TEST_ASSERT_TRUE(qcFindCode(500, 1500, match));
+  TEST_ASSERT_EQUAL(QC_FAMILY_NR_BG2, match.family);
+  TEST_ASSERT_EQUAL(64, match.Z);
+
+  TEST_ASSERT_TRUE(qcFindCode(6000, 9000, match));
+  TEST_ASSERT_EQUAL(QC_FAMILY_NR_BG1, match.family);
+  TEST_ASSERT_EQUAL(288, match.Z);
+}
+
+// BG2 sizes Z from Kb = 6, 8, 9 or 10 columns depending on K (TS 38.212
+// 5.2.2). K sits on either side of each threshold, at values where the
+// neighbouring Kb would give another Z.
+void test_nr_bg2_lifting_thresholds()
+{
+  static const uint16_t cases[][3] = {
+      {192, 6, 32},  // Kb = 8 would give 24
+      {193, 8, 26},  // Kb = 6 would give 36
+      {560, 8, 72},  // Kb = 9 would give 64
+      {561, 9, 64},  // Kb = 8 would give 72
+      {640, 9, 72},  // Kb = 10 would give 64
+      {650, 10, 72}, // Kb = 9 would give 80
+  };
+
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+  {
+    uint16_t K = cases[i][0];
+    TEST_ASSERT_EQUAL(cases[i][1], nrSizingColumns(QC_FAMILY_NR_BG2, K));
+
+    QcCodeMatch match;
+    TEST_ASSERT_TRUE(qcFindCode(K, 3 * K, match));
+    TEST_ASSERT_EQUAL(QC_FAMILY_NR_BG2, match.family);
+    TEST_ASSERT_EQUAL(cases[i][2], match.Z);
+    TEST_ASSERT_EQUAL(10, match.graph->cols - match.graph->rows);
+  }
+  TEST_ASSERT_EQUAL(22, nrSizingColumns(QC_FAMILY_NR_BG1, 100));
+}
+
+// A punctured, shortened 5G NR codeword is the mother codeword minus the
+// first two columns, with the filler bits zero
+void test_nr_punctured_matches_mother_code()
+{
+  static const uint16_t shapes[][2] = {{192, 600}, {500, 1500}, {1000, 1800}, {3000, 9000}, {6000, 9000}, {8448, 12000}};
+
+  for (size_t i = 0; i < sizeof(shapes) / sizeof(shapes[0]); i++)
+  {
+    uint16_t K = shapes[i][0];
+    uint16_t N = shapes[i][1];
+    QcCodeMatch match;
+    TEST_ASSERT_TRUE(qcFindCode(K, N, match));
+
+    QcEncoder punctured;
+    TEST_ASSERT_TRUE(punctured.configure(*match.graph, match.Z, K, N, match.punctured));
+    randomInfo(K);
+    punctured.encodeBlock(info, codeword);
+
+    // The mother code over the same bits plus zero filler
+    uint16_t Z = match.Z;
+    uint16_t infoBits = (match.graph->cols - match.graph->rows) * Z;
+    uint32_t transmitted = K - (uint32_t)match.punctured * Z;
+    uint32_t motherN = infoBits + (N - transmitted);
+    QcEncoder full;
+    TEST_ASSERT_TRUE(full.configure(*match.graph, Z, infoBits, motherN));
+    full.encodeBlock(info, mother);
+    TEST_ASSERT_TRUE(checkSyndrome(*match.graph, Z, motherN, mother) >= 4);
+
+    for (uint32_t b = 0; b < transmitted; b++)
+      TEST_ASSERT_EQUAL(bitAt(mother, (uint32_t)match.punctured * Z + b), bitAt(codeword, b));
+    for (uint32_t b = transmitted; b < N; b++)
+      TEST_ASSERT_EQUAL(bitAt(mother, (uint32_t)infoBits + (b - transmitted)), bitAt(codeword, b));
+  }
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_builtin_tables_zero_syndrome);
+  RUN_TEST(test_find_code);
+  RUN_TEST(test_nr_bg2_lifting_thresholds);
+  RUN_TEST(test_nr_punctured_matches_mother_code);
+  return UNITY_END();
+}
@@ -0,0 +1,99 @@
+#include <string.h>
+#include <unity.h>
+
+#include "result_history.h"
+
+void setUp() {}
+void tearDown() {}
+
+static uint8_t message[RESULT_ARENA_BYTES];
+static uint8_t encoded[RESULT_ARENA_BYTES];
+
+// Adds a result whose bytes are derived from seed, so they can be checked later
+static const ResultRecord *add(uint8_t seed, uint16_t K, uint16_t N, uint16_t messageBits)
+{
+  uint16_t blocks = (messageBits + K - 1) / K;
+  for (uint16_t i = 0; i < (messageBits + 7) / 8; i++)
+    message[i] = (uint8_t)(seed + i);
+  for (uint32_t i = 0; i < (uint32_t)blocks * ((N + 7) / 8); i++)
+    encoded[i] = (uint8_t)(seed ^ i);
+  return historyAdd(1, K, N, messageBits, messageBits, message, encoded);
+}
+
+static void checkBytes(const ResultRecord &record, uint8_t seed)
+{
+  const uint8_t *m = historyMessage(record);
+  const uint8_t *e = historyEncoded(record);
+  for (uint16_t i = 0; i < record.messageBytes; i++)
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)(seed + i), m[i]);
+  for (uint16_t i = 0; i < record.encodedBytes; i++)
+    TEST_ASSERT_EQUAL_HEX8((uint8_t)(seed ^ i), e[i]);
+}
+
+// The history is global, so the tests run in order against one instance
+void test_history_add_and_find()
+{
+  const ResultRecord *record = add(7, 324, 648, 1000);
+  TEST_ASSERT_NOT_NULL(record);
+  TEST_ASSERT_EQUAL(1, historyCount());
+  TEST_ASSERT_EQUAL(4, record->blocks);
+  TEST_ASSERT_EQUAL(125, record->messageBytes);
+  TEST_ASSERT_EQUAL(4 * 81, record->encodedBytes);
+  TEST_ASSERT_EQUAL_PTR(record, historyFind(record->id));
+  TEST_ASSERT_EQUAL_PTR(record, historyAt(0));
+  TEST_ASSERT_NULL(historyAt(1));
+  TEST_ASSERT_NULL(historyFind(record->id + 1));
+  checkBytes(*record, 7);
+}
+
+void test_history_ring_evicts_oldest()
+{
+  uint16_t firstId = historyAt(0)->id;
+  for (uint8_t i = 0; i < RESULT_HISTORY_SIZE; i++)
+    TEST_ASSERT_NOT_NULL(add(i, 324, 648, 324));
+
+  TEST_ASSERT_EQUAL(RESULT_HISTORY_SIZE, historyCount());
+  TEST_ASSERT_NULL(historyFind(firstId));
+  TEST_ASSERT_EQUAL(1, historyEvictions());
+
+  for (uint8_t age = 0; age < RESULT_HISTORY_SIZE; age++)
+  {
+    const ResultRecord *record = historyAt(age);
+    TEST_ASSERT_NOT_NULL(record);
+    TEST_ASSERT_EQUAL_PTR(record, historyFind(record->id));
+    checkBytes(*record, RESULT_HISTORY_SIZE - 1 - age);
+  }
+}
+
+void test_history_arena_wraps()
+{
+  // Results of about a third of the arena make room by evicting, and whatever
+  // is kept stays intact
+  uint16_t bits = (RESULT_ARENA_BYTES / 3) * 8 / 3;
+  for (uint8_t i = 0; i < 10; i++)
+  {
+    const ResultRecord *record = add(100 + i, 1000, 2000, bits);
+    TEST_ASSERT_NOT_NULL(record);
+    TEST_ASSERT_EQUAL_PTR(record, historyAt(0));
+    for (uint8_t age = 0; age <= i && age < historyCount(); age++)
+      checkBytes(*historyAt(age), 100 + i - age);
+  }
+  TEST_ASSERT_EQUAL(2, historyCount());
+}
+
+void test_history_rejects_oversized()
+{
+  uint8_t count = historyCount();
+  TEST_ASSERT_NULL(historyAdd(1, 8000, 16000, 60000, 60000, message, encoded)); // 7500 + 16000 bytes
+  TEST_ASSERT_EQUAL(count, historyCount());
+}
+
+int main(int argc, char **argv)
+{
+  UNITY_BEGIN();
+  RUN_TEST(test_history_add_and_find);
+  RUN_TEST(test_history_ring_evicts_oldest);
+  RUN_TEST(test_history_arena_wraps);
+  RUN_TEST(test_history_rejects_oversized);
+  return UNITY_END();
+}